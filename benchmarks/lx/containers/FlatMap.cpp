@@ -0,0 +1,184 @@
+// external
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+// lx
+#include <lx/containers/FlatMap.hpp>
+#include <lx/containers/StringId.hpp>
+
+// std
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+constexpr std::size_t entries_count = 100000u;
+
+std::vector<std::uint64_t> get_keys()
+{
+    std::vector<std::uint64_t> keys;
+    std::uint64_t state = 0x2545F4914F6CDD1Du;
+
+    for (std::size_t i = 0u; i < entries_count; i++)
+    {
+        state ^= state << 13u;
+        state ^= state >> 7u;
+        state ^= state << 17u;
+
+        keys.push_back(state);
+    }
+
+    return keys;
+}
+} // namespace
+
+TEST_CASE("FlatMap: integer keys", "[lx][containers][FlatMap][!benchmark]")
+{
+    using namespace lx::containers;
+
+    const std::vector<std::uint64_t> keys = get_keys();
+
+    FlatMap<std::uint64_t, std::uint64_t> flat_map;
+    std::unordered_map<std::uint64_t, std::uint64_t> unordered_map;
+
+    for (const std::uint64_t key : keys)
+    {
+        flat_map[key] = key;
+        unordered_map[key] = key;
+    }
+
+    BENCHMARK("FlatMap::operator[] insertion")
+    {
+        FlatMap<std::uint64_t, std::uint64_t> map;
+
+        for (const std::uint64_t key : keys)
+        {
+            map[key] = key;
+        }
+
+        return map.get_length();
+    };
+
+    BENCHMARK("std::unordered_map::operator[] insertion")
+    {
+        std::unordered_map<std::uint64_t, std::uint64_t> map;
+
+        for (const std::uint64_t key : keys)
+        {
+            map[key] = key;
+        }
+
+        return map.size();
+    };
+
+    BENCHMARK("FlatMap::find hit")
+    {
+        std::uint64_t sum = 0u;
+
+        for (const std::uint64_t key : keys)
+        {
+            sum += *flat_map.find(key);
+        }
+
+        return sum;
+    };
+
+    BENCHMARK("std::unordered_map::find hit")
+    {
+        std::uint64_t sum = 0u;
+
+        for (const std::uint64_t key : keys)
+        {
+            sum += unordered_map.find(key)->second;
+        }
+
+        return sum;
+    };
+
+    BENCHMARK("FlatMap::find miss")
+    {
+        std::size_t found = 0u;
+
+        for (const std::uint64_t key : keys)
+        {
+            found += nullptr != flat_map.find(key + 1u) ? 1u : 0u;
+        }
+
+        return found;
+    };
+
+    BENCHMARK("std::unordered_map::find miss")
+    {
+        std::size_t found = 0u;
+
+        for (const std::uint64_t key : keys)
+        {
+            found += unordered_map.end() != unordered_map.find(key + 1u) ? 1u : 0u;
+        }
+
+        return found;
+    };
+}
+
+TEST_CASE("FlatMap: string keys", "[lx][containers][FlatMap][!benchmark]")
+{
+    using namespace lx::containers;
+
+    std::vector<std::string> names;
+
+    for (std::size_t i = 0u; i < 10000u; i++)
+    {
+        names.push_back("assets/textures/tile_" + std::to_string(i) + ".png");
+    }
+
+    FlatMap<std::string, std::size_t> flat_map;
+    FlatMap<StringId, std::size_t> id_map;
+    std::unordered_map<std::string, std::size_t> unordered_map;
+    std::vector<StringId> ids;
+
+    for (std::size_t i = 0u; i < names.size(); i++)
+    {
+        flat_map[names[i]] = i;
+        id_map[StringId { names[i] }] = i;
+        unordered_map[names[i]] = i;
+        ids.push_back(StringId { names[i] });
+    }
+
+    BENCHMARK("FlatMap<std::string>::find")
+    {
+        std::size_t sum = 0u;
+
+        for (const std::string& name : names)
+        {
+            sum += *flat_map.find(name);
+        }
+
+        return sum;
+    };
+
+    BENCHMARK("FlatMap<StringId>::find")
+    {
+        std::size_t sum = 0u;
+
+        for (const StringId id : ids)
+        {
+            sum += *id_map.find(id);
+        }
+
+        return sum;
+    };
+
+    BENCHMARK("std::unordered_map<std::string>::find")
+    {
+        std::size_t sum = 0u;
+
+        for (const std::string& name : names)
+        {
+            sum += unordered_map.find(name)->second;
+        }
+
+        return sum;
+    };
+}
@@ -0,0 +1,139 @@
+// external
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+// lx
+#include <lx/containers/SlotMap.hpp>
+#include <lx/containers/SparseSet.hpp>
+
+// std
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+constexpr std::uint32_t entities_count = 100000u;
+
+struct Transform
+{
+    float x = 0.0f;
+    float y = 0.0f;
+    float angle = 0.0f;
+    float scale = 1.0f;
+};
+} // namespace
+
+TEST_CASE("SlotMap: dense component storage", "[lx][containers][SlotMap][!benchmark]")
+{
+    using namespace lx::containers;
+
+    SlotMap<Transform> slot_map;
+    SparseSet<Transform> sparse_set;
+    std::unordered_map<std::uint32_t, Transform> unordered_map;
+    std::vector<SlotMap<Transform>::Handle> handles;
+
+    // every third entity has the component, as in a sparse ECS column
+    for (std::uint32_t i = 0u; i < entities_count; i++)
+    {
+        handles.push_back(slot_map.emplace(Transform { .x = static_cast<float>(i) }));
+
+        if (0u == i % 3u)
+        {
+            sparse_set.emplace(i, Transform { .x = static_cast<float>(i) });
+            unordered_map[i] = Transform { .x = static_cast<float>(i) };
+        }
+    }
+
+    BENCHMARK("SlotMap iteration")
+    {
+        float sum = 0.0f;
+
+        for (const Transform& transform : slot_map)
+        {
+            sum += transform.x;
+        }
+
+        return sum;
+    };
+
+    BENCHMARK("SparseSet iteration")
+    {
+        float sum = 0.0f;
+
+        for (const Transform& transform : sparse_set)
+        {
+            sum += transform.x;
+        }
+
+        return sum;
+    };
+
+    BENCHMARK("std::unordered_map iteration")
+    {
+        float sum = 0.0f;
+
+        for (const auto& [key, transform] : unordered_map)
+        {
+            sum += transform.x;
+        }
+
+        return sum;
+    };
+
+    BENCHMARK("SlotMap::get")
+    {
+        float sum = 0.0f;
+
+        for (const SlotMap<Transform>::Handle handle : handles)
+        {
+            sum += slot_map.get(handle)->x;
+        }
+
+        return sum;
+    };
+
+    BENCHMARK("SparseSet::get")
+    {
+        float sum = 0.0f;
+
+        for (std::uint32_t i = 0u; i < entities_count; i++)
+        {
+            const Transform* transform = sparse_set.get(i);
+            sum += nullptr != transform ? transform->x : 0.0f;
+        }
+
+        return sum;
+    };
+
+    BENCHMARK("std::unordered_map::find")
+    {
+        float sum = 0.0f;
+
+        for (std::uint32_t i = 0u; i < entities_count; i++)
+        {
+            const auto transform = unordered_map.find(i);
+            sum += unordered_map.end() != transform ? transform->second.x : 0.0f;
+        }
+
+        return sum;
+    };
+
+    BENCHMARK("SlotMap churn")
+    {
+        SlotMap<Transform> map;
+        std::vector<SlotMap<Transform>::Handle> live;
+
+        for (std::uint32_t i = 0u; i < entities_count; i++)
+        {
+            live.push_back(map.emplace());
+
+            if (0u == i % 2u)
+            {
+                map.erase(live[i / 2u]);
+            }
+        }
+
+        return map.get_length();
+    };
+}
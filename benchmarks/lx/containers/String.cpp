@@ -0,0 +1,71 @@
+// external
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+// lx
+#include <lx/containers/String.hpp>
+
+// std
+#include <string>
+#include <string_view>
+
+namespace {
+constexpr std::size_t appends_count = 100u;
+constexpr std::string_view word = "lorem ipsum ";
+} // namespace
+
+TEST_CASE("String<T>: append", "[lx][containers][String<T>][!benchmark]")
+{
+    using namespace lx::containers;
+
+    BENCHMARK("String<char>::push_back(string_view)")
+    {
+        String<char> string;
+
+        for (std::size_t i = 0u; i < appends_count; i++)
+        {
+            string.push_back(word);
+        }
+
+        return string.get_length();
+    };
+
+    BENCHMARK("String<char>::push_back(char)")
+    {
+        String<char> string;
+
+        for (std::size_t i = 0u; i < appends_count; i++)
+        {
+            string.push_back('x');
+        }
+
+        return string.get_length();
+    };
+
+    BENCHMARK("std::string::append")
+    {
+        std::string string;
+
+        for (std::size_t i = 0u; i < appends_count; i++)
+        {
+            string.append(word);
+        }
+
+        return string.size();
+    };
+}
+
+TEST_CASE("String<T>: construction", "[lx][containers][String<T>][!benchmark]")
+{
+    using namespace lx::containers;
+
+    BENCHMARK("String<char> from short string_view")
+    {
+        return String<char>("short").get_length();
+    };
+
+    BENCHMARK("std::string from short string_view")
+    {
+        return std::string(std::string_view { "short" }).size();
+    };
+}
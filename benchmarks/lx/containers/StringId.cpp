@@ -0,0 +1,70 @@
+// external
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+// lx
+#include <lx/containers/StringId.hpp>
+
+// std
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+constexpr std::size_t names_count = 1000u;
+
+std::vector<std::string> get_names()
+{
+    std::vector<std::string> names;
+
+    for (std::size_t i = 0u; i < names_count; i++)
+    {
+        names.push_back("assets/textures/tile_" + std::to_string(i) + ".png");
+    }
+
+    return names;
+}
+} // namespace
+
+TEST_CASE("StringId: lookup", "[lx][containers][StringId][!benchmark]")
+{
+    using namespace lx::containers;
+
+    const std::vector<std::string> names = get_names();
+
+    std::unordered_map<std::string, std::size_t> by_string;
+    std::unordered_map<StringId, std::size_t> by_id;
+    std::vector<StringId> ids;
+
+    for (std::size_t i = 0u; i < names_count; i++)
+    {
+        by_string.emplace(names[i], i);
+        by_id.emplace(StringId { names[i] }, i);
+        ids.push_back(StringId { names[i] });
+    }
+
+    BENCHMARK("std::unordered_map<std::string>::find")
+    {
+        std::size_t sum = 0u;
+
+        for (const std::string& name : names)
+        {
+            sum += by_string.find(name)->second;
+        }
+
+        return sum;
+    };
+
+    BENCHMARK("std::unordered_map<StringId>::find")
+    {
+        std::size_t sum = 0u;
+
+        for (const StringId id : ids)
+        {
+            sum += by_id.find(id)->second;
+        }
+
+        return sum;
+    };
+}
@@ -0,0 +1,124 @@
+// external
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+// lx
+#include <lx/containers/SmallVector.hpp>
+#include <lx/containers/Vector.hpp>
+
+// std
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace {
+constexpr std::size_t elements_count = 1000u;
+}
+
+TEST_CASE("Vector<T>: push_back", "[lx][containers][Vector<T>][!benchmark]")
+{
+    using namespace lx::containers;
+
+    BENCHMARK("Vector<std::uint32_t>::push_back")
+    {
+        Vector<std::uint32_t> vector;
+
+        for (std::uint32_t i = 0u; i < elements_count; i++)
+        {
+            vector.push_back(i);
+        }
+
+        return vector.get_length();
+    };
+
+    BENCHMARK("std::vector<std::uint32_t>::push_back")
+    {
+        std::vector<std::uint32_t> vector;
+
+        for (std::uint32_t i = 0u; i < elements_count; i++)
+        {
+            vector.push_back(i);
+        }
+
+        return vector.size();
+    };
+
+    BENCHMARK("SmallVector<std::uint32_t, 16u>::push_back (16 elements)")
+    {
+        SmallVector<std::uint32_t, 16u> vector;
+
+        for (std::uint32_t i = 0u; i < 16u; i++)
+        {
+            vector.push_back(i);
+        }
+
+        return vector.get_length();
+    };
+
+    BENCHMARK("Vector<std::uint32_t>::push_back (16 elements)")
+    {
+        Vector<std::uint32_t> vector;
+
+        for (std::uint32_t i = 0u; i < 16u; i++)
+        {
+            vector.push_back(i);
+        }
+
+        return vector.get_length();
+    };
+}
+
+TEST_CASE("Vector<T>: emplace_back", "[lx][containers][Vector<T>][!benchmark]")
+{
+    using namespace lx::containers;
+
+    BENCHMARK("Vector<std::string>::emplace_back")
+    {
+        Vector<std::string> vector;
+
+        for (std::size_t i = 0u; i < elements_count; i++)
+        {
+            vector.emplace_back(32u, 'x');
+        }
+
+        return vector.get_length();
+    };
+
+    BENCHMARK("std::vector<std::string>::emplace_back")
+    {
+        std::vector<std::string> vector;
+
+        for (std::size_t i = 0u; i < elements_count; i++)
+        {
+            vector.emplace_back(32u, 'x');
+        }
+
+        return vector.size();
+    };
+}
+
+TEST_CASE("Vector<T>: copy", "[lx][containers][Vector<T>][!benchmark]")
+{
+    using namespace lx::containers;
+
+    Vector<std::uint32_t> source;
+    std::vector<std::uint32_t> std_source;
+
+    for (std::uint32_t i = 0u; i < elements_count; i++)
+    {
+        source.push_back(i);
+        std_source.push_back(i);
+    }
+
+    BENCHMARK("Vector<std::uint32_t> copy")
+    {
+        Vector<std::uint32_t> copy(source);
+        return copy.get_length();
+    };
+
+    BENCHMARK("std::vector<std::uint32_t> copy")
+    {
+        std::vector<std::uint32_t> copy(std_source);
+        return copy.size();
+    };
+}
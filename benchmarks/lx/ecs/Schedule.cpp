@@ -0,0 +1,100 @@
+// external
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+// lx
+#include <lx/ecs/Schedule.hpp>
+#include <lx/ecs/World.hpp>
+#include <lx/jobs/Scheduler.hpp>
+
+// std
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+namespace {
+constexpr std::uint32_t entities_count = 200000u;
+
+struct Position
+{
+    float x = 0.0f;
+    float y = 0.0f;
+};
+struct Velocity
+{
+    float x = 0.0f;
+    float y = 0.0f;
+};
+struct Rotation
+{
+    float angle = 0.0f;
+    float speed = 0.0f;
+};
+struct Bounds
+{
+    float min_x = 0.0f;
+    float min_y = 0.0f;
+    float max_x = 0.0f;
+    float max_y = 0.0f;
+};
+struct Health
+{
+    float value = 100.0f;
+    float regeneration = 0.5f;
+};
+} // namespace
+
+TEST_CASE("Schedule: frame", "[lx][ecs][Schedule][!benchmark]")
+{
+    using namespace lx::ecs;
+
+    lx::jobs::Scheduler scheduler;
+    World world;
+
+    // a scene of moving and spinning bodies, a half of them alive with health
+    for (std::uint32_t i = 0u; i < entities_count; i++)
+    {
+        const Entity entity = world.create(Position { .x = static_cast<float>(i % 1000u), .y = static_cast<float>(i / 1000u) },
+                                           Velocity { .x = 1.0f, .y = 0.5f },
+                                           Rotation { .angle = 0.0f, .speed = 0.1f },
+                                           Bounds {});
+        if (0u == i % 2u)
+        {
+            world.add<Health>(entity);
+        }
+    }
+
+    // steering and spinning are independent, movement follows steering, bounds follow both, health runs beside all of them
+    Schedule schedule;
+
+    schedule.add<Velocity, const Position>([](Velocity& velocity_a, const Position& position_a) {
+        velocity_a.x += std::sin(position_a.y) * 0.016f;
+        velocity_a.y += std::cos(position_a.x) * 0.016f;
+    });
+    schedule.add<Rotation>([](Rotation& rotation_a) { rotation_a.angle = std::fmod(rotation_a.angle + rotation_a.speed, 6.2831853f); });
+    schedule.add<Position, const Velocity>([](Position& position_a, const Velocity& velocity_a) {
+        position_a.x += velocity_a.x * 0.016f;
+        position_a.y += velocity_a.y * 0.016f;
+    });
+    schedule.add<Bounds, const Position, const Rotation>([](Bounds& bounds_a, const Position& position_a, const Rotation& rotation_a) {
+        const float extent = std::abs(std::cos(rotation_a.angle)) + std::abs(std::sin(rotation_a.angle));
+
+        bounds_a = { .min_x = position_a.x - extent,
+                     .min_y = position_a.y - extent,
+                     .max_x = position_a.x + extent,
+                     .max_y = position_a.y + extent };
+    });
+    schedule.add<Health>([](Health& health_a) { health_a.value = std::fmin(health_a.value + health_a.regeneration, 100.0f); });
+
+    BENCHMARK("Schedule::run, calling thread")
+    {
+        schedule.run(world);
+        return world.get_entities_count();
+    };
+
+    BENCHMARK("Schedule::run, jobs::Scheduler")
+    {
+        schedule.run(world, scheduler);
+        return world.get_entities_count();
+    };
+}
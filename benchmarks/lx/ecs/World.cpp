@@ -0,0 +1,116 @@
+// external
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+// lx
+#include <lx/containers/SparseSet.hpp>
+#include <lx/ecs/World.hpp>
+
+// std
+#include <cstddef>
+#include <cstdint>
+
+namespace {
+constexpr std::uint32_t entities_count = 100000u;
+
+struct Position
+{
+    float x = 0.0f;
+    float y = 0.0f;
+    float z = 0.0f;
+};
+struct Velocity
+{
+    float x = 0.0f;
+    float y = 0.0f;
+    float z = 0.0f;
+};
+struct Health
+{
+    std::uint32_t value = 100u;
+    std::uint32_t armor = 0u;
+};
+} // namespace
+
+TEST_CASE("World: iteration", "[lx][ecs][World][!benchmark]")
+{
+    using namespace lx::containers;
+    using namespace lx::ecs;
+
+    World world;
+    SparseSet<Position> positions;
+    SparseSet<Velocity> velocities;
+    SparseSet<Health> healths;
+
+    // a half of the entities has health, which splits them into two archetypes
+    for (std::uint32_t i = 0u; i < entities_count; i++)
+    {
+        const Entity entity = world.create(Position { .x = static_cast<float>(i) }, Velocity { .x = 1.0f, .y = 1.0f, .z = 1.0f });
+        positions.emplace(i, Position { .x = static_cast<float>(i) });
+        velocities.emplace(i, Velocity { .x = 1.0f, .y = 1.0f, .z = 1.0f });
+
+        if (0u == i % 2u)
+        {
+            world.add<Health>(entity);
+            healths.emplace(i, Health {});
+        }
+    }
+
+    BENCHMARK("World each")
+    {
+        world.each<Position, const Velocity>([](Position& position_a, const Velocity& velocity_a) {
+            position_a.x += velocity_a.x * 0.016f;
+            position_a.y += velocity_a.y * 0.016f;
+            position_a.z += velocity_a.z * 0.016f;
+        });
+
+        return world.get_entities_count();
+    };
+
+    BENCHMARK("World each_chunk")
+    {
+        world.each_chunk<Position, const Velocity>([](const View<Position, const Velocity>& view_a) {
+            const std::span<Position> position = view_a.get<Position>();
+            const std::span<const Velocity> velocity = view_a.get<const Velocity>();
+
+            for (std::size_t i = 0u; i < view_a.get_length(); i++)
+            {
+                position[i].x += velocity[i].x * 0.016f;
+                position[i].y += velocity[i].y * 0.016f;
+                position[i].z += velocity[i].z * 0.016f;
+            }
+        });
+
+        return world.get_entities_count();
+    };
+
+    BENCHMARK("SparseSet join")
+    {
+        const std::span<const std::uint32_t> keys = positions.get_keys();
+        Position* position = positions.begin();
+
+        for (std::size_t i = 0u; i < keys.size(); i++)
+        {
+            const Velocity& velocity = *velocities.get(keys[i]);
+
+            position[i].x += velocity.x * 0.016f;
+            position[i].y += velocity.y * 0.016f;
+            position[i].z += velocity.z * 0.016f;
+        }
+
+        return positions.get_length();
+    };
+
+    BENCHMARK("World add and remove")
+    {
+        for (std::uint32_t i = 0u; i < 1000u; i++)
+        {
+            const Entity entity = { .value = i * 2u + 1u };
+
+            world.add<Health>(entity);
+            world.remove<Health>(entity);
+        }
+
+        return world.get_archetypes_count();
+    };
+}
@@ -0,0 +1,63 @@
+// external
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+// lx
+#include <lx/jobs/Scheduler.hpp>
+
+// std
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace {
+constexpr std::size_t particles_count = 1u << 20u;
+
+// a few dozen flops per element, enough for the work to dominate the scheduling
+void integrate(std::vector<float>& positions_a, std::vector<float>& velocities_a, std::size_t begin_a, std::size_t end_a)
+{
+    for (std::size_t i = begin_a; i < end_a; i++)
+    {
+        velocities_a[i] += std::sin(positions_a[i]) * 0.016f;
+        positions_a[i] += velocities_a[i] * 0.016f;
+    }
+}
+} // namespace
+
+TEST_CASE("Scheduler: parallel_for", "[lx][jobs][Scheduler][!benchmark]")
+{
+    using namespace lx::jobs;
+
+    Scheduler scheduler;
+
+    std::vector<float> positions(particles_count, 1.0f);
+    std::vector<float> velocities(particles_count, 0.0f);
+
+    BENCHMARK("serial loop")
+    {
+        integrate(positions, velocities, 0u, particles_count);
+        return positions[0];
+    };
+
+    BENCHMARK("Scheduler::parallel_for, grain 4096")
+    {
+        scheduler.parallel_for(0u, particles_count, 4096u, [&](std::size_t begin_a, std::size_t end_a) {
+            integrate(positions, velocities, begin_a, end_a);
+        });
+
+        return positions[0];
+    };
+
+    BENCHMARK("Scheduler::submit + wait, 1000 empty jobs")
+    {
+        Counter counter;
+
+        for (std::size_t i = 0u; i < 1000u; i++)
+        {
+            scheduler.submit(counter, []() {});
+        }
+
+        scheduler.wait(counter);
+        return counter.is_done();
+    };
+}
@@ -0,0 +1,77 @@
+// external
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+// lx
+#include <lx/math/Matrix.hpp>
+
+// std
+#include <cstddef>
+#include <vector>
+
+namespace {
+constexpr std::size_t points_count = 4096u;
+
+constexpr lx::math::Matrix<float, 4u> transformation = {
+    .column_0 = { .x = 0.0f, .y = 2.0f, .z = 0.0f, .w = 0.0f },
+    .column_1 = { .x = -3.0f, .y = 0.0f, .z = 0.0f, .w = 0.0f },
+    .column_2 = { .x = 0.0f, .y = 0.0f, .z = 4.0f, .w = 0.0f },
+    .column_3 = { .x = 5.0f, .y = 6.0f, .z = 7.0f, .w = 1.0f },
+};
+} // namespace
+
+TEST_CASE("Matrix<T, 4u>: operations", "[lx][math][Matrix<T, 4u>][!benchmark]")
+{
+    using namespace lx::math;
+
+    // kept opaque to the optimizer, otherwise the constant matrix is folded away
+    Matrix<float, 4u> matrix = transformation;
+
+    BENCHMARK("multiply")
+    {
+        Catch::Benchmark::deoptimize_value(matrix);
+        return matrix * transformation;
+    };
+
+    BENCHMARK("transposed")
+    {
+        Catch::Benchmark::deoptimize_value(matrix);
+        return transposed(matrix);
+    };
+
+    BENCHMARK("inverted")
+    {
+        Catch::Benchmark::deoptimize_value(matrix);
+        return inverted(matrix);
+    };
+
+    BENCHMARK("determinant")
+    {
+        Catch::Benchmark::deoptimize_value(matrix);
+        return determinant(matrix);
+    };
+}
+
+TEST_CASE("Matrix<T, 4u>: transform_points", "[lx][math][Matrix<T, 4u>][!benchmark]")
+{
+    using namespace lx::math;
+
+    std::vector<Vector<float, 2u>> points(points_count, Vector<float, 2u> { .x = 1.0f, .y = 2.0f });
+    std::vector<Vector<float, 2u>> transformed(points_count);
+
+    BENCHMARK("transform_points")
+    {
+        transform_points(transformation, points, transformed);
+        return transformed[0];
+    };
+
+    BENCHMARK("transform_point per point")
+    {
+        for (std::size_t i = 0u; i < points_count; i++)
+        {
+            transformed[i] = transform_point(transformation, points[i]);
+        }
+
+        return transformed[0];
+    };
+}
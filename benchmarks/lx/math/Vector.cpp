@@ -0,0 +1,68 @@
+// external
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+// lx
+#include <lx/math/Vector.hpp>
+
+// std
+#include <cstddef>
+#include <vector>
+
+namespace {
+constexpr std::size_t vectors_count = 4096u;
+}
+
+TEST_CASE("Vector<T, 2u>: arithmetic", "[lx][math][Vector<T, 2u>][!benchmark]")
+{
+    using namespace lx::math;
+
+    std::vector<Vector<float, 2u>> positions(vectors_count, Vector<float, 2u> { .x = 1.0f, .y = 2.0f });
+    std::vector<Vector<float, 2u>> velocities(vectors_count, Vector<float, 2u> { .x = 0.5f, .y = -0.25f });
+
+    BENCHMARK("position + velocity * dt")
+    {
+        for (std::size_t i = 0u; i < vectors_count; i++)
+        {
+            positions[i] = positions[i] + velocities[i] * 0.016f;
+        }
+
+        return positions[0];
+    };
+
+    BENCHMARK("dot")
+    {
+        float sum = 0.0f;
+
+        for (std::size_t i = 0u; i < vectors_count; i++)
+        {
+            sum += dot(positions[i], velocities[i]);
+        }
+
+        return sum;
+    };
+
+    BENCHMARK("length")
+    {
+        float sum = 0.0f;
+
+        for (std::size_t i = 0u; i < vectors_count; i++)
+        {
+            sum += length(positions[i]);
+        }
+
+        return sum;
+    };
+
+    BENCHMARK("normalized")
+    {
+        Vector<float, 2u> sum;
+
+        for (std::size_t i = 0u; i < vectors_count; i++)
+        {
+            sum = sum + normalized(velocities[i]);
+        }
+
+        return sum;
+    };
+}
@@ -0,0 +1,103 @@
+// external
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+// lx
+#include <lx/math/Matrix.hpp>
+#include <lx/math/Vector.hpp>
+#include <lx/math/batch.hpp>
+
+// std
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace {
+constexpr std::size_t vectors_count = 100000u;
+
+constexpr lx::math::Matrix<float, 4u> transformation = {
+    .column_0 = { .x = 0.0f, .y = 2.0f, .z = 0.0f, .w = 0.0f },
+    .column_1 = { .x = -3.0f, .y = 0.0f, .z = 0.0f, .w = 0.0f },
+    .column_2 = { .x = 0.0f, .y = 0.0f, .z = 4.0f, .w = 0.0f },
+    .column_3 = { .x = 5.0f, .y = 6.0f, .z = 7.0f, .w = 1.0f },
+};
+
+const char* get_name(lx::math::batch::Level level_a)
+{
+    switch (level_a)
+    {
+        case lx::math::batch::Level::base:
+            return "base";
+        case lx::math::batch::Level::avx2:
+            return "avx2";
+        case lx::math::batch::Level::avx512:
+            return "avx512";
+    }
+
+    return "";
+}
+} // namespace
+
+TEST_CASE("batch: transform and normalize", "[lx][math][batch][!benchmark]")
+{
+    using namespace lx::math;
+
+    std::vector<Vector<float, 2u>> vectors(vectors_count, Vector<float, 2u> { .x = 1.0f, .y = 2.0f });
+    std::vector<Vector<float, 2u>> result(vectors_count);
+    std::vector<float> x(vectors_count, 1.0f), y(vectors_count, 2.0f);
+    std::vector<float> result_x(vectors_count), result_y(vectors_count);
+
+    const batch::Streams<const float> streams = { .x = x, .y = y };
+    const batch::Streams<float> result_streams = { .x = result_x, .y = result_y };
+
+    BENCHMARK("transform_point per vector")
+    {
+        for (std::size_t i = 0u; i < vectors_count; i++)
+        {
+            result[i] = transform_point(transformation, vectors[i]);
+        }
+
+        return result[0];
+    };
+    BENCHMARK("normalized per vector")
+    {
+        for (std::size_t i = 0u; i < vectors_count; i++)
+        {
+            result[i] = normalized(vectors[i]);
+        }
+
+        return result[0];
+    };
+
+    const batch::Level max_level = batch::get_max_level();
+
+    for (batch::Level level = batch::Level::base; level <= max_level; level = static_cast<batch::Level>(static_cast<int>(level) + 1))
+    {
+        batch::set_level(level);
+
+        const std::string name = get_name(level);
+
+        BENCHMARK("transform, vectors, " + name)
+        {
+            batch::transform(transformation, vectors, result);
+            return result[0];
+        };
+        BENCHMARK("transform, streams, " + name)
+        {
+            batch::transform(transformation, streams, result_streams);
+            return result_x[0];
+        };
+        BENCHMARK("normalize, vectors, " + name)
+        {
+            batch::normalize(vectors, result);
+            return result[0];
+        };
+        BENCHMARK("normalize, streams, " + name)
+        {
+            batch::normalize(streams, result_streams);
+            return result_x[0];
+        };
+    }
+
+    batch::set_level(max_level);
+}
@@ -0,0 +1,124 @@
+// external
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+// lx
+#include <lx/common/out.hpp>
+#include <lx/math/fast.hpp>
+
+// std
+#include <cstddef>
+#include <vector>
+
+namespace {
+using lx::math::fast;
+
+constexpr std::size_t values_count = 4096u;
+
+std::vector<float> make_values(float first_a, float last_a)
+{
+    std::vector<float> values(values_count);
+
+    for (std::size_t i = 0u; i < values_count; i++)
+    {
+        values[i] = first_a + (last_a - first_a) * static_cast<float>(i) / static_cast<float>(values_count);
+    }
+
+    return values;
+}
+
+// written to memory rather than summed, a sum is a dependency chain that keeps the loop from vectorizing
+template<typename Function>
+float run(const std::vector<float>& values_a, lx::common::out<std::vector<float>> results_a, Function function_a)
+{
+    for (std::size_t i = 0u; i < values_a.size(); i++)
+    {
+        (*results_a)[i] = function_a(values_a[i]);
+    }
+
+    return results_a->front();
+}
+} // namespace
+
+TEST_CASE("fast: approximations against the standard library", "[lx][math][fast][!benchmark]")
+{
+    const std::vector<float> angles = make_values(-100.0f, 100.0f);
+    const std::vector<float> positives = make_values(0.01f, 1000.0f);
+
+    std::vector<float> results(values_count);
+
+    BENCHMARK("rsqrt, precise")
+    {
+        return run(positives, lx::common::out(results), [](float value_a) { return fast::rsqrt<fast::Accuracy::precise>(value_a); });
+    };
+    BENCHMARK("rsqrt, high")
+    {
+        return run(positives, lx::common::out(results), [](float value_a) { return fast::rsqrt<fast::Accuracy::high>(value_a); });
+    };
+    BENCHMARK("rsqrt, low")
+    {
+        return run(positives, lx::common::out(results), [](float value_a) { return fast::rsqrt<fast::Accuracy::low>(value_a); });
+    };
+
+    BENCHMARK("sincos, precise")
+    {
+        return run(angles, lx::common::out(results), [](float value_a) {
+            float sine = 0.0f;
+            float cosine = 0.0f;
+
+            fast::sincos<fast::Accuracy::precise>(value_a, lx::common::out(sine), lx::common::out(cosine));
+            return sine + cosine;
+        });
+    };
+    BENCHMARK("sincos, high")
+    {
+        return run(angles, lx::common::out(results), [](float value_a) {
+            float sine = 0.0f;
+            float cosine = 0.0f;
+
+            fast::sincos<fast::Accuracy::high>(value_a, lx::common::out(sine), lx::common::out(cosine));
+            return sine + cosine;
+        });
+    };
+    BENCHMARK("sincos, low")
+    {
+        return run(angles, lx::common::out(results), [](float value_a) {
+            float sine = 0.0f;
+            float cosine = 0.0f;
+
+            fast::sincos<fast::Accuracy::low>(value_a, lx::common::out(sine), lx::common::out(cosine));
+            return sine + cosine;
+        });
+    };
+
+    BENCHMARK("atan2, precise")
+    {
+        return run(angles, lx::common::out(results), [](float value_a) {
+            return fast::atan2<fast::Accuracy::precise>(value_a, 1.0f - value_a);
+        });
+    };
+    BENCHMARK("atan2, high")
+    {
+        return run(angles, lx::common::out(results), [](float value_a) {
+            return fast::atan2<fast::Accuracy::high>(value_a, 1.0f - value_a);
+        });
+    };
+
+    BENCHMARK("exp, precise")
+    {
+        return run(angles, lx::common::out(results), [](float value_a) { return fast::exp<fast::Accuracy::precise>(value_a * 0.5f); });
+    };
+    BENCHMARK("exp, high")
+    {
+        return run(angles, lx::common::out(results), [](float value_a) { return fast::exp<fast::Accuracy::high>(value_a * 0.5f); });
+    };
+
+    BENCHMARK("log, precise")
+    {
+        return run(positives, lx::common::out(results), [](float value_a) { return fast::log<fast::Accuracy::precise>(value_a); });
+    };
+    BENCHMARK("log, high")
+    {
+        return run(positives, lx::common::out(results), [](float value_a) { return fast::log<fast::Accuracy::high>(value_a); });
+    };
+}
@@ -0,0 +1,91 @@
+// external
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+// lx
+#include <lx/containers/Vector.hpp>
+#include <lx/memory/Allocator.hpp>
+#include <lx/memory/Arena.hpp>
+#include <lx/memory/Resource.hpp>
+
+// std
+#include <cstdint>
+
+namespace {
+constexpr std::size_t allocations_count = 256u;
+}
+
+TEST_CASE("Arena: allocate", "[lx][memory][Arena][!benchmark]")
+{
+    using namespace lx::memory;
+
+    Arena arena(allocations_count * 64u);
+
+    BENCHMARK("Arena allocate + reset")
+    {
+        void* last = nullptr;
+
+        for (std::size_t i = 0u; i < allocations_count; i++)
+        {
+            last = arena.allocate(48u, 16u);
+        }
+
+        arena.reset();
+        return last;
+    };
+
+    BENCHMARK("Heap allocate + deallocate")
+    {
+        void* pointers[allocations_count];
+
+        for (std::size_t i = 0u; i < allocations_count; i++)
+        {
+            pointers[i] = Heap::get_default().allocate(48u, 16u);
+        }
+        for (std::size_t i = 0u; i < allocations_count; i++)
+        {
+            Heap::get_default().deallocate(pointers[i], 48u, 16u);
+        }
+
+        return pointers[0];
+    };
+}
+
+TEST_CASE("Arena: Vector", "[lx][memory][Arena][!benchmark]")
+{
+    using namespace lx::containers;
+    using namespace lx::memory;
+
+    Arena arena(64u * 1024u);
+
+    BENCHMARK("Vector<std::uint32_t, 0u, Allocator> on Arena")
+    {
+        std::size_t length = 0u;
+
+        {
+            Vector<std::uint32_t, 0u, Allocator<std::uint32_t>> vector { Allocator<std::uint32_t>(arena) };
+
+            for (std::uint32_t i = 0u; i < 1000u; i++)
+            {
+                vector.push_back(i);
+            }
+
+            length = vector.get_length();
+        }
+
+        arena.reset();
+        return length;
+    };
+
+    BENCHMARK("Vector<std::uint32_t, 0u, Allocator> on Heap")
+    {
+        Vector<std::uint32_t, 0u, Allocator<std::uint32_t>> vector;
+
+        for (std::uint32_t i = 0u; i < 1000u; i++)
+        {
+            vector.push_back(i);
+        }
+
+        return vector.get_length();
+    };
+}
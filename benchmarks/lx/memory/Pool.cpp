@@ -0,0 +1,82 @@
+// external
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+// lx
+#include <lx/memory/Pool.hpp>
+
+// std
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace {
+constexpr std::size_t objects_count = 1024u;
+
+struct Object
+{
+    float position[2];
+    float velocity[2];
+};
+} // namespace
+
+TEST_CASE("Pool<T>: create/destroy", "[lx][memory][Pool<T>][!benchmark]")
+{
+    using namespace lx::memory;
+
+    Pool<Object> pool(objects_count);
+    std::vector<Pool<Object>::Handle> handles(objects_count);
+
+    BENCHMARK("Pool<Object> create + destroy")
+    {
+        for (std::size_t i = 0u; i < objects_count; i++)
+        {
+            handles[i] = pool.create();
+        }
+        for (std::size_t i = 0u; i < objects_count; i++)
+        {
+            pool.destroy(handles[i]);
+        }
+
+        return pool.get_length();
+    };
+
+    std::vector<std::unique_ptr<Object>> objects(objects_count);
+
+    BENCHMARK("std::make_unique<Object> + reset")
+    {
+        for (std::size_t i = 0u; i < objects_count; i++)
+        {
+            objects[i] = std::make_unique<Object>();
+        }
+        for (std::size_t i = 0u; i < objects_count; i++)
+        {
+            objects[i].reset();
+        }
+
+        return objects.size();
+    };
+}
+
+TEST_CASE("Pool<T>: iteration", "[lx][memory][Pool<T>][!benchmark]")
+{
+    using namespace lx::memory;
+
+    Pool<Object> pool(objects_count);
+
+    for (std::size_t i = 0u; i < objects_count; i++)
+    {
+        pool.create(Object { .position = { 0.0f, 0.0f }, .velocity = { 1.0f, 2.0f } });
+    }
+
+    BENCHMARK("Pool<Object> dense iteration")
+    {
+        for (Object& object : pool)
+        {
+            object.position[0] += object.velocity[0];
+            object.position[1] += object.velocity[1];
+        }
+
+        return pool.get_length();
+    };
+}
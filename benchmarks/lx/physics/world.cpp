@@ -0,0 +1,107 @@
+// external
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+// lx
+#include <lx/physics/world.hpp>
+
+// std
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace {
+struct Body
+{
+    lx::physics::Aabb bounds;
+    lx::math::Vector<float, 2u> velocity;
+};
+
+// bodies of similar size bouncing in a square, about as dense as a crowded scene
+std::vector<Body> make_bodies(std::size_t count_a)
+{
+    const float side = std::sqrt(static_cast<float>(count_a)) * 3.0f;
+
+    std::mt19937 random(5u);
+    std::uniform_real_distribution<float> position(0.0f, side);
+    std::uniform_real_distribution<float> velocity(-0.05f, 0.05f);
+
+    std::vector<Body> bodies(count_a);
+
+    for (Body& body : bodies)
+    {
+        const float x = position(random);
+        const float y = position(random);
+
+        body.bounds = { .min = { .x = x, .y = y }, .max = { .x = x + 1.0f, .y = y + 1.0f } };
+        body.velocity = { .x = velocity(random), .y = velocity(random) };
+    }
+
+    return bodies;
+}
+
+void step(lx::physics::world& world_a, std::vector<Body>& bodies_a, const std::vector<lx::physics::world::Id>& ids_a)
+{
+    for (std::size_t i = 0u; i < bodies_a.size(); i++)
+    {
+        Body& body = bodies_a[i];
+
+        body.bounds.min = body.bounds.min + body.velocity;
+        body.bounds.max = body.bounds.max + body.velocity;
+        world_a.move(ids_a[i], body.bounds, body.velocity);
+    }
+
+    world_a.update();
+}
+
+void run(lx::physics::world::Broadphase broadphase_a, std::size_t count_a, const char* name_a)
+{
+    using namespace lx::physics;
+
+    world world({ .broadphase = broadphase_a, .margin = 0.1f, .cell_size = 2.0f });
+    std::vector<Body> bodies = make_bodies(count_a);
+    std::vector<world::Id> ids;
+
+    for (const Body& body : bodies)
+    {
+        ids.push_back(world.create(body.bounds));
+    }
+
+    world.update();
+
+    BENCHMARK(name_a)
+    {
+        step(world, bodies, ids);
+        return world.get_pairs().size();
+    };
+}
+} // namespace
+
+TEST_CASE("world: broadphase step", "[lx][physics][world][!benchmark]")
+{
+    using namespace lx::physics;
+
+    run(world::Broadphase::tree, 10000u, "DynamicTree, 10k bodies");
+    run(world::Broadphase::grid, 10000u, "SpatialHash, 10k bodies");
+    run(world::Broadphase::tree, 100000u, "DynamicTree, 100k bodies");
+    run(world::Broadphase::grid, 100000u, "SpatialHash, 100k bodies");
+
+    std::vector<Body> bodies = make_bodies(10000u);
+
+    BENCHMARK("brute force, 10k bodies")
+    {
+        std::size_t pairs = 0u;
+
+        for (std::size_t i = 0u; i < bodies.size(); i++)
+        {
+            for (std::size_t j = i + 1u; j < bodies.size(); j++)
+            {
+                pairs += true == bodies[i].bounds.overlaps(bodies[j].bounds) ? 1u : 0u;
+            }
+        }
+
+        return pairs;
+    };
+}
@@ -0,0 +1,65 @@
+// external
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+// lx
+#include <lx/utils/log_record.hpp>
+#include <lx/utils/logger.hpp>
+
+// std
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+TEST_CASE("logger: throughput", "[lx][utils][logger][!benchmark]")
+{
+    using namespace lx::utils;
+
+    FILE* file = std::tmpfile();
+    REQUIRE(nullptr != file);
+
+    logger::set_output(file, false);
+    logger::set_filter(logger::inf | logger::wrn | logger::err | logger::omg | logger::dbg);
+
+    BENCHMARK("sync log_inf")
+    {
+        log_inf("frame {} took {:.3f} ms", 42u, 16.6f);
+    };
+
+    logger::set_mode(logger::Mode::async);
+
+    BENCHMARK("async log_inf")
+    {
+        log_inf("frame {} took {:.3f} ms", 42u, 16.6f);
+    };
+
+    // leaving async mode drains the ring, nothing is written to the file after that
+    logger::set_mode(logger::Mode::sync);
+    std::fclose(file);
+}
+
+TEST_CASE("log_record: encode/format", "[lx][utils][log_record][!benchmark]")
+{
+    using namespace lx::utils;
+
+    std::vector<std::byte> payload(log_record::get_encoded_size(42u, 16.6f, std::string_view { "name" }));
+
+    BENCHMARK("encode")
+    {
+        return log_record::encode(payload.data(), 42u, 16.6f, std::string_view { "name" });
+    };
+
+    std::string text;
+
+    BENCHMARK("format_to")
+    {
+        text.clear();
+        auto output = std::back_inserter(text);
+
+        return log_record::format_to(lx::common::out(output), "frame {} took {:.3f} ms by {}", payload);
+    };
+}
@@ -0,0 +1,12 @@
+#include <catch2/catch_session.hpp>
+
+// std
+#include <cstdint>
+
+// run with --reporter JSON::out=<file> to keep results comparable across commits
+int main(int argc, char* argv[])
+{
+    std::int32_t result = Catch::Session().run(argc, argv);
+
+    return result;
+}
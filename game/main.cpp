@@ -7,6 +7,8 @@ void lx::app::setup(lx::common::out<lx::app::Config> config_a)
     // log config
     config_a->log.console = true;
     config_a->log.path = "log.txt";
+    config_a->log.async = true;
+    config_a->log.binary = false;
 
     // app config
     config_a->app.name = "test game";
@@ -23,6 +25,8 @@ std::int32_t lx::app::entry_point(std::span<const lx::devices::Display> displays
                                   std::span<const lx::devices::GPU> gpus_a,
                                   gpu::Context& graphics_context,
                                   lx::Windower& windower_a,
+                                  lx::memory::FrameArena<2u>& frame_arena_a,
+                                  lx::jobs::Scheduler& scheduler_a,
                                   std::string_view cmd_line_a)
 {
     using namespace lx::common;
@@ -34,6 +38,7 @@ std::int32_t lx::app::entry_point(std::span<const lx::devices::Display> displays
     log_inf("Command line args: \"{}\"", cmd_line_a);
     log_inf("Displays count: {}", displays_a.size());
     log_inf("GPUs count: {}", gpus_a.size());
+    log_inf("Job workers count: {}", scheduler_a.get_workers_count());
 
     for (auto q : gpus_a[0].queue_families)
     {
@@ -93,6 +98,8 @@ std::int32_t lx::app::entry_point(std::span<const lx::devices::Display> displays
 
                 do
                 {
+                    frame_arena_a.next_frame();
+
                     c1 = windower_a.update(canvas1);
                     c2 = windower_a.update(canvas2);
                 } while (true == c1 || true == c2);
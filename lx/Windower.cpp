@@ -47,6 +47,8 @@ LRESULT __stdcall Windower::window_procedure(HWND hwnd, uint32_t message, WPARAM
 
 Windower::Windower()
     : events {}
+    , framed_canvases(max_canvases_count)
+    , fullscreen_canvases(max_canvases_count)
 {
     WNDCLASSEX window_class_descriptor {};
     window_class_descriptor.cbSize = sizeof(WNDCLASSEXW);
@@ -62,6 +64,12 @@ Windower::Windower()
 
 Windower::~Windower()
 {
+    // surfaces of canvases left alive are gone with the vulkan instance already, only the windows are still to be released
+    for (Canvas<Windower::Kind::framed>& canvas : this->framed_canvases)
+    {
+        DestroyWindow(canvas.window_handle);
+    }
+
     UnregisterClass(MAKEINTATOM(this->wnd_class), GetModuleHandle(nullptr));
 }
 
@@ -89,8 +97,13 @@ Canvas<Windower::Kind::framed>* Windower::create<Windower::Kind::framed>(const l
                                  GetModuleHandle(nullptr),
                                  nullptr);
 
-    auto canvas = new Canvas<Windower::Kind::framed> { handle, properties_a };
-    this->framed_windows[canvas] = handle;
+    auto canvas = this->framed_canvases.get(this->framed_canvases.create(handle, properties_a));
+
+    if (nullptr == canvas)
+    {
+        DestroyWindow(handle);
+        return nullptr;
+    }
 
     SetWindowLongPtr(handle, GWLP_USERDATA, reinterpret_cast<LONG_PTR>(canvas));
 
@@ -99,17 +112,22 @@ Canvas<Windower::Kind::framed>* Windower::create<Windower::Kind::framed>(const l
 
 template<> void Windower::destroy<Windower::Kind::framed>(out<Canvas<Windower::Kind::framed>*> canvas_a)
 {
-    (*canvas_a)->destroy();
-    DestroyWindow(this->framed_windows[*canvas_a]);
+    auto handle = this->framed_canvases.get_handle(*canvas_a);
+
+    if (true == this->framed_canvases.is_valid(handle))
+    {
+        (*canvas_a)->destroy();
+        DestroyWindow((*canvas_a)->window_handle);
 
-    // TODO: remove canvas from framed_windows
+        this->framed_canvases.destroy(handle);
+    }
 
-    delete (*canvas_a);
     (*canvas_a) = nullptr;
 }
 
 Canvas<Windower::framed>::Canvas(HWND window_handle_a, const Properties& properties_a)
-    : properties(properties_a)
+    : window_handle(window_handle_a)
+    , properties(properties_a)
 {
     VkWin32SurfaceCreateInfoKHR vk_surface_create_info = { .sType = VK_STRUCTURE_TYPE_WIN32_SURFACE_CREATE_INFO_KHR,
                                                            .pNext = nullptr,
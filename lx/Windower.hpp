@@ -8,10 +8,10 @@
 #include <lx/containers/Vector.hpp>
 #include <lx/devices/Display.hpp>
 #include <lx/gpu/loader/vulkan.hpp>
+#include <lx/memory/Pool.hpp>
 
 // std
 #include <cassert>
-#include <unordered_map>
 #include <utility>
 
 namespace lx::gpu {
@@ -63,12 +63,16 @@ private:
     template<auto Kind> bool update(HWND window_handle) = delete;
     void set_visible(HWND window_handle_a, bool visible_a);
 
+    template<auto Kind> HWND get_window_handle(const Canvas<Kind>* canvas_a) const = delete;
+
     static LRESULT __stdcall window_procedure(HWND hwnd, uint32_t message, WPARAM wParam, LPARAM lParam);
 
+    constexpr static std::size_t max_canvases_count = 8u;
+
     ATOM wnd_class = 0u;
 
-    std::unordered_map<const Canvas<Kind::framed>*, HWND> framed_windows;
-    std::unordered_map<const Canvas<Kind::fullscreen>*, HWND> fullscreen_windows;
+    lx::memory::Pool<Canvas<Kind::framed>> framed_canvases;
+    lx::memory::Pool<Canvas<Kind::fullscreen>> fullscreen_canvases;
 
     friend lx::gpu::Device;
 };
@@ -108,10 +112,12 @@ private:
     void destroy();
 
     VkSurfaceKHR vk_surface = VK_NULL_HANDLE;
+    HWND window_handle = nullptr;
     Properties properties;
 
     friend Windower;
     friend lx::gpu::Device;
+    template<typename, typename> friend class lx::memory::Pool;
 };
 template<> class Canvas<Windower::fullscreen>
 {
@@ -137,22 +143,33 @@ private:
 template<> bool Windower::update<Windower::Kind::framed>(HWND window_handle); 
 template<> bool Windower::update<Windower::Kind::fullscreen>(HWND window_handle);
 
+template<> inline HWND Windower::get_window_handle<Windower::Kind::framed>(const Canvas<Kind::framed>* canvas_a) const
+{
+    assert(true == this->framed_canvases.is_valid(this->framed_canvases.get_handle(canvas_a)));
+    return canvas_a->window_handle;
+}
+template<> inline HWND Windower::get_window_handle<Windower::Kind::fullscreen>(const Canvas<Kind::fullscreen>* canvas_a) const
+{
+    assert(true == this->fullscreen_canvases.is_valid(this->fullscreen_canvases.get_handle(canvas_a)));
+    return canvas_a->handle;
+}
+
 inline bool Windower::update(const Canvas<Kind::framed>* canvas_a)
 {
-    return this->update<Kind::framed>(this->framed_windows[canvas_a]);
+    return this->update<Kind::framed>(this->get_window_handle(canvas_a));
 }
 inline bool Windower::update(const Canvas<Kind::fullscreen>* canvas_a)
 {
-    return this->update<Kind::fullscreen>(this->fullscreen_windows[canvas_a]);
+    return this->update<Kind::fullscreen>(this->get_window_handle(canvas_a));
 }
 
 inline void Windower::set_visible(const Canvas<Kind::framed>* canvas_a, bool visible_a)
 {
-    this->set_visible(this->framed_windows[canvas_a], visible_a);
+    this->set_visible(this->get_window_handle(canvas_a), visible_a);
 }
 inline void Windower::set_visible(const Canvas<Kind::fullscreen>* canvas_a, bool visible_a)
 {
-    this->set_visible(this->fullscreen_windows[canvas_a], visible_a);
+    this->set_visible(this->get_window_handle(canvas_a), visible_a);
 }
 
 template<>
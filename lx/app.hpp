@@ -10,6 +10,8 @@
 #include <lx/devices/Display.hpp>
 #include <lx/devices/GPU.hpp>
 #include <lx/gpu/Context.hpp>
+#include <lx/jobs/Scheduler.hpp>
+#include <lx/memory/Arena.hpp>
 
 // std
 #include <cstdint>
@@ -24,6 +26,8 @@ struct app : lx::common::non_constructible
         {
             lx::containers::String<char> path;
             bool console;
+            bool async;
+            bool binary;
         } log;
 
         struct app
@@ -72,6 +76,8 @@ struct app : lx::common::non_constructible
                                     std::span<const devices::GPU> gpus_a,
                                     lx::gpu::Context& graphics_context_a,
                                     lx::Windower& window_a,
+                                    lx::memory::FrameArena<2u>& frame_arena_a,
+                                    lx::jobs::Scheduler& scheduler_a,
                                     std::string_view cmd_line_a);
 };
 
@@ -0,0 +1,54 @@
+#pragma once
+
+/*
+ *   Name: Handle.hpp
+ *   Copyright (c) Mateusz Semegen and contributors. All rights reserved.
+ */
+
+// std
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+
+namespace lx::common {
+
+/// @brief A generational handle: a slot index packed with the slot generation, which the owner bumps whenever the slot is
+/// freed, so handles of freed slots are detected instead of aliasing a new occupant. All bits set is the null handle.
+/// @tparam Value std::uint32_t (20 bit index, 12 bit generation) or std::uint64_t (32/32 bit).
+/// @tparam Owner makes the handles of different owners distinct types, it is not used otherwise.
+template<typename Value, typename Owner> struct Handle
+{
+    static_assert(std::same_as<Value, std::uint32_t> || std::same_as<Value, std::uint64_t>);
+
+    constexpr static std::size_t index_bits = sizeof(Value) == sizeof(std::uint32_t) ? 20u : 32u;
+    constexpr static Value index_mask = (static_cast<Value>(1u) << index_bits) - 1u;
+    constexpr static Value generation_mask = std::numeric_limits<Value>::max() >> index_bits;
+
+    Value value = std::numeric_limits<Value>::max();
+
+    constexpr std::size_t get_index() const
+    {
+        return static_cast<std::size_t>(this->value & index_mask);
+    }
+    constexpr Value get_generation() const
+    {
+        return this->value >> index_bits;
+    }
+    constexpr bool is_null() const
+    {
+        return std::numeric_limits<Value>::max() == this->value;
+    }
+
+    constexpr bool operator==(const Handle&) const = default;
+};
+} // namespace lx::common
+
+template<typename Value, typename Owner> struct std::hash<lx::common::Handle<Value, Owner>>
+{
+    std::size_t operator()(lx::common::Handle<Value, Owner> handle_a) const
+    {
+        return static_cast<std::size_t>(handle_a.value);
+    }
+};
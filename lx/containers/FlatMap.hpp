@@ -0,0 +1,728 @@
+#pragma once
+
+/*
+ *   Name: FlatMap.hpp
+ *   Copyright (c) Mateusz Semegen and contributors. All rights reserved.
+ */
+
+// lx
+#include <lx/containers/String.hpp>
+#include <lx/containers/StringId.hpp>
+#include <lx/containers/Vector.hpp>
+
+// std
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+// intrinsics
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+#include <emmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#endif
+
+namespace lx::containers {
+
+/// @brief Hash of the FlatMap keys: std::hash, except for the string keys and StringId, which hash a std::string_view the same
+/// way as the key made of it and so can be looked up by one without building a key.
+template<typename Key> struct Hash : std::hash<Key>
+{
+};
+/// @brief Equality of the FlatMap keys, transparent for the same keys as Hash.
+template<typename Key> struct Equal : std::equal_to<Key>
+{
+};
+
+struct String_hash
+{
+    using is_transparent = void;
+
+    std::size_t operator()(std::string_view string_a) const
+    {
+        return std::hash<std::string_view> {}(string_a);
+    }
+};
+struct String_equal
+{
+    using is_transparent = void;
+
+    bool operator()(std::string_view left_a, std::string_view right_a) const
+    {
+        return left_a == right_a;
+    }
+};
+
+template<typename Allocator> struct Hash<std::basic_string<char, std::char_traits<char>, Allocator>> : String_hash
+{
+};
+template<std::size_t capacity, typename Allocator> struct Hash<String<char, capacity, Allocator>> : String_hash
+{
+};
+template<typename Allocator> struct Equal<std::basic_string<char, std::char_traits<char>, Allocator>> : String_equal
+{
+};
+template<std::size_t capacity, typename Allocator> struct Equal<String<char, capacity, Allocator>> : String_equal
+{
+};
+
+template<> struct Hash<StringId>
+{
+    using is_transparent = void;
+
+    std::size_t operator()(StringId id_a) const
+    {
+        return static_cast<std::size_t>(id_a.get_hash());
+    }
+    /// @brief Hashes the name without interning it.
+    std::size_t operator()(std::string_view name_a) const
+    {
+        return static_cast<std::size_t>(StringId::get_hash(name_a));
+    }
+};
+template<> struct Equal<StringId>
+{
+    using is_transparent = void;
+
+    bool operator()(StringId left_a, StringId right_a) const
+    {
+        return left_a == right_a;
+    }
+    bool operator()(StringId id_a, std::string_view name_a) const
+    {
+        return id_a.get_hash() == StringId::get_hash(name_a);
+    }
+};
+
+/// @brief Hash map with open addressing in the layout of a Swiss table: the entries sit in one array next to an array of
+/// one control byte per slot, empty, deleted or 7 bits of the hash of the key. A lookup compares the control bytes of 16 slots
+/// at once (SSE2 or NEON) and touches an entry only when those bits match, so a miss rarely reads a key and no lookup chases
+/// pointers. Up to 7/8 of the slots are used before the table doubles.
+/// Adding and erasing invalidate pointers to the values and the iterators.
+/// @tparam Hasher hashing Key, when it and Equality are transparent any type they take can be looked up.
+/// @tparam Allocator of any type, rebound to the entries and the control bytes.
+template<typename Key,
+         typename Value,
+         typename Hasher = Hash<Key>,
+         typename Equality = Equal<Key>,
+         typename Allocator = std::allocator<std::byte>>
+class FlatMap
+{
+    template<typename Lookup>
+    constexpr static bool is_transparent =
+        requires { typename Hasher::is_transparent; typename Equality::is_transparent; } || std::same_as<Lookup, Key>;
+
+public:
+    struct Entry
+    {
+        template<typename Key_argument, typename... Arg>
+            requires std::constructible_from<Key, Key_argument>
+        Entry(Key_argument&& key_a, Arg&&... args_a)
+            : key(std::forward<Key_argument>(key_a))
+            , value(std::forward<Arg>(args_a)...)
+        {
+        }
+
+        /// @brief Must not be changed while in the map.
+        Key key;
+        Value value;
+    };
+
+    template<typename Type> class Iterator
+    {
+    public:
+        Type& operator*() const
+        {
+            return *this->entry;
+        }
+        Type* operator->() const
+        {
+            return this->entry;
+        }
+
+        Iterator& operator++()
+        {
+            ++this->control;
+            ++this->entry;
+            this->skip_free();
+
+            return *this;
+        }
+
+        bool operator==(const Iterator& other_a) const
+        {
+            return this->entry == other_a.entry;
+        }
+
+    private:
+        Iterator(const std::int8_t* control_a, const std::int8_t* control_end_a, Type* entry_a)
+            : control(control_a)
+            , control_end(control_end_a)
+            , entry(entry_a)
+        {
+            this->skip_free();
+        }
+
+        void skip_free()
+        {
+            while (this->control != this->control_end && *this->control < 0)
+            {
+                ++this->control;
+                ++this->entry;
+            }
+        }
+
+        const std::int8_t* control;
+        const std::int8_t* control_end;
+        Type* entry;
+
+        friend FlatMap;
+    };
+
+    FlatMap() = default;
+    explicit FlatMap(const Allocator& allocator_a)
+        : allocator(allocator_a)
+    {
+    }
+    FlatMap(std::size_t capacity_a, const Allocator& allocator_a = Allocator {})
+        : allocator(allocator_a)
+    {
+        this->reserve(capacity_a);
+    }
+    FlatMap(const FlatMap<Key, Value, Hasher, Equality, Allocator>& other_a)
+        : allocator(std::allocator_traits<Allocator>::select_on_container_copy_construction(other_a.allocator))
+    {
+        this->copy(other_a);
+    }
+    FlatMap(FlatMap<Key, Value, Hasher, Equality, Allocator>&& other_a) noexcept
+        : allocator(std::move(other_a.allocator))
+    {
+        this->steal(std::move(other_a));
+    }
+    ~FlatMap()
+    {
+        this->destroy_entries();
+        this->release();
+    }
+
+    /// @brief Adds the key with a value made of args_a, unless the key is in the map already. Returns true when it was added.
+    template<typename Key_argument, typename... Arg> bool try_emplace(Key_argument&& key_a, Arg&&... args_a)
+    {
+        return this->emplace(std::forward<Key_argument>(key_a), std::forward<Arg>(args_a)...).second;
+    }
+    /// @brief Value of the key, added value initialized when missing.
+    template<typename Key_argument> Value& operator[](Key_argument&& key_a)
+    {
+        // the index first, emplace may move the entries
+        const std::size_t index = this->emplace(std::forward<Key_argument>(key_a)).first;
+        return this->entries[index].value;
+    }
+
+    Value* find(const Key& key_a)
+    {
+        return this->find<Key>(key_a);
+    }
+    const Value* find(const Key& key_a) const
+    {
+        return this->find<Key>(key_a);
+    }
+    template<typename Lookup>
+        requires is_transparent<Lookup>
+    Value* find(const Lookup& key_a)
+    {
+        const std::size_t index = this->find_index(key_a, mix(this->hasher(key_a)));
+        return index != this->capacity ? &this->entries[index].value : nullptr;
+    }
+    template<typename Lookup>
+        requires is_transparent<Lookup>
+    const Value* find(const Lookup& key_a) const
+    {
+        const std::size_t index = this->find_index(key_a, mix(this->hasher(key_a)));
+        return index != this->capacity ? &this->entries[index].value : nullptr;
+    }
+
+    bool contains(const Key& key_a) const
+    {
+        return nullptr != this->find(key_a);
+    }
+    template<typename Lookup>
+        requires is_transparent<Lookup>
+    bool contains(const Lookup& key_a) const
+    {
+        return nullptr != this->find(key_a);
+    }
+
+    bool erase(const Key& key_a)
+    {
+        return this->erase<Key>(key_a);
+    }
+    template<typename Lookup>
+        requires is_transparent<Lookup>
+    bool erase(const Lookup& key_a)
+    {
+        const std::size_t index = this->find_index(key_a, mix(this->hasher(key_a)));
+
+        if (index == this->capacity)
+        {
+            return false;
+        }
+
+        // a tombstone keeps the probe sequences that pass through the slot intact, the next rehash drops it
+        std::destroy_at(this->entries + index);
+        this->set_control(index, deleted);
+        this->length--;
+
+        return true;
+    }
+
+    /// @brief Makes room for count_a entries without growing again.
+    void reserve(std::size_t count_a)
+    {
+        const std::size_t capacity = get_capacity_for(count_a);
+
+        if (capacity > this->capacity)
+        {
+            this->rehash(capacity);
+        }
+    }
+    /// @brief Removes every entry, the capacity stays.
+    void clear()
+    {
+        this->destroy_entries();
+
+        if (0u != this->capacity)
+        {
+            std::memset(this->control, empty, this->capacity + Group::width - 1u);
+        }
+
+        this->length = 0u;
+        this->growth_left = get_max_length(this->capacity);
+    }
+
+    std::size_t get_length() const
+    {
+        return this->length;
+    }
+    std::size_t get_capacity() const
+    {
+        return this->capacity;
+    }
+    bool is_empty() const
+    {
+        return 0u == this->length;
+    }
+
+    Iterator<Entry> begin()
+    {
+        return { this->control, this->control + this->capacity, this->entries };
+    }
+    Iterator<Entry> end()
+    {
+        return { this->control + this->capacity, this->control + this->capacity, this->entries + this->capacity };
+    }
+    Iterator<const Entry> begin() const
+    {
+        return { this->control, this->control + this->capacity, this->entries };
+    }
+    Iterator<const Entry> end() const
+    {
+        return { this->control + this->capacity, this->control + this->capacity, this->entries + this->capacity };
+    }
+
+    FlatMap<Key, Value, Hasher, Equality, Allocator>& operator=(const FlatMap<Key, Value, Hasher, Equality, Allocator>& other_a)
+    {
+        if (this != &other_a)
+        {
+            this->destroy_entries();
+            this->release();
+
+            if constexpr (true == std::allocator_traits<Allocator>::propagate_on_container_copy_assignment::value)
+            {
+                this->allocator = other_a.allocator;
+            }
+
+            this->copy(other_a);
+        }
+
+        return *this;
+    }
+    FlatMap<Key, Value, Hasher, Equality, Allocator>& operator=(FlatMap<Key, Value, Hasher, Equality, Allocator>&& other_a) noexcept(
+        std::allocator_traits<Allocator>::propagate_on_container_move_assignment::value ||
+        std::allocator_traits<Allocator>::is_always_equal::value)
+    {
+        if constexpr (false == std::allocator_traits<Allocator>::propagate_on_container_move_assignment::value &&
+                      false == std::allocator_traits<Allocator>::is_always_equal::value)
+        {
+            if (this->allocator != other_a.allocator)
+            {
+                // storage of other_a cannot be freed by our allocator, move the entries one by one
+                this->clear();
+                this->reserve(other_a.length);
+
+                for (Entry& entry : other_a)
+                {
+                    this->try_emplace(std::move(entry.key), std::move(entry.value));
+                }
+
+                other_a.clear();
+
+                return *this;
+            }
+        }
+
+        if (this != &other_a)
+        {
+            this->destroy_entries();
+            this->release();
+
+            if constexpr (true == std::allocator_traits<Allocator>::propagate_on_container_move_assignment::value)
+            {
+                this->allocator = std::move(other_a.allocator);
+            }
+
+            this->steal(std::move(other_a));
+        }
+
+        return *this;
+    }
+
+    const Allocator& get_allocator() const
+    {
+        return this->allocator;
+    }
+
+private:
+    using Entry_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Entry>;
+    using Control_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<std::int8_t>;
+
+    // control bytes: full slots hold the 7 low bits of the hash, the free ones have the sign bit set
+    constexpr static std::int8_t empty = -128;
+    constexpr static std::int8_t deleted = -2;
+
+    /// @brief Control bytes of 16 consecutive slots, matched with one compare. Bit i of a mask stands for slot i.
+    struct Group
+    {
+        constexpr static std::size_t width = 16u;
+
+        explicit Group(const std::int8_t* control_a)
+        {
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+            this->control = _mm_loadu_si128(reinterpret_cast<const __m128i*>(control_a));
+#elif defined(__aarch64__) || defined(_M_ARM64)
+            this->control = vld1q_s8(control_a);
+#else
+            std::memcpy(this->control, control_a, width);
+#endif
+        }
+
+        std::uint32_t match(std::int8_t h2_a) const
+        {
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+            return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(this->control, _mm_set1_epi8(h2_a))));
+#elif defined(__aarch64__) || defined(_M_ARM64)
+            return get_mask(vceqq_s8(this->control, vdupq_n_s8(h2_a)));
+#else
+            std::uint32_t mask = 0u;
+
+            for (std::size_t i = 0u; i < width; i++)
+            {
+                mask |= h2_a == this->control[i] ? 1u << i : 0u;
+            }
+
+            return mask;
+#endif
+        }
+        std::uint32_t match_empty() const
+        {
+            return this->match(empty);
+        }
+        /// @brief Empty or deleted slots, the ones with the sign bit.
+        std::uint32_t match_free() const
+        {
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+            return static_cast<std::uint32_t>(_mm_movemask_epi8(this->control));
+#elif defined(__aarch64__) || defined(_M_ARM64)
+            return get_mask(vcltzq_s8(this->control));
+#else
+            std::uint32_t mask = 0u;
+
+            for (std::size_t i = 0u; i < width; i++)
+            {
+                mask |= this->control[i] < 0 ? 1u << i : 0u;
+            }
+
+            return mask;
+#endif
+        }
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+        __m128i control;
+#elif defined(__aarch64__) || defined(_M_ARM64)
+        // NEON has no movemask: weight each lane by its bit and add up the halves
+        static std::uint32_t get_mask(uint8x16_t matches_a)
+        {
+            constexpr std::uint8_t weights[16] = { 1u, 2u, 4u, 8u, 16u, 32u, 64u, 128u, 1u, 2u, 4u, 8u, 16u, 32u, 64u, 128u };
+            const uint8x16_t weighted = vandq_u8(matches_a, vld1q_u8(weights));
+
+            return static_cast<std::uint32_t>(vaddv_u8(vget_low_u8(weighted))) |
+                   (static_cast<std::uint32_t>(vaddv_u8(vget_high_u8(weighted))) << 8u);
+        }
+
+        int8x16_t control;
+#else
+        std::int8_t control[width];
+#endif
+    };
+
+    /// @brief std::hash of integers is the identity on the common standard libraries, spread every bit over the high ones.
+    static std::uint64_t mix(std::size_t hash_a)
+    {
+        const std::uint64_t hash = static_cast<std::uint64_t>(hash_a) * 0x9E3779B97F4A7C15u;
+        return hash ^ (hash >> 32u);
+    }
+    static std::int8_t get_h2(std::uint64_t hash_a)
+    {
+        return static_cast<std::int8_t>(hash_a & 0x7Fu);
+    }
+
+    static std::size_t get_max_length(std::size_t capacity_a)
+    {
+        return capacity_a - capacity_a / 8u;
+    }
+    static std::size_t get_capacity_for(std::size_t count_a)
+    {
+        return 0u != count_a ? std::max(Group::width, std::bit_ceil(count_a + (count_a + 6u) / 7u)) : 0u;
+    }
+
+    template<typename Lookup> std::size_t find_index(const Lookup& key_a, std::uint64_t hash_a) const
+    {
+        if (0u == this->capacity)
+        {
+            return 0u;
+        }
+
+        const std::size_t mask = this->capacity - 1u;
+        const std::int8_t h2 = get_h2(hash_a);
+
+        // quadratic over the groups, which visits every group of a power of two table
+        std::size_t position = static_cast<std::size_t>(hash_a >> 7u) & mask;
+
+        for (std::size_t step = Group::width;; step += Group::width)
+        {
+            const Group group(this->control + position);
+
+            for (std::uint32_t matches = group.match(h2); 0u != matches; matches &= matches - 1u)
+            {
+                const std::size_t index = (position + static_cast<std::size_t>(std::countr_zero(matches))) & mask;
+
+                if (true == this->equality(this->entries[index].key, key_a))
+                {
+                    return index;
+                }
+            }
+
+            if (0u != group.match_empty())
+            {
+                return this->capacity;
+            }
+
+            position = (position + step) & mask;
+        }
+    }
+    std::size_t find_free(std::uint64_t hash_a) const
+    {
+        const std::size_t mask = this->capacity - 1u;
+        std::size_t position = static_cast<std::size_t>(hash_a >> 7u) & mask;
+
+        for (std::size_t step = Group::width;; step += Group::width)
+        {
+            const std::uint32_t free = Group(this->control + position).match_free();
+
+            if (0u != free)
+            {
+                return (position + static_cast<std::size_t>(std::countr_zero(free))) & mask;
+            }
+
+            position = (position + step) & mask;
+        }
+    }
+
+    template<typename Key_argument, typename... Arg> std::pair<std::size_t, bool> emplace(Key_argument&& key_a, Arg&&... args_a)
+    {
+        const std::uint64_t hash = mix(this->hasher(key_a));
+        const std::size_t found = this->find_index(key_a, hash);
+
+        if (found != this->capacity)
+        {
+            return { found, false };
+        }
+
+        std::size_t index = 0u == this->capacity ? 0u : this->find_free(hash);
+
+        if (0u == this->capacity || (empty == this->control[index] && 0u == this->growth_left))
+        {
+            // mostly tombstones: the same capacity drops them, otherwise double
+            const bool is_crowded = this->length >= get_max_length(this->capacity) / 2u;
+            this->rehash(0u == this->capacity ? Group::width : (true == is_crowded ? this->capacity * 2u : this->capacity));
+
+            index = this->find_free(hash);
+        }
+
+        std::construct_at(this->entries + index, std::forward<Key_argument>(key_a), std::forward<Arg>(args_a)...);
+
+        this->growth_left -= empty == this->control[index] ? 1u : 0u;
+        this->set_control(index, get_h2(hash));
+        this->length++;
+
+        return { index, true };
+    }
+
+    void set_control(std::size_t index_a, std::int8_t control_a)
+    {
+        // the first 15 bytes are mirrored past the end, so a group read near the end wraps around
+        this->control[index_a] = control_a;
+
+        if (index_a < Group::width - 1u)
+        {
+            this->control[this->capacity + index_a] = control_a;
+        }
+    }
+
+    void allocate(std::size_t capacity_a)
+    {
+        Entry_allocator entry_allocator(this->allocator);
+        Control_allocator control_allocator(this->allocator);
+
+        this->entries = std::allocator_traits<Entry_allocator>::allocate(entry_allocator, capacity_a);
+        this->control = std::allocator_traits<Control_allocator>::allocate(control_allocator, capacity_a + Group::width - 1u);
+        this->capacity = capacity_a;
+        this->growth_left = get_max_length(capacity_a);
+
+        std::memset(this->control, empty, capacity_a + Group::width - 1u);
+    }
+    void release()
+    {
+        if (0u != this->capacity)
+        {
+            Entry_allocator entry_allocator(this->allocator);
+            Control_allocator control_allocator(this->allocator);
+
+            std::allocator_traits<Entry_allocator>::deallocate(entry_allocator, this->entries, this->capacity);
+            std::allocator_traits<Control_allocator>::deallocate(control_allocator, this->control, this->capacity + Group::width - 1u);
+        }
+
+        this->entries = nullptr;
+        this->control = nullptr;
+        this->capacity = 0u;
+        this->length = 0u;
+        this->growth_left = 0u;
+    }
+    void destroy_entries()
+    {
+        if constexpr (false == std::is_trivially_destructible_v<Entry>)
+        {
+            for (std::size_t i = 0u; i < this->capacity; i++)
+            {
+                if (this->control[i] >= 0)
+                {
+                    std::destroy_at(this->entries + i);
+                }
+            }
+        }
+    }
+    void rehash(std::size_t capacity_a)
+    {
+        Entry* old_entries = this->entries;
+        std::int8_t* old_control = this->control;
+        const std::size_t old_capacity = this->capacity;
+        const std::size_t length = this->length;
+
+        this->allocate(capacity_a);
+
+        for (std::size_t i = 0u; i < old_capacity; i++)
+        {
+            if (old_control[i] >= 0)
+            {
+                const std::uint64_t hash = mix(this->hasher(old_entries[i].key));
+                const std::size_t index = this->find_free(hash);
+
+                relocate(old_entries + i, this->entries + index);
+                this->set_control(index, get_h2(hash));
+            }
+        }
+
+        this->length = length;
+        this->growth_left -= length;
+
+        if (0u != old_capacity)
+        {
+            Entry_allocator entry_allocator(this->allocator);
+            Control_allocator control_allocator(this->allocator);
+
+            std::allocator_traits<Entry_allocator>::deallocate(entry_allocator, old_entries, old_capacity);
+            std::allocator_traits<Control_allocator>::deallocate(control_allocator, old_control, old_capacity + Group::width - 1u);
+        }
+    }
+    static void relocate(Entry* source_a, Entry* destination_a)
+    {
+        if constexpr (true == is_trivially_relocatable_v<Entry>)
+        {
+            std::memcpy(static_cast<void*>(destination_a), static_cast<const void*>(source_a), sizeof(Entry));
+        }
+        else
+        {
+            std::construct_at(destination_a, std::move(*source_a));
+            std::destroy_at(source_a);
+        }
+    }
+
+    void copy(const FlatMap<Key, Value, Hasher, Equality, Allocator>& other_a)
+    {
+        if (0u != other_a.capacity)
+        {
+            this->allocate(other_a.capacity);
+
+            for (std::size_t i = 0u; i < other_a.capacity; i++)
+            {
+                if (other_a.control[i] >= 0)
+                {
+                    std::construct_at(this->entries + i, std::as_const(other_a.entries[i]));
+                }
+            }
+
+            std::memcpy(this->control, other_a.control, other_a.capacity + Group::width - 1u);
+
+            this->length = other_a.length;
+            this->growth_left = other_a.growth_left;
+        }
+    }
+    void steal(FlatMap<Key, Value, Hasher, Equality, Allocator>&& other_a)
+    {
+        this->entries = std::exchange(other_a.entries, nullptr);
+        this->control = std::exchange(other_a.control, nullptr);
+        this->capacity = std::exchange(other_a.capacity, 0u);
+        this->length = std::exchange(other_a.length, 0u);
+        this->growth_left = std::exchange(other_a.growth_left, 0u);
+    }
+
+    [[no_unique_address]] Allocator allocator;
+    [[no_unique_address]] Hasher hasher;
+    [[no_unique_address]] Equality equality;
+
+    Entry* entries = nullptr;
+    std::int8_t* control = nullptr;
+
+    std::size_t capacity = 0u;
+    std::size_t length = 0u;
+    std::size_t growth_left = 0u;
+};
+} // namespace lx::containers
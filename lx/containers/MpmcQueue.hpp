@@ -0,0 +1,214 @@
+#pragma once
+
+/*
+ *   Name: MpmcQueue.hpp
+ *   Copyright (c) Mateusz Semegen and contributors. All rights reserved.
+ */
+
+// lx
+#include <lx/common/non_copyable.hpp>
+#include <lx/common/out.hpp>
+
+// std
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <span>
+#include <utility>
+
+namespace lx::containers {
+
+/// @brief A bounded lock-free queue with many producers and many consumers, sized at construction.
+/// As in MpscRing every cell carries a sequence number telling whether it is free for the producer of the current lap or
+/// holds a value for the consumer of it, so each side contends only on a compare-exchange of its position. The batch
+/// overloads claim a run of consecutive cells with a single compare-exchange.
+/// @tparam Type of the elements.
+/// @tparam Allocator of Type, rebound for the cells.
+template<typename Type, typename Allocator = std::allocator<Type>> class MpmcQueue : private lx::common::non_copyable
+{
+public:
+    /// @param capacity_a number of cells, must be a power of two.
+    explicit MpmcQueue(std::size_t capacity_a, const Allocator& allocator_a = Allocator {})
+        : allocator(allocator_a)
+        , mask(capacity_a - 1u)
+        , cells(Allocator_traits::allocate(this->allocator, capacity_a))
+    {
+        assert(capacity_a > 1u && 0u == (capacity_a & (capacity_a - 1u)));
+
+        for (std::size_t i = 0u; i < capacity_a; i++)
+        {
+            std::construct_at(&this->cells[i].sequence, i);
+        }
+    }
+    ~MpmcQueue()
+    {
+        std::size_t position = this->read_position.load(std::memory_order_relaxed);
+
+        for (Cell* cell = &this->cells[position & this->mask]; cell->sequence.load(std::memory_order_acquire) == position + 1u;
+             cell = &this->cells[position & this->mask])
+        {
+            std::destroy_at(cell->get());
+            position++;
+        }
+
+        for (std::size_t i = 0u; i <= this->mask; i++)
+        {
+            std::destroy_at(&this->cells[i].sequence);
+        }
+
+        Allocator_traits::deallocate(this->allocator, this->cells, this->mask + 1u);
+    }
+
+    /// @brief Constructs a value in the next free cell. Returns false when the queue is full. Safe to call from any thread.
+    template<typename... Arg> bool try_emplace(Arg&&... args_a)
+    {
+        std::size_t position = 0u;
+
+        if (0u == this->claim(&this->write_position, 0u, 1u, &position))
+        {
+            return false;
+        }
+
+        Cell& cell = this->cells[position & this->mask];
+
+        std::construct_at(cell.get(), std::forward<Arg>(args_a)...);
+        cell.sequence.store(position + 1u, std::memory_order_release);
+
+        return true;
+    }
+    bool try_push(const Type& value_a)
+    {
+        return this->try_emplace(value_a);
+    }
+    bool try_push(Type&& value_a)
+    {
+        return this->try_emplace(std::move(value_a));
+    }
+    /// @brief Copies as many of values_a as there are free consecutive cells. Returns how many were pushed, values pushed by one
+    /// call are popped in order and without values of other producers between them.
+    std::size_t try_push(std::span<const Type> values_a)
+    {
+        std::size_t position = 0u;
+        const std::size_t count = this->claim(&this->write_position, 0u, values_a.size(), &position);
+
+        for (std::size_t i = 0u; i < count; i++)
+        {
+            Cell& cell = this->cells[(position + i) & this->mask];
+
+            std::construct_at(cell.get(), values_a[i]);
+            cell.sequence.store(position + i + 1u, std::memory_order_release);
+        }
+
+        return count;
+    }
+
+    /// @brief Moves the oldest value out. Returns false when the queue is empty. Safe to call from any thread.
+    bool try_pop(lx::common::out<Type> value_a)
+    {
+        return 1u == this->try_pop(std::span<Type> { &(*value_a), 1u });
+    }
+    /// @brief Moves up to values_a.size() oldest values out. Returns how many were popped.
+    std::size_t try_pop(std::span<Type> values_a)
+    {
+        std::size_t position = 0u;
+        const std::size_t count = this->claim(&this->read_position, 1u, values_a.size(), &position);
+
+        for (std::size_t i = 0u; i < count; i++)
+        {
+            Cell& cell = this->cells[(position + i) & this->mask];
+
+            values_a[i] = std::move(*cell.get());
+            std::destroy_at(cell.get());
+
+            cell.sequence.store(position + i + this->mask + 1u, std::memory_order_release);
+        }
+
+        return count;
+    }
+
+    /// @brief Approximate number of elements, exact only when no other thread is running.
+    std::size_t get_length() const
+    {
+        const std::size_t read = this->read_position.load(std::memory_order_relaxed);
+        const std::size_t write = this->write_position.load(std::memory_order_relaxed);
+
+        return write > read ? write - read : 0u;
+    }
+    std::size_t get_capacity() const
+    {
+        return this->mask + 1u;
+    }
+    bool is_empty() const
+    {
+        return 0u == this->get_length();
+    }
+
+private:
+    struct Cell
+    {
+        Type* get()
+        {
+            return std::launder(reinterpret_cast<Type*>(this->storage));
+        }
+
+        std::atomic<std::size_t> sequence;
+        alignas(Type) std::byte storage[sizeof(Type)];
+    };
+
+    using Allocator_traits = typename std::allocator_traits<Allocator>::template rebind_traits<Cell>;
+    using Cell_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Cell>;
+
+    constexpr static std::size_t cache_line_size = 64u;
+
+    // Claims up to count_a consecutive cells whose sequence is the position plus offset_a: 0 marks a cell free for a producer,
+    // 1 a cell holding a value for a consumer. Once the position moves past them no other thread can touch those cells.
+    std::size_t claim(std::atomic<std::size_t>* position_a, std::size_t offset_a, std::size_t count_a, std::size_t* claimed_a)
+    {
+        std::size_t position = position_a->load(std::memory_order_relaxed);
+
+        while (0u != count_a)
+        {
+            std::size_t count = 0u;
+
+            while (count < count_a && count <= this->mask &&
+                   this->cells[(position + count) & this->mask].sequence.load(std::memory_order_acquire) == position + count + offset_a)
+            {
+                count++;
+            }
+
+            if (0u != count)
+            {
+                if (true == position_a->compare_exchange_weak(position, position + count, std::memory_order_relaxed))
+                {
+                    *claimed_a = position;
+                    return count;
+                }
+            }
+            else
+            {
+                const std::size_t sequence = this->cells[position & this->mask].sequence.load(std::memory_order_acquire);
+
+                if (sequence < position + offset_a)
+                {
+                    // the cell is still taken by the other side from the previous lap
+                    return 0u;
+                }
+
+                position = position_a->load(std::memory_order_relaxed);
+            }
+        }
+
+        return 0u;
+    }
+
+    [[no_unique_address]] Cell_allocator allocator;
+
+    const std::size_t mask;
+    Cell* const cells;
+
+    alignas(cache_line_size) std::atomic<std::size_t> write_position = 0u;
+    alignas(cache_line_size) std::atomic<std::size_t> read_position = 0u;
+};
+} // namespace lx::containers
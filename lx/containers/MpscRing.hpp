@@ -0,0 +1,145 @@
+#pragma once
+
+/*
+ *   Name: MpscRing.hpp
+ *   Copyright (c) Mateusz Semegen and contributors. All rights reserved.
+ */
+
+// lx
+#include <lx/common/non_copyable.hpp>
+#include <lx/common/out.hpp>
+
+// std
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace lx::containers {
+
+/// @brief A bounded lock-free ring with many producers and a single consumer.
+/// Every cell carries a sequence number telling whether it is free for the producer of the current lap or holds a value for
+/// the consumer, so producers only contend on a single compare-exchange of the write position.
+/// @tparam Type of the elements.
+/// @tparam capacity number of cells, must be a power of two.
+template<typename Type, std::size_t capacity> class MpscRing : private lx::common::non_copyable
+{
+    static_assert(capacity > 1u && 0u == (capacity & (capacity - 1u)));
+
+public:
+    MpscRing()
+    {
+        for (std::size_t i = 0u; i < capacity; i++)
+        {
+            this->cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+    ~MpscRing()
+    {
+        std::size_t position = this->read_position.load(std::memory_order_relaxed);
+
+        for (Cell* cell = &this->cells[position & (capacity - 1u)]; cell->sequence.load(std::memory_order_acquire) == position + 1u;
+             cell = &this->cells[position & (capacity - 1u)])
+        {
+            std::destroy_at(cell->get());
+            position++;
+        }
+    }
+
+    /// @brief Constructs a value in the next free cell. Returns false when the ring is full. Safe to call from any thread.
+    template<typename... Arg> bool try_emplace(Arg&&... args_a)
+    {
+        std::size_t position = this->write_position.load(std::memory_order_relaxed);
+
+        while (true)
+        {
+            Cell& cell = this->cells[position & (capacity - 1u)];
+            const std::size_t sequence = cell.sequence.load(std::memory_order_acquire);
+
+            if (sequence == position)
+            {
+                if (true == this->write_position.compare_exchange_weak(position, position + 1u, std::memory_order_relaxed))
+                {
+                    std::construct_at(cell.get(), std::forward<Arg>(args_a)...);
+                    cell.sequence.store(position + 1u, std::memory_order_release);
+
+                    return true;
+                }
+            }
+            else if (sequence < position)
+            {
+                // the cell still holds a value from the previous lap
+                return false;
+            }
+            else
+            {
+                position = this->write_position.load(std::memory_order_relaxed);
+            }
+        }
+    }
+    bool try_push(const Type& value_a)
+    {
+        return this->try_emplace(value_a);
+    }
+    bool try_push(Type&& value_a)
+    {
+        return this->try_emplace(std::move(value_a));
+    }
+
+    /// @brief Moves the oldest value out. Returns false when the ring is empty. Only one thread may call it at a time.
+    bool try_pop(lx::common::out<Type> value_a)
+    {
+        const std::size_t position = this->read_position.load(std::memory_order_relaxed);
+        Cell& cell = this->cells[position & (capacity - 1u)];
+
+        if (cell.sequence.load(std::memory_order_acquire) != position + 1u)
+        {
+            return false;
+        }
+
+        (*value_a) = std::move(*cell.get());
+        std::destroy_at(cell.get());
+
+        cell.sequence.store(position + capacity, std::memory_order_release);
+        this->read_position.store(position + 1u, std::memory_order_relaxed);
+
+        return true;
+    }
+
+    /// @brief Approximate number of elements, exact only when no producer is running.
+    std::size_t get_length() const
+    {
+        const std::size_t read = this->read_position.load(std::memory_order_relaxed);
+        const std::size_t write = this->write_position.load(std::memory_order_relaxed);
+
+        return write > read ? write - read : 0u;
+    }
+    constexpr std::size_t get_capacity() const
+    {
+        return capacity;
+    }
+    bool is_empty() const
+    {
+        return 0u == this->get_length();
+    }
+
+private:
+    struct Cell
+    {
+        Type* get()
+        {
+            return std::launder(reinterpret_cast<Type*>(this->storage));
+        }
+
+        std::atomic<std::size_t> sequence;
+        alignas(Type) std::byte storage[sizeof(Type)];
+    };
+
+    constexpr static std::size_t cache_line_size = 64u;
+
+    alignas(cache_line_size) std::atomic<std::size_t> write_position = 0u;
+    alignas(cache_line_size) std::atomic<std::size_t> read_position = 0u;
+    alignas(cache_line_size) Cell cells[capacity];
+};
+} // namespace lx::containers
@@ -0,0 +1,222 @@
+#pragma once
+
+/*
+ *   Name: SlotMap.hpp
+ *   Copyright (c) Mateusz Semegen and contributors. All rights reserved.
+ */
+
+// lx
+#include <lx/common/Handle.hpp>
+#include <lx/containers/Vector.hpp>
+
+// std
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <span>
+#include <utility>
+
+namespace lx::containers {
+
+/// @brief Values addressed by generational handles with O(1) insert, erase and lookup, the growable counterpart of
+/// memory::Pool. The values are packed in a dense array, erase moves the last one into the gap, so iteration is a linear walk
+/// over memory. A handle is a slot index and the slot generation, bumped on every erase: stale handles are detected instead
+/// of aliasing a new value.
+/// Inserting and erasing invalidate pointers to the values, the handles stay valid.
+/// @tparam Type of the values.
+/// @tparam Value underlying handle type, std::uint32_t (20 bit index, 12 bit generation) or std::uint64_t (32/32 bit).
+/// @tparam Allocator of Type, rebound for the slots.
+template<typename Type, typename Value = std::uint32_t, typename Allocator = std::allocator<Type>> class SlotMap
+{
+    static_assert(std::same_as<Value, std::uint32_t> || std::same_as<Value, std::uint64_t>);
+
+public:
+    using Handle = lx::common::Handle<Value, SlotMap>;
+
+    SlotMap() = default;
+    explicit SlotMap(const Allocator& allocator_a)
+        : slots(Slot_allocator(allocator_a))
+        , slot_indices(Value_allocator(allocator_a))
+        , values(allocator_a)
+    {
+    }
+    SlotMap(const SlotMap<Type, Value, Allocator>&) = default;
+    SlotMap(SlotMap<Type, Value, Allocator>&& other_a) noexcept
+        : slots(std::move(other_a.slots))
+        , slot_indices(std::move(other_a.slot_indices))
+        , values(std::move(other_a.values))
+        , free_head(std::exchange(other_a.free_head, npos))
+    {
+    }
+
+    /// @brief Constructs a new value, returns its handle.
+    template<typename... Arg> Handle emplace(Arg&&... args_a)
+    {
+        Value index = this->free_head;
+
+        if (npos == index)
+        {
+            assert(this->slots.get_length() < Handle::index_mask);
+
+            index = static_cast<Value>(this->slots.get_length());
+            this->slots.push_back({ .generation = 0u, .next = npos });
+        }
+        else
+        {
+            this->free_head = this->slots[index].next;
+        }
+
+        this->values.emplace_back(std::forward<Arg>(args_a)...);
+        this->slot_indices.push_back(index);
+
+        Slot& slot = this->slots[index];
+        slot.next = static_cast<Value>(this->values.get_length() - 1u);
+
+        return { .value = static_cast<Value>((slot.generation << Handle::index_bits) | index) };
+    }
+    /// @brief Removes the value by moving the last value into its place. Returns false when the handle is stale.
+    bool erase(Handle handle_a)
+    {
+        if (false == this->is_valid(handle_a))
+        {
+            return false;
+        }
+
+        const Value index = static_cast<Value>(handle_a.get_index());
+        Slot& slot = this->slots[index];
+        const Value position = slot.next;
+        const Value last_index = this->slot_indices.get_back();
+
+        if (last_index != index)
+        {
+            this->values[position] = std::move(this->values.get_back());
+            this->slot_indices[position] = last_index;
+            this->slots[last_index].next = position;
+        }
+
+        this->values.pop_back();
+        this->slot_indices.pop_back();
+
+        // a wrapped generation would make the oldest stale handles valid again, such slots are retired instead of reused
+        slot.generation = (slot.generation + 1u) & Handle::generation_mask;
+        slot.next = this->free_head;
+
+        if (Handle::generation_mask != slot.generation)
+        {
+            this->free_head = index;
+        }
+
+        return true;
+    }
+    void clear()
+    {
+        while (false == this->slot_indices.is_empty())
+        {
+            const Value index = this->slot_indices.get_back();
+            this->erase({ .value = static_cast<Value>((this->slots[index].generation << Handle::index_bits) | index) });
+        }
+    }
+
+    bool is_valid(Handle handle_a) const
+    {
+        const std::size_t index = handle_a.get_index();
+
+        if (true == handle_a.is_null() || index >= this->slots.get_length() || this->slots[index].generation != handle_a.get_generation())
+        {
+            return false;
+        }
+
+        const Value position = this->slots[index].next;
+        return position < this->slot_indices.get_length() && index == this->slot_indices[position];
+    }
+
+    /// @brief Returns the value or nullptr when the handle is stale.
+    Type* get(Handle handle_a)
+    {
+        return true == this->is_valid(handle_a) ? &this->values[this->slots[handle_a.get_index()].next] : nullptr;
+    }
+    const Type* get(Handle handle_a) const
+    {
+        return true == this->is_valid(handle_a) ? &this->values[this->slots[handle_a.get_index()].next] : nullptr;
+    }
+    /// @brief Handle of the value at position_a of the dense array.
+    Handle get_handle(std::size_t position_a) const
+    {
+        assert(position_a < this->values.get_length());
+
+        const Value index = this->slot_indices[position_a];
+        return { .value = static_cast<Value>((this->slots[index].generation << Handle::index_bits) | index) };
+    }
+
+    std::span<Type> get_values()
+    {
+        return { this->values.get_buffer(), this->values.get_length() };
+    }
+    std::span<const Type> get_values() const
+    {
+        return this->values;
+    }
+
+    std::size_t get_length() const
+    {
+        return this->values.get_length();
+    }
+    bool is_empty() const
+    {
+        return this->values.is_empty();
+    }
+
+    Type* begin()
+    {
+        return this->values.get_buffer();
+    }
+    Type* end()
+    {
+        return this->values.get_buffer() + this->values.get_length();
+    }
+    const Type* begin() const
+    {
+        return this->values.get_buffer();
+    }
+    const Type* end() const
+    {
+        return this->values.get_buffer() + this->values.get_length();
+    }
+
+    SlotMap<Type, Value, Allocator>& operator=(const SlotMap<Type, Value, Allocator>&) = default;
+    SlotMap<Type, Value, Allocator>& operator=(SlotMap<Type, Value, Allocator>&& other_a) noexcept
+    {
+        if (this != &other_a)
+        {
+            this->slots = std::move(other_a.slots);
+            this->slot_indices = std::move(other_a.slot_indices);
+            this->values = std::move(other_a.values);
+            this->free_head = std::exchange(other_a.free_head, npos);
+        }
+
+        return *this;
+    }
+
+private:
+    constexpr static Value npos = std::numeric_limits<Value>::max();
+
+    // next is the dense position of a live slot and the next free slot of a free one
+    struct Slot
+    {
+        Value generation;
+        Value next;
+    };
+
+    using Slot_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Slot>;
+    using Value_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Value>;
+
+    Vector<Slot, 0u, Slot_allocator> slots;
+    Vector<Value, 0u, Value_allocator> slot_indices;
+    Vector<Type, 0u, Allocator> values;
+
+    Value free_head = npos;
+};
+} // namespace lx::containers
@@ -0,0 +1,394 @@
+#pragma once
+
+// lx
+#include <lx/containers/Vector.hpp>
+
+// std
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <memory>
+#include <span>
+#include <utility>
+
+namespace lx::containers {
+
+/// @brief A vector that keeps up to inline_capacity elements inside the object and moves them to the heap only when it grows past that.
+/// @tparam Type of the elements.
+/// @tparam inline_capacity number of elements stored without a heap allocation.
+/// @tparam Allocator used once the elements no longer fit inline.
+template<typename Type, std::size_t inline_capacity, typename Allocator = std::allocator<Type>> class SmallVector
+{
+    static_assert(inline_capacity > 0u);
+
+    using Allocator_traits = std::allocator_traits<Allocator>;
+
+public:
+    SmallVector() = default;
+    SmallVector(const SmallVector<Type, inline_capacity, Allocator>& other_a)
+        : SmallVector(other_a.get_length(), Allocator_traits::select_on_container_copy_construction(other_a.allocator))
+    {
+        std::uninitialized_copy(other_a.buffer, other_a.buffer + other_a.length, this->buffer);
+        this->length = other_a.length;
+    }
+    SmallVector(SmallVector<Type, inline_capacity, Allocator>&& other_a) noexcept
+        : allocator(std::move(other_a.allocator))
+    {
+        this->steal(std::move(other_a));
+    }
+    explicit SmallVector(const Allocator& allocator_a)
+        : allocator(allocator_a)
+    {
+    }
+    SmallVector(std::size_t capacity_a, const Allocator& allocator_a = Allocator {})
+        : allocator(allocator_a)
+    {
+        if (capacity_a > inline_capacity)
+        {
+            this->buffer = this->allocate(capacity_a);
+            this->capacity = capacity_a;
+        }
+    }
+    SmallVector(std::initializer_list<Type> list_a, const Allocator& allocator_a = Allocator {})
+        : SmallVector(list_a.size(), allocator_a)
+    {
+        std::uninitialized_copy(list_a.begin(), list_a.end(), this->buffer);
+        this->length = list_a.size();
+    }
+    SmallVector(std::span<const Type> data_a, const Allocator& allocator_a = Allocator {})
+        : SmallVector(data_a.size(), allocator_a)
+    {
+        std::uninitialized_copy(data_a.begin(), data_a.end(), this->buffer);
+        this->length = data_a.size();
+    }
+    ~SmallVector()
+    {
+        std::destroy_n(this->buffer, this->length);
+        this->release();
+    }
+
+    void push_back(const Type& data_a)
+    {
+        this->emplace_back(data_a);
+    }
+    void push_back(Type&& data_a)
+    {
+        this->emplace_back(std::move(data_a));
+    }
+    void push_back(std::span<const Type> data_a)
+    {
+        const std::size_t new_length = this->length + data_a.size();
+
+        if (new_length > this->capacity)
+        {
+            const std::size_t new_capacity = std::max(new_length, this->capacity * 2u);
+            Type* new_buffer = this->allocate(new_capacity);
+
+            // copy first: data_a may point into the buffer being replaced
+            std::uninitialized_copy(data_a.begin(), data_a.end(), new_buffer + this->length);
+            this->replace_buffer(new_buffer, new_capacity);
+        }
+        else
+        {
+            std::uninitialized_copy(data_a.begin(), data_a.end(), this->buffer + this->length);
+        }
+
+        this->length = new_length;
+    }
+
+    bool pop_back()
+    {
+        if (false == this->is_empty())
+        {
+            std::destroy_at(this->buffer + --this->length);
+            return true;
+        }
+
+        return false;
+    }
+
+    template<typename... Arg> Type& emplace_back(Arg&&... args_a)
+    {
+        if (this->length == this->capacity)
+        {
+            const std::size_t new_capacity = this->capacity * 2u;
+            Type* new_buffer = this->allocate(new_capacity);
+
+            // construct first: args_a may reference an element of the buffer being replaced
+            std::construct_at(new_buffer + this->length, std::forward<Arg>(args_a)...);
+            this->replace_buffer(new_buffer, new_capacity);
+        }
+        else
+        {
+            std::construct_at(this->buffer + this->length, std::forward<Arg>(args_a)...);
+        }
+
+        return this->buffer[this->length++];
+    }
+
+    void resize(std::size_t capacity_a)
+    {
+        if (this->capacity >= capacity_a)
+        {
+            return;
+        }
+
+        this->replace_buffer(this->allocate(capacity_a), capacity_a);
+    }
+    void reserve(std::size_t length_a)
+    {
+        this->resize(length_a);
+
+        if (length_a > this->length)
+        {
+            std::uninitialized_default_construct(this->buffer + this->length, this->buffer + length_a);
+        }
+        else
+        {
+            std::destroy(this->buffer + length_a, this->buffer + this->length);
+        }
+
+        this->length = length_a;
+    }
+
+    void shrink_to_fit()
+    {
+        if (false == this->is_inline() && this->capacity > this->length)
+        {
+            if (this->length <= inline_capacity)
+            {
+                this->replace_buffer(this->get_inline_buffer(), inline_capacity);
+            }
+            else
+            {
+                this->replace_buffer(this->allocate(this->length), this->length);
+            }
+        }
+    }
+
+    void clear()
+    {
+        std::destroy_n(this->buffer, this->length);
+        this->length = 0u;
+    }
+
+    std::size_t get_length() const
+    {
+        return this->length;
+    }
+    std::size_t get_capacity() const
+    {
+        return this->capacity;
+    }
+
+    const Type& get_back() const
+    {
+        assert(false == this->is_empty());
+
+        return this->buffer[this->length - 1u];
+    }
+    Type& get_back()
+    {
+        assert(false == this->is_empty());
+
+        return this->buffer[this->length - 1u];
+    }
+
+    bool is_empty() const
+    {
+        return 0u == this->length;
+    }
+    bool is_inline() const
+    {
+        return this->buffer == this->get_inline_buffer();
+    }
+    const Type* get_buffer() const
+    {
+        return this->buffer;
+    }
+    Type* get_buffer()
+    {
+        return this->buffer;
+    }
+
+    const Type& operator[](std::size_t index_a) const
+    {
+        assert(index_a < this->get_length());
+
+        return this->buffer[index_a];
+    }
+    Type& operator[](std::size_t index_a)
+    {
+        assert(index_a < this->get_length());
+
+        return this->buffer[index_a];
+    }
+    SmallVector<Type, inline_capacity, Allocator>& operator=(const SmallVector<Type, inline_capacity, Allocator>& other_a)
+    {
+        if (this != &other_a)
+        {
+            this->clear();
+
+            if constexpr (true == Allocator_traits::propagate_on_container_copy_assignment::value)
+            {
+                this->release();
+                this->allocator = other_a.allocator;
+            }
+
+            this->resize(other_a.length);
+
+            std::uninitialized_copy(other_a.buffer, other_a.buffer + other_a.length, this->buffer);
+            this->length = other_a.length;
+        }
+
+        return *this;
+    }
+    SmallVector<Type, inline_capacity, Allocator>& operator=(SmallVector<Type, inline_capacity, Allocator>&& other_a) noexcept(
+        Allocator_traits::propagate_on_container_move_assignment::value || Allocator_traits::is_always_equal::value)
+    {
+        if constexpr (false == Allocator_traits::propagate_on_container_move_assignment::value &&
+                      false == Allocator_traits::is_always_equal::value)
+        {
+            if (this->allocator != other_a.allocator)
+            {
+                // heap storage of other_a cannot be freed by our allocator, move the elements one by one
+                this->clear();
+                this->resize(other_a.length);
+
+                std::uninitialized_move_n(other_a.buffer, other_a.length, this->buffer);
+                this->length = other_a.length;
+
+                other_a.clear();
+
+                return *this;
+            }
+        }
+
+        if (this != &other_a)
+        {
+            std::destroy_n(this->buffer, this->length);
+            this->release();
+
+            if constexpr (true == Allocator_traits::propagate_on_container_move_assignment::value)
+            {
+                this->allocator = std::move(other_a.allocator);
+            }
+
+            this->steal(std::move(other_a));
+        }
+
+        return *this;
+    }
+
+    const Allocator& get_allocator() const
+    {
+        return this->allocator;
+    }
+
+    operator std::span<const Type>() const
+    {
+        return std::span<const Type> { this->buffer, this->length };
+    }
+
+private:
+    Type* allocate(std::size_t capacity_a)
+    {
+        return Allocator_traits::allocate(this->allocator, capacity_a);
+    }
+    static void relocate(Type* source_a, std::size_t length_a, Type* destination_a)
+    {
+        if constexpr (true == is_trivially_relocatable_v<Type>)
+        {
+            if (0u != length_a)
+            {
+                std::memcpy(static_cast<void*>(destination_a), static_cast<const void*>(source_a), length_a * sizeof(Type));
+            }
+        }
+        else
+        {
+            std::uninitialized_move_n(source_a, length_a, destination_a);
+            std::destroy_n(source_a, length_a);
+        }
+    }
+
+    Type* get_inline_buffer()
+    {
+        return reinterpret_cast<Type*>(this->inline_buffer);
+    }
+    const Type* get_inline_buffer() const
+    {
+        return reinterpret_cast<const Type*>(this->inline_buffer);
+    }
+
+    void replace_buffer(Type* new_buffer_a, std::size_t new_capacity_a)
+    {
+        relocate(this->buffer, this->length, new_buffer_a);
+        this->release();
+
+        this->buffer = new_buffer_a;
+        this->capacity = new_capacity_a;
+    }
+    void release()
+    {
+        if (false == this->is_inline())
+        {
+            Allocator_traits::deallocate(this->allocator, this->buffer, this->capacity);
+
+            this->buffer = this->get_inline_buffer();
+            this->capacity = inline_capacity;
+        }
+    }
+    void steal(SmallVector<Type, inline_capacity, Allocator>&& other_a)
+    {
+        if (true == other_a.is_inline())
+        {
+            relocate(other_a.buffer, other_a.length, this->buffer);
+        }
+        else
+        {
+            this->buffer = other_a.buffer;
+            this->capacity = other_a.capacity;
+
+            other_a.buffer = other_a.get_inline_buffer();
+            other_a.capacity = inline_capacity;
+        }
+
+        this->length = other_a.length;
+        other_a.length = 0u;
+    }
+
+    [[no_unique_address]] Allocator allocator;
+
+    alignas(Type) std::byte inline_buffer[inline_capacity * sizeof(Type)];
+
+    std::size_t capacity = inline_capacity;
+    std::size_t length = 0u;
+    Type* buffer = this->get_inline_buffer();
+};
+
+template<typename Type, std::size_t inline_capacity, typename Allocator>
+Type* begin(SmallVector<Type, inline_capacity, Allocator>& vec_a)
+{
+    return vec_a.get_buffer();
+}
+
+template<typename Type, std::size_t inline_capacity, typename Allocator>
+Type* end(SmallVector<Type, inline_capacity, Allocator>& vec_a)
+{
+    return vec_a.get_buffer() + vec_a.get_length();
+}
+
+template<typename Type, std::size_t inline_capacity, typename Allocator>
+const Type* begin(const SmallVector<Type, inline_capacity, Allocator>& vec_a)
+{
+    return vec_a.get_buffer();
+}
+
+template<typename Type, std::size_t inline_capacity, typename Allocator>
+const Type* end(const SmallVector<Type, inline_capacity, Allocator>& vec_a)
+{
+    return vec_a.get_buffer() + vec_a.get_length();
+}
+} // namespace lx::containers
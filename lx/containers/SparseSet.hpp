@@ -0,0 +1,244 @@
+#pragma once
+
+/*
+ *   Name: SparseSet.hpp
+ *   Copyright (c) Mateusz Semegen and contributors. All rights reserved.
+ */
+
+// lx
+#include <lx/containers/Vector.hpp>
+
+// std
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <span>
+#include <utility>
+
+namespace lx::containers {
+
+/// @brief Values keyed by small integers (entity indices) with O(1) insert, erase and lookup. The values are packed in a dense
+/// array in no particular order, erase moves the last one into the gap, so iteration is a linear walk over memory. The sparse
+/// side maps a key to its dense position and is allocated in pages of page_length keys, only for the ranges of keys in use.
+/// Inserting and erasing invalidate pointers to the values.
+/// @tparam Type of the values.
+/// @tparam Allocator of Type, rebound for the keys and the pages.
+template<typename Type, typename Allocator = std::allocator<Type>> class SparseSet
+{
+    using Key_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<std::uint32_t>;
+    using Page_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<std::uint32_t*>;
+
+public:
+    constexpr static std::size_t page_length = 4096u;
+
+    SparseSet() = default;
+    explicit SparseSet(const Allocator& allocator_a)
+        : pages(Page_allocator(allocator_a))
+        , keys(Key_allocator(allocator_a))
+        , values(allocator_a)
+    {
+    }
+    SparseSet(const SparseSet<Type, Allocator>& other_a)
+        : pages(other_a.pages.get_length(), Page_allocator(other_a.values.get_allocator()))
+        , keys(other_a.keys)
+        , values(other_a.values)
+    {
+        for (std::uint32_t* page : other_a.pages)
+        {
+            std::uint32_t* copy = nullptr;
+
+            if (nullptr != page)
+            {
+                copy = this->allocate_page();
+                std::copy_n(page, page_length, copy);
+            }
+
+            this->pages.push_back(copy);
+        }
+    }
+    SparseSet(SparseSet<Type, Allocator>&& other_a) noexcept = default;
+    ~SparseSet()
+    {
+        this->release_pages();
+    }
+
+    /// @brief Constructs the value of key_a, which must not be in the set yet.
+    template<typename... Arg> Type& emplace(std::uint32_t key_a, Arg&&... args_a)
+    {
+        assert(false == this->contains(key_a));
+
+        std::uint32_t& position = this->get_position(key_a);
+        position = static_cast<std::uint32_t>(this->values.get_length());
+
+        this->keys.push_back(key_a);
+        return this->values.emplace_back(std::forward<Arg>(args_a)...);
+    }
+    /// @brief Removes the value of key_a by moving the last value into its place. Returns false when key_a is not in the set.
+    bool erase(std::uint32_t key_a)
+    {
+        if (false == this->contains(key_a))
+        {
+            return false;
+        }
+
+        std::uint32_t& position = this->pages[key_a / page_length][key_a % page_length];
+        const std::uint32_t last_key = this->keys.get_back();
+
+        if (last_key != key_a)
+        {
+            this->values[position] = std::move(this->values.get_back());
+            this->keys[position] = last_key;
+            this->pages[last_key / page_length][last_key % page_length] = position;
+        }
+
+        position = npos;
+        this->values.pop_back();
+        this->keys.pop_back();
+
+        return true;
+    }
+    /// @brief Removes every value, the pages stay allocated.
+    void clear()
+    {
+        for (const std::uint32_t key : this->keys)
+        {
+            this->pages[key / page_length][key % page_length] = npos;
+        }
+
+        this->keys.clear();
+        this->values.clear();
+    }
+
+    bool contains(std::uint32_t key_a) const
+    {
+        const std::size_t page = key_a / page_length;
+
+        return page < this->pages.get_length() && nullptr != this->pages[page] && npos != this->pages[page][key_a % page_length];
+    }
+
+    /// @brief Returns the value or nullptr when key_a is not in the set.
+    Type* get(std::uint32_t key_a)
+    {
+        return true == this->contains(key_a) ? &this->values[this->pages[key_a / page_length][key_a % page_length]] : nullptr;
+    }
+    const Type* get(std::uint32_t key_a) const
+    {
+        return true == this->contains(key_a) ? &this->values[this->pages[key_a / page_length][key_a % page_length]] : nullptr;
+    }
+
+    /// @brief Keys in the order of the values.
+    std::span<const std::uint32_t> get_keys() const
+    {
+        return this->keys;
+    }
+    std::span<Type> get_values()
+    {
+        return { this->values.get_buffer(), this->values.get_length() };
+    }
+    std::span<const Type> get_values() const
+    {
+        return this->values;
+    }
+
+    std::size_t get_length() const
+    {
+        return this->values.get_length();
+    }
+    bool is_empty() const
+    {
+        return this->values.is_empty();
+    }
+
+    Type* begin()
+    {
+        return this->values.get_buffer();
+    }
+    Type* end()
+    {
+        return this->values.get_buffer() + this->values.get_length();
+    }
+    const Type* begin() const
+    {
+        return this->values.get_buffer();
+    }
+    const Type* end() const
+    {
+        return this->values.get_buffer() + this->values.get_length();
+    }
+
+    SparseSet<Type, Allocator>& operator=(const SparseSet<Type, Allocator>& other_a)
+    {
+        if (this != &other_a)
+        {
+            SparseSet<Type, Allocator> copy(other_a);
+            *this = std::move(copy);
+        }
+
+        return *this;
+    }
+    SparseSet<Type, Allocator>& operator=(SparseSet<Type, Allocator>&& other_a) noexcept
+    {
+        if (this != &other_a)
+        {
+            this->release_pages();
+
+            this->pages = std::move(other_a.pages);
+            this->keys = std::move(other_a.keys);
+            this->values = std::move(other_a.values);
+        }
+
+        return *this;
+    }
+
+private:
+    constexpr static std::uint32_t npos = std::numeric_limits<std::uint32_t>::max();
+
+    std::uint32_t* allocate_page()
+    {
+        Key_allocator allocator(this->values.get_allocator());
+
+        std::uint32_t* page = std::allocator_traits<Key_allocator>::allocate(allocator, page_length);
+        std::fill_n(page, page_length, npos);
+
+        return page;
+    }
+    void release_pages()
+    {
+        Key_allocator allocator(this->values.get_allocator());
+
+        for (std::uint32_t* page : this->pages)
+        {
+            if (nullptr != page)
+            {
+                std::allocator_traits<Key_allocator>::deallocate(allocator, page, page_length);
+            }
+        }
+
+        this->pages.clear();
+    }
+
+    std::uint32_t& get_position(std::uint32_t key_a)
+    {
+        const std::size_t page = key_a / page_length;
+
+        while (this->pages.get_length() <= page)
+        {
+            this->pages.push_back(nullptr);
+        }
+
+        if (nullptr == this->pages[page])
+        {
+            this->pages[page] = this->allocate_page();
+        }
+
+        return this->pages[page][key_a % page_length];
+    }
+
+    Vector<std::uint32_t*, 0u, Page_allocator> pages;
+    Vector<std::uint32_t, 0u, Key_allocator> keys;
+    Vector<Type, 0u, Allocator> values;
+};
+} // namespace lx::containers
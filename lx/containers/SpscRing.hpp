@@ -0,0 +1,161 @@
+#pragma once
+
+/*
+ *   Name: SpscRing.hpp
+ *   Copyright (c) Mateusz Semegen and contributors. All rights reserved.
+ */
+
+// lx
+#include <lx/common/non_copyable.hpp>
+#include <lx/common/out.hpp>
+
+// std
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <span>
+#include <utility>
+
+namespace lx::containers {
+
+/// @brief A bounded wait-free ring with a single producer and a single consumer.
+/// Each side owns its position and reads the other one only when its cached copy says the ring is full or empty, so in the
+/// steady state a push or a pop touches no cache line written by the other thread except the cell itself.
+/// @tparam Type of the elements.
+/// @tparam capacity number of cells, must be a power of two.
+template<typename Type, std::size_t capacity> class SpscRing : private lx::common::non_copyable
+{
+    static_assert(capacity > 1u && 0u == (capacity & (capacity - 1u)));
+
+public:
+    SpscRing() = default;
+    ~SpscRing()
+    {
+        const std::size_t write = this->producer.position.load(std::memory_order_relaxed);
+
+        for (std::size_t position = this->consumer.position.load(std::memory_order_relaxed); position != write; position++)
+        {
+            std::destroy_at(this->get(position));
+        }
+    }
+
+    /// @brief Constructs a value in the next free cell. Returns false when the ring is full. Only the producer thread may call it.
+    template<typename... Arg> bool try_emplace(Arg&&... args_a)
+    {
+        const std::size_t position = this->producer.position.load(std::memory_order_relaxed);
+
+        if (0u == this->get_free_count(position, 1u))
+        {
+            return false;
+        }
+
+        std::construct_at(this->get(position), std::forward<Arg>(args_a)...);
+        this->producer.position.store(position + 1u, std::memory_order_release);
+
+        return true;
+    }
+    bool try_push(const Type& value_a)
+    {
+        return this->try_emplace(value_a);
+    }
+    bool try_push(Type&& value_a)
+    {
+        return this->try_emplace(std::move(value_a));
+    }
+    /// @brief Copies as many of values_a as fit and publishes them at once. Returns how many were pushed.
+    std::size_t try_push(std::span<const Type> values_a)
+    {
+        const std::size_t position = this->producer.position.load(std::memory_order_relaxed);
+        const std::size_t count = std::min(values_a.size(), this->get_free_count(position, values_a.size()));
+
+        for (std::size_t i = 0u; i < count; i++)
+        {
+            std::construct_at(this->get(position + i), values_a[i]);
+        }
+
+        this->producer.position.store(position + count, std::memory_order_release);
+        return count;
+    }
+
+    /// @brief Moves the oldest value out. Returns false when the ring is empty. Only the consumer thread may call it.
+    bool try_pop(lx::common::out<Type> value_a)
+    {
+        return 1u == this->try_pop(std::span<Type> { &(*value_a), 1u });
+    }
+    /// @brief Moves up to values_a.size() oldest values out and frees their cells at once. Returns how many were popped.
+    std::size_t try_pop(std::span<Type> values_a)
+    {
+        const std::size_t position = this->consumer.position.load(std::memory_order_relaxed);
+        const std::size_t count = std::min(values_a.size(), this->get_ready_count(position, values_a.size()));
+
+        for (std::size_t i = 0u; i < count; i++)
+        {
+            Type* value = this->get(position + i);
+
+            values_a[i] = std::move(*value);
+            std::destroy_at(value);
+        }
+
+        this->consumer.position.store(position + count, std::memory_order_release);
+        return count;
+    }
+
+    /// @brief Approximate number of elements, exact only when called from the producer or the consumer thread.
+    std::size_t get_length() const
+    {
+        const std::size_t read = this->consumer.position.load(std::memory_order_acquire);
+        const std::size_t write = this->producer.position.load(std::memory_order_acquire);
+
+        return write > read ? write - read : 0u;
+    }
+    constexpr std::size_t get_capacity() const
+    {
+        return capacity;
+    }
+    bool is_empty() const
+    {
+        return 0u == this->get_length();
+    }
+
+private:
+    constexpr static std::size_t cache_line_size = 64u;
+
+    // other_position is the last seen position of the other side, read and written only by the owner of the side
+    struct alignas(cache_line_size) Side
+    {
+        std::atomic<std::size_t> position = 0u;
+        std::size_t other_position = 0u;
+    };
+
+    Type* get(std::size_t position_a)
+    {
+        return std::launder(reinterpret_cast<Type*>(this->storage + (position_a & (capacity - 1u)) * sizeof(Type)));
+    }
+
+    // the other side is read again only when the cached position cannot satisfy the request
+    std::size_t get_free_count(std::size_t position_a, std::size_t wanted_a)
+    {
+        if (capacity - (position_a - this->producer.other_position) < wanted_a)
+        {
+            this->producer.other_position = this->consumer.position.load(std::memory_order_acquire);
+        }
+
+        return capacity - (position_a - this->producer.other_position);
+    }
+    std::size_t get_ready_count(std::size_t position_a, std::size_t wanted_a)
+    {
+        if (this->consumer.other_position - position_a < wanted_a)
+        {
+            this->consumer.other_position = this->producer.position.load(std::memory_order_acquire);
+        }
+
+        return this->consumer.other_position - position_a;
+    }
+
+    Side producer;
+    Side consumer;
+    alignas(cache_line_size) alignas(Type) std::byte storage[sizeof(Type) * capacity];
+};
+} // namespace lx::containers
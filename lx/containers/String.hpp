@@ -4,11 +4,20 @@
 #include <lx/containers/Vector.hpp>
 
 // std
+#include <algorithm>
 #include <cstddef>
+#include <cstring>
+#include <memory>
 #include <string_view>
+#include <type_traits>
+#include <utility>
+
+#if __has_include(<format>)
+#include <format>
+#endif
 
 namespace lx::containers {
-template<typename Char, std::size_t capacity = 0u> class String
+template<typename Char, std::size_t capacity = 0u, typename Allocator = std::allocator<Char>> class String
 {
 public:
     String()
@@ -20,8 +29,8 @@ public:
         this->buffer.push_back(string_a);
         this->buffer.push_back('\0');
     }
-    String(const String<Char, capacity>&) = default;
-    String(String<Char, capacity>&&) = default;
+    String(const String<Char, capacity, Allocator>&) = default;
+    String(String<Char, capacity, Allocator>&&) = default;
 
     bool push_back(Char char_a)
     {
@@ -51,9 +60,17 @@ public:
         return false;
     }
 
-    bool reserve(std::size_t length)
+    /// @brief Sets the length, as Vector::reserve does; the characters past the old length are left as they are. Meant for
+    /// writing straight into get_buffer(). Returns false when length_a characters and the terminator do not fit.
+    bool reserve(std::size_t length_a)
     {
-        return this->buffer.reserve(length + 1u);
+        if (true == this->buffer.reserve(length_a + 1u))
+        {
+            this->buffer[length_a] = static_cast<Char>('\0');
+            return true;
+        }
+
+        return false;
     }
 
     std::size_t get_capacity() const
@@ -87,90 +104,328 @@ private:
     Vector<Char, capacity> buffer = {};
 };
 
-template<typename Char> class String<Char, 0u>
+/// @brief Growable, null terminated string. Up to local_capacity characters, the terminator included, are kept inside the
+/// object, longer ones go to the heap and grow geometrically, so appending one character at a time is amortized constant.
+template<typename Char, typename Allocator> class String<Char, 0u, Allocator>
 {
+    using Allocator_traits = std::allocator_traits<Allocator>;
+
 public:
+    /// @brief 24 bytes of characters, 23 chars with the terminator: enough for most names, paths and log lines.
+    constexpr static std::size_t local_capacity = 24u / sizeof(Char);
+
     String()
-        : buffer({ static_cast<Char>('\0') })
     {
+        this->storage.local[0] = static_cast<Char>('\0');
     }
-    String(const String<Char>&) = default;
-    String(std::basic_string_view<Char> string_a)
-        : buffer(string_a.size() + 2u)
+    explicit String(const Allocator& allocator_a)
+        : allocator(allocator_a)
+    {
+        this->storage.local[0] = static_cast<Char>('\0');
+    }
+    String(const String<Char, 0u, Allocator>& other_a)
+        : String(static_cast<std::basic_string_view<Char>>(other_a),
+                 Allocator_traits::select_on_container_copy_construction(other_a.allocator))
+    {
+    }
+    String(String<Char, 0u, Allocator>&& other_a) noexcept
+        : allocator(std::move(other_a.allocator))
+    {
+        this->steal(std::move(other_a));
+    }
+    String(std::basic_string_view<Char> string_a, const Allocator& allocator_a = Allocator {})
+        : String(allocator_a)
     {
-        buffer.push_back(std::span { string_a.begin(), string_a.size() });
-        buffer.push_back('\0');
+        this->append(string_a);
+    }
+    ~String()
+    {
+        this->release();
     }
 
     void push_back(Char char_a)
     {
-        this->buffer.pop_back();
+        this->append(char_a);
+    }
+    void push_back(std::basic_string_view<Char> string_a)
+    {
+        this->append(string_a);
+    }
+
+    void append(Char char_a)
+    {
+        if (this->length + 2u > this->get_capacity())
+        {
+            this->reallocate(this->get_grown_capacity(this->length + 2u));
+        }
 
-        const Char c[] = { char_a, static_cast<Char>('\0') };
-        this->buffer.push_back(std::span<const Char, 2u>(c));
+        this->buffer[this->length++] = char_a;
+        this->buffer[this->length] = static_cast<Char>('\0');
     }
-    void push_back(std::string_view string_a)
+    void append(std::size_t count_a, Char char_a)
     {
-        this->buffer.pop_back();
+        const std::size_t new_length = this->length + count_a;
+
+        if (new_length + 1u > this->get_capacity())
+        {
+            this->reallocate(this->get_grown_capacity(new_length + 1u));
+        }
 
-        const std::size_t l = this->buffer.get_length();
-        this->buffer.reserve(l + string_a.size() + 1u);
+        std::fill_n(this->buffer + this->length, count_a, char_a);
 
-        std::memcpy(this->buffer.get_buffer() + l, string_a.data(), string_a.size());
-        this->buffer[l + string_a.size()] = '\0';
+        this->length = new_length;
+        this->buffer[this->length] = static_cast<Char>('\0');
+    }
+    void append(std::basic_string_view<Char> string_a)
+    {
+        const std::size_t new_length = this->length + string_a.size();
+
+        if (new_length + 1u > this->get_capacity())
+        {
+            const std::size_t new_capacity = this->get_grown_capacity(new_length + 1u);
+            Char* new_buffer = this->allocate(new_capacity);
+
+            // copy first: string_a may point into the buffer being replaced
+            copy(string_a, new_buffer + this->length);
+            this->replace_buffer(new_buffer, new_capacity);
+        }
+        else
+        {
+            copy(string_a, this->buffer + this->length);
+        }
+
+        this->length = new_length;
+        this->buffer[this->length] = static_cast<Char>('\0');
+    }
+
+#if defined(__cpp_lib_format)
+    /// @brief Appends the formatted arguments, written straight into the buffer. One formatting pass when the result fits the
+    /// spare capacity, a second one after growing when it does not.
+    template<typename... Arg> void format_to(std::basic_format_string<Char, std::type_identity_t<Arg&>...> format_a, Arg&&... args_a)
+    {
+        const std::size_t spare = this->get_capacity() - this->length - 1u;
+        const auto result = std::format_to_n(this->buffer + this->length, static_cast<std::ptrdiff_t>(spare), format_a, args_a...);
+        const std::size_t formatted = static_cast<std::size_t>(result.size);
+
+        if (formatted > spare)
+        {
+            this->reallocate(this->get_grown_capacity(this->length + formatted + 1u));
+            std::format_to_n(this->buffer + this->length, static_cast<std::ptrdiff_t>(formatted), format_a, args_a...);
+        }
+
+        this->length += formatted;
+        this->buffer[this->length] = static_cast<Char>('\0');
+    }
+#endif
+
+    /// @brief Makes room for capacity_a characters and the terminator, the length does not change (as Vector::resize).
+    void resize(std::size_t capacity_a)
+    {
+        if (capacity_a + 1u > this->get_capacity())
+        {
+            this->reallocate(capacity_a + 1u);
+        }
+    }
+    /// @brief Sets the length, new characters are fill_a (as Vector::reserve). Meant for writing straight into get_buffer().
+    void reserve(std::size_t length_a, Char fill_a = static_cast<Char>('\0'))
+    {
+        if (length_a > this->length)
+        {
+            this->append(length_a - this->length, fill_a);
+        }
+        else
+        {
+            this->length = length_a;
+            this->buffer[this->length] = static_cast<Char>('\0');
+        }
+    }
+    void clear()
+    {
+        this->length = 0u;
+        this->buffer[0] = static_cast<Char>('\0');
     }
 
     const Char* get_cstring() const
     {
-        return this->buffer.get_buffer();
+        return this->buffer;
     }
     Char* get_cstring()
     {
-        return this->buffer.get_buffer();
+        return this->buffer;
+    }
+    const Char* get_buffer() const
+    {
+        return this->buffer;
+    }
+    Char* get_buffer()
+    {
+        return this->buffer;
     }
 
+    /// @brief Characters that fit without an allocation, the terminator included.
     std::size_t get_capacity() const
     {
-        return this->buffer.get_capacity();
+        return true == this->is_local() ? local_capacity : this->storage.capacity;
     }
-
     std::size_t get_length() const
     {
-        return this->buffer.get_length() - 1u;
+        return this->length;
     }
 
     bool is_empty() const
     {
-        return 0u == this->get_length();
+        return 0u == this->length;
+    }
+    /// @brief Tells whether the characters are stored inside the object.
+    bool is_local() const
+    {
+        return this->buffer == this->storage.local;
     }
 
-    String<Char>& operator=(const String<Char, 0u>& string_a)
+    String<Char, 0u, Allocator>& operator=(const String<Char, 0u, Allocator>& string_a)
+    {
+        if (this != &string_a)
+        {
+            *this = static_cast<std::basic_string_view<Char>>(string_a);
+        }
+
+        return *this;
+    }
+    String<Char, 0u, Allocator>& operator=(String<Char, 0u, Allocator>&& string_a) noexcept(
+        Allocator_traits::propagate_on_container_move_assignment::value || Allocator_traits::is_always_equal::value)
     {
-        this->buffer.clear();
-        this->buffer.reserve(string_a.size() + 1u);
+        if constexpr (false == Allocator_traits::propagate_on_container_move_assignment::value &&
+                      false == Allocator_traits::is_always_equal::value)
+        {
+            if (this->allocator != string_a.allocator)
+            {
+                // storage of string_a cannot be freed by our allocator, copy the characters
+                *this = static_cast<std::basic_string_view<Char>>(string_a);
+                string_a.clear();
+
+                return *this;
+            }
+        }
 
-        std::memcpy(this->buffer.get_buffer(), string_a.data(), string_a.size());
-        this->buffer[string_a.size()] = '\0';
+        if (this != &string_a)
+        {
+            this->release();
+
+            if constexpr (true == Allocator_traits::propagate_on_container_move_assignment::value)
+            {
+                this->allocator = std::move(string_a.allocator);
+            }
+
+            this->steal(std::move(string_a));
+        }
 
         return *this;
     }
-    String<Char>& operator=(std::string_view string_a)
+    String<Char, 0u, Allocator>& operator=(std::basic_string_view<Char> string_a)
     {
-        this->buffer.clear();
-        this->buffer.reserve(string_a.size() + 1u);
+        if (string_a.size() + 1u > this->get_capacity())
+        {
+            Char* new_buffer = this->allocate(string_a.size() + 1u);
+
+            // copy first: string_a may point into the buffer being replaced
+            copy(string_a, new_buffer);
+            this->release();
+
+            this->buffer = new_buffer;
+            this->storage.capacity = string_a.size() + 1u;
+        }
+        else if (false == string_a.empty())
+        {
+            std::memmove(this->buffer, string_a.data(), string_a.size() * sizeof(Char));
+        }
 
-        std::memcpy(this->buffer.get_buffer(), string_a.data(), string_a.size());
-        this->buffer[string_a.size()] = '\0';
+        this->length = string_a.size();
+        this->buffer[this->length] = static_cast<Char>('\0');
 
         return *this;
     }
 
-    operator std::string_view() const
+    const Allocator& get_allocator() const
     {
-        return { this->get_cstring(), this->get_length() };
+        return this->allocator;
+    }
+
+    operator std::basic_string_view<Char>() const
+    {
+        return { this->buffer, this->length };
     }
 
 private:
-    Vector<Char> buffer;
+    static void copy(std::basic_string_view<Char> string_a, Char* destination_a)
+    {
+        if (false == string_a.empty())
+        {
+            std::memcpy(destination_a, string_a.data(), string_a.size() * sizeof(Char));
+        }
+    }
+
+    Char* allocate(std::size_t capacity_a)
+    {
+        return Allocator_traits::allocate(this->allocator, capacity_a);
+    }
+    void release()
+    {
+        if (false == this->is_local())
+        {
+            Allocator_traits::deallocate(this->allocator, this->buffer, this->storage.capacity);
+        }
+    }
+    void replace_buffer(Char* new_buffer_a, std::size_t new_capacity_a)
+    {
+        copy({ this->buffer, this->length }, new_buffer_a);
+        this->release();
+
+        this->buffer = new_buffer_a;
+        this->storage.capacity = new_capacity_a;
+    }
+    void reallocate(std::size_t capacity_a)
+    {
+        Char* new_buffer = this->allocate(capacity_a);
+
+        // the terminator as well, callers that only grow the buffer do not rewrite it
+        new_buffer[this->length] = static_cast<Char>('\0');
+        this->replace_buffer(new_buffer, capacity_a);
+    }
+    std::size_t get_grown_capacity(std::size_t required_a) const
+    {
+        return std::max(required_a, this->get_capacity() * 2u);
+    }
+
+    void steal(String<Char, 0u, Allocator>&& other_a)
+    {
+        this->length = other_a.length;
+
+        if (true == other_a.is_local())
+        {
+            this->buffer = this->storage.local;
+            std::memcpy(this->storage.local, other_a.storage.local, (other_a.length + 1u) * sizeof(Char));
+        }
+        else
+        {
+            this->buffer = other_a.buffer;
+            this->storage.capacity = other_a.storage.capacity;
+        }
+
+        other_a.buffer = other_a.storage.local;
+        other_a.storage.local[0] = static_cast<Char>('\0');
+        other_a.length = 0u;
+    }
+
+    [[no_unique_address]] Allocator allocator;
+
+    std::size_t length = 0u;
+    Char* buffer = this->storage.local;
+
+    // the local characters and the heap capacity are never needed at the same time
+    union Storage
+    {
+        std::size_t capacity;
+        Char local[local_capacity];
+    } storage;
 };
 } // namespace lx::containers
\ No newline at end of file
@@ -0,0 +1,200 @@
+#pragma once
+
+/*
+ *   Name: StringId.hpp
+ *   Copyright (c) Mateusz Semegen and contributors. All rights reserved.
+ */
+
+// lx
+#include <lx/containers/String.hpp>
+
+// std
+#include <atomic>
+#include <cassert>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <shared_mutex>
+#include <string_view>
+#include <unordered_map>
+
+// names of the ids made at run time are kept for get_name() in debug builds, define LX_STRING_ID_NAMES as 0 or 1 to override.
+// The intern table itself, which detects hash collisions, is there in every build.
+#if !defined(LX_STRING_ID_NAMES)
+#if defined(NDEBUG)
+#define LX_STRING_ID_NAMES 0
+#else
+#define LX_STRING_ID_NAMES 1
+#endif
+#endif
+
+namespace lx::containers {
+
+/// @brief A name reduced to its 64 bit FNV-1a hash: compared with one integer compare and used as a hash key as it is.
+/// Made from a constant (a constexpr variable or the _id literal) it is hashed at compile time and costs nothing at run time.
+/// The ids made at run time are recorded in a global, thread safe intern table with a second, independent hash of the name, so
+/// two names with the same id are detected in every build: counted by get_collisions_count() and asserted on. With
+/// LX_STRING_ID_NAMES the table keeps the names as well, for get_name(). The ids made at compile time (the _id literal) are not
+/// recorded and have no name, until the same name is hashed at run time.
+class StringId
+{
+public:
+    constexpr StringId() = default;
+    constexpr explicit StringId(std::string_view name_a)
+        : hash(get_hash(name_a))
+    {
+        if !consteval
+        {
+            intern(this->hash, name_a);
+        }
+    }
+
+    [[nodiscard]] constexpr static StringId from_hash(std::uint64_t hash_a)
+    {
+        StringId id;
+        id.hash = hash_a;
+
+        return id;
+    }
+    [[nodiscard]] constexpr static std::uint64_t get_hash(std::string_view name_a)
+    {
+        std::uint64_t hash = 14695981039346656037u;
+
+        for (const char c : name_a)
+        {
+            hash = (hash ^ static_cast<std::uint8_t>(c)) * 1099511628211u;
+        }
+
+        return hash;
+    }
+
+    [[nodiscard]] constexpr std::uint64_t get_hash() const
+    {
+        return this->hash;
+    }
+    /// @brief The name of the id when it was made at run time, empty for ids made only at compile time or without
+    /// LX_STRING_ID_NAMES.
+    [[nodiscard]] std::string_view get_name() const
+    {
+#if LX_STRING_ID_NAMES
+        Table& table = get_table();
+        std::shared_lock lock(table.mutex);
+
+        const auto entry = table.entries.find(this->hash);
+        return table.entries.end() != entry ? std::string_view { entry->second.name } : std::string_view {};
+#else
+        return {};
+#endif
+    }
+    /// @brief Number of names made at run time whose id was already taken by a different name.
+    [[nodiscard]] static std::size_t get_collisions_count()
+    {
+        return get_table().collisions_count.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] constexpr bool is_empty() const
+    {
+        return empty_hash == this->hash;
+    }
+
+    [[nodiscard]] friend constexpr bool operator==(StringId left_a, StringId right_a) = default;
+    [[nodiscard]] friend constexpr std::strong_ordering operator<=>(StringId left_a, StringId right_a) = default;
+
+private:
+    constexpr static std::uint64_t empty_hash = 14695981039346656037u;
+
+    struct Entry
+    {
+        // 32 bit FNV-1a of the name, a different name with the same id is unlikely to match it too
+        std::uint32_t check;
+#if LX_STRING_ID_NAMES
+        String<char> name;
+#endif
+    };
+
+    struct Table
+    {
+        std::shared_mutex mutex;
+        std::atomic<std::size_t> collisions_count = 0u;
+
+        // the names live in the nodes, which never move, so views of them stay valid
+        std::unordered_map<std::uint64_t, Entry> entries;
+    };
+
+    static std::uint32_t get_check(std::string_view name_a)
+    {
+        std::uint32_t check = 2166136261u;
+
+        for (const char c : name_a)
+        {
+            check = (check ^ static_cast<std::uint8_t>(c)) * 16777619u;
+        }
+
+        return check;
+    }
+
+    static Table& get_table()
+    {
+        static Table table;
+        return table;
+    }
+    static void intern(std::uint64_t hash_a, std::string_view name_a)
+    {
+        Table& table = get_table();
+        const std::uint32_t check = get_check(name_a);
+
+        {
+            std::shared_lock lock(table.mutex);
+
+            const auto entry = table.entries.find(hash_a);
+
+            if (table.entries.end() != entry)
+            {
+                if (check != entry->second.check)
+                {
+                    table.collisions_count.fetch_add(1u, std::memory_order_relaxed);
+                    assert(false && "two names with the same StringId");
+                }
+
+                return;
+            }
+        }
+
+        std::unique_lock lock(table.mutex);
+
+        // another thread may have interned the id in the meantime
+#if LX_STRING_ID_NAMES
+        const auto [entry, is_inserted] = table.entries.try_emplace(hash_a, Entry { .check = check, .name = String<char>(name_a) });
+#else
+        const auto [entry, is_inserted] = table.entries.try_emplace(hash_a, Entry { .check = check });
+#endif
+
+        if (false == is_inserted && check != entry->second.check)
+        {
+            table.collisions_count.fetch_add(1u, std::memory_order_relaxed);
+            assert(false && "two names with the same StringId");
+        }
+    }
+
+    std::uint64_t hash = empty_hash;
+};
+
+namespace literals {
+/// @brief "name"_id, always hashed at compile time. The id is not interned, it has no name until the same name is made at run time.
+consteval StringId operator""_id(const char* name_a, std::size_t length_a)
+{
+    return StringId { std::string_view { name_a, length_a } };
+}
+} // namespace literals
+} // namespace lx::containers
+
+template<> struct std::hash<lx::containers::StringId>
+{
+    /// @brief The id is a hash already.
+    std::size_t operator()(lx::containers::StringId id_a) const
+    {
+        return static_cast<std::size_t>(id_a.get_hash());
+    }
+};
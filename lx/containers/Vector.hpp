@@ -1,23 +1,35 @@
 #pragma once
 
 // std
+#include <algorithm>
 #include <array>
 #include <cassert>
 #include <cstddef>
+#include <cstring>
+#include <initializer_list>
 #include <memory>
 #include <span>
+#include <type_traits>
+#include <utility>
 
 namespace lx::containers {
-template<typename Type, std::size_t capacity = 0u> class Vector
+/// @brief Tells the containers that an object can be moved to a new address with a plain memcpy.
+/// Specialize for types that are not trivially copyable but do not care about their own address.
+template<typename Type> struct is_trivially_relocatable : std::bool_constant<std::is_trivially_copyable_v<Type>>
+{
+};
+template<typename Type> constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<Type>::value;
+
+template<typename Type, std::size_t capacity = 0u, typename Allocator = std::allocator<Type>> class Vector
 {
 public:
     Vector() = default;
-    Vector(const Vector<Type, capacity>& other_a)
+    Vector(const Vector<Type, capacity, Allocator>& other_a)
     {
         this->length = other_a.get_length();
         std::copy(other_a.get_buffer(), other_a.get_buffer() + this->length, this->buffer);
     }
-    Vector(Vector<Type, capacity>&& other_a)
+    Vector(Vector<Type, capacity, Allocator>&& other_a)
     {
         this->length = other_a.get_length();
         std::copy(other_a.get_buffer(), other_a.get_buffer() + this->length, this->buffer);
@@ -148,7 +160,7 @@ public:
         return this->buffer[index_a];
     }
 
-    Vector<Type, capacity>& operator=(const Vector<Type, capacity>& other_a)
+    Vector<Type, capacity, Allocator>& operator=(const Vector<Type, capacity, Allocator>& other_a)
     {
         return {};
     }
@@ -162,86 +174,128 @@ private:
     Type buffer[capacity] = {};
     std::size_t length = 0u;
 };
-template<typename Type> class Vector<Type, 0u>
+template<typename Type, typename Allocator> class Vector<Type, 0u, Allocator>
 {
+    using Allocator_traits = std::allocator_traits<Allocator>;
+
 public:
+    using value_type = Type;
+
     Vector() = default;
-    Vector(const Vector<Type, 0u>& other_a)
-        : capacity(other_a.capacity)
+    Vector(const Vector<Type, 0u, Allocator>& other_a)
+        : allocator(Allocator_traits::select_on_container_copy_construction(other_a.allocator))
+        , capacity(other_a.capacity)
         , length(other_a.length)
-        , buffer(std::make_unique<Type[]>(other_a.capacity))
+        , buffer(this->allocate(other_a.capacity))
     {
-        for (std::size_t i = 0; i < this->get_length(); i++)
-        {
-            this->buffer[i] = other_a.buffer[i];
-        }
+        std::uninitialized_copy(other_a.buffer, other_a.buffer + other_a.length, this->buffer);
     }
-    Vector(Vector<Type, 0u>&& other_a) noexcept
-        : capacity(other_a.capacity)
+    Vector(Vector<Type, 0u, Allocator>&& other_a) noexcept
+        : allocator(std::move(other_a.allocator))
+        , capacity(other_a.capacity)
         , length(other_a.length)
-        , buffer(std::move(other_a.buffer))
+        , buffer(other_a.buffer)
     {
         other_a.capacity = 0u;
         other_a.length = 0u;
+        other_a.buffer = nullptr;
+    }
+    explicit Vector(const Allocator& allocator_a)
+        : allocator(allocator_a)
+    {
     }
-    Vector(std::size_t capacity_a)
-        : capacity(capacity_a)
+    Vector(std::size_t capacity_a, const Allocator& allocator_a = Allocator {})
+        : allocator(allocator_a)
+        , capacity(capacity_a)
         , length(0)
-        , buffer(std::make_unique<Type[]>(capacity_a))
+        , buffer(this->allocate(capacity_a))
     {
     }
-    Vector(std::initializer_list<Type> list_a)
-        : capacity(list_a.size())
+    Vector(std::initializer_list<Type> list_a, const Allocator& allocator_a = Allocator {})
+        : allocator(allocator_a)
+        , capacity(list_a.size())
         , length(list_a.size())
-        , buffer(std::make_unique<Type[]>(list_a.size()))
+        , buffer(this->allocate(list_a.size()))
     {
-        for (std::size_t i = 0; i < this->get_length(); i++)
-        {
-            this->buffer[i] = *(list_a.begin() + i);
-        }
+        std::uninitialized_copy(list_a.begin(), list_a.end(), this->buffer);
     }
-    Vector(std::span<const Type> data_a)
-        : Vector(data_a.size())
+    Vector(std::span<const Type> data_a, const Allocator& allocator_a = Allocator {})
+        : Vector(data_a.size(), allocator_a)
     {
+        std::uninitialized_copy(data_a.begin(), data_a.end(), this->buffer);
         this->length = data_a.size();
-        std::copy(data_a.begin(), data_a.begin() + this->length, this->buffer.get());
+    }
+    ~Vector()
+    {
+        std::destroy_n(this->buffer, this->length);
+        this->deallocate(this->buffer, this->capacity);
     }
 
     void push_back(const Type& data_a)
     {
-        this->resize(this->get_length() + 2u);
-        this->buffer[this->length++] = data_a;
+        this->emplace_back(data_a);
     }
     void push_back(Type&& data_a)
     {
-        this->resize(this->get_length() + 2u);
-        this->buffer[this->length++] = std::move(data_a);
+        this->emplace_back(std::move(data_a));
     }
     void push_back(std::span<const Type> data_a)
     {
-        this->resize(this->get_length() + data_a.size());
+        const std::size_t new_length = this->length + data_a.size();
 
-        for (std::size_t i = 0; i < data_a.size(); i++)
+        if (new_length > this->capacity)
         {
-            this->buffer[this->length++] = data_a[i];
+            const std::size_t new_capacity = this->get_grown_capacity(new_length);
+            Type* new_buffer = this->allocate(new_capacity);
+
+            // copy first: data_a may point into the buffer being replaced
+            std::uninitialized_copy(data_a.begin(), data_a.end(), new_buffer + this->length);
+            relocate(this->buffer, this->length, new_buffer);
+            this->deallocate(this->buffer, this->capacity);
+
+            this->buffer = new_buffer;
+            this->capacity = new_capacity;
         }
+        else
+        {
+            std::uninitialized_copy(data_a.begin(), data_a.end(), this->buffer + this->length);
+        }
+
+        this->length = new_length;
     }
 
     bool pop_back()
     {
-        if (this->length >= 0u)
+        if (false == this->is_empty())
         {
-            this->length--;
+            std::destroy_at(this->buffer + --this->length);
             return true;
         }
 
         return false;
     }
 
-    template<typename... Arg> void emplace_back(Arg&&... args_a)
+    template<typename... Arg> Type& emplace_back(Arg&&... args_a)
     {
-        this->resize(this->get_length() + 2u);
-        new (&(this->buffer[this->length++])) Type(std::forward<Arg>(args_a)...);
+        if (this->length == this->capacity)
+        {
+            const std::size_t new_capacity = this->get_grown_capacity(this->length + 1u);
+            Type* new_buffer = this->allocate(new_capacity);
+
+            // construct first: args_a may reference an element of the buffer being replaced
+            std::construct_at(new_buffer + this->length, std::forward<Arg>(args_a)...);
+            relocate(this->buffer, this->length, new_buffer);
+            this->deallocate(this->buffer, this->capacity);
+
+            this->buffer = new_buffer;
+            this->capacity = new_capacity;
+        }
+        else
+        {
+            std::construct_at(this->buffer + this->length, std::forward<Arg>(args_a)...);
+        }
+
+        return this->buffer[this->length++];
     }
 
     void resize(std::size_t capacity_a)
@@ -251,19 +305,21 @@ public:
             return;
         }
 
-        std::unique_ptr<Type[]> new_buffer = std::make_unique<Type[]>(capacity_a);
-
-        for (size_t i = 0; i < this->get_length(); i++)
-        {
-            new (&(new_buffer[i])) Type(std::move(this->buffer[i]));
-        }
-
-        this->buffer = std::move(new_buffer);
-        this->capacity = capacity_a;
+        this->reallocate(capacity_a);
     }
     void reserve(std::size_t length_a)
     {
         this->resize(length_a);
+
+        if (length_a > this->length)
+        {
+            std::uninitialized_default_construct(this->buffer + this->length, this->buffer + length_a);
+        }
+        else
+        {
+            std::destroy(this->buffer + length_a, this->buffer + this->length);
+        }
+
         this->length = length_a;
     }
 
@@ -271,22 +327,13 @@ public:
     {
         if (this->get_capacity() > this->get_length())
         {
-            std::unique_ptr<Type[]> new_buffer = std::make_unique<Type[]>(this->get_length());
-
-            for (size_t i = 0; i < this->get_length(); i++)
-            {
-                new (&(new_buffer[i])) Type(this->buffer[i]);
-            }
-
-            this->buffer = std::move(new_buffer);
-            this->capacity = this->get_length();
+            this->reallocate(this->get_length());
         }
     }
 
     void clear()
     {
-        this->buffer.release();
-        this->capacity = 0u;
+        std::destroy_n(this->buffer, this->length);
         this->length = 0u;
     }
 
@@ -318,11 +365,11 @@ public:
     }
     const Type* get_buffer() const
     {
-        return this->buffer.get();
+        return this->buffer;
     }
     Type* get_buffer()
     {
-        return this->buffer.get();
+        return this->buffer;
     }
 
     const Type& operator[](std::size_t index_a) const
@@ -337,64 +384,158 @@ public:
 
         return this->buffer[index_a];
     }
-    Vector<Type, 0u>& operator=(const Vector<Type, 0u>& other_a)
+    Vector<Type, 0u, Allocator>& operator=(const Vector<Type, 0u, Allocator>& other_a)
     {
-        std::unique_ptr<Type[]> new_buffer = std::make_unique<Type[]>(other_a.get_capacity());
-
-        for (size_t i = 0; i < other_a.get_length(); i++)
+        if (this != &other_a)
         {
-            new_buffer[i] = other_a[i];
-        }
+            this->clear();
+
+            if constexpr (true == Allocator_traits::propagate_on_container_copy_assignment::value)
+            {
+                if (this->allocator != other_a.allocator)
+                {
+                    this->deallocate(this->buffer, this->capacity);
 
-        this->buffer.release();
+                    this->buffer = nullptr;
+                    this->capacity = 0u;
+                }
 
-        this->buffer = std::move(new_buffer);
-        this->capacity = other_a.get_capacity();
-        this->length = other_a.get_length();
+                this->allocator = other_a.allocator;
+            }
+
+            if (this->capacity < other_a.get_length())
+            {
+                this->deallocate(this->buffer, this->capacity);
+
+                this->buffer = this->allocate(other_a.get_capacity());
+                this->capacity = other_a.get_capacity();
+            }
+
+            std::uninitialized_copy(other_a.buffer, other_a.buffer + other_a.length, this->buffer);
+            this->length = other_a.get_length();
+        }
 
         return *this;
     }
-    Vector<Type, 0u>& operator=(Vector<Type, 0u>&& other_a)
+    Vector<Type, 0u, Allocator>& operator=(Vector<Type, 0u, Allocator>&& other_a) noexcept(
+        Allocator_traits::propagate_on_container_move_assignment::value || Allocator_traits::is_always_equal::value)
     {
-        this->buffer.release();
+        if constexpr (false == Allocator_traits::propagate_on_container_move_assignment::value &&
+                      false == Allocator_traits::is_always_equal::value)
+        {
+            if (this->allocator != other_a.allocator)
+            {
+                // storage of other_a cannot be freed by our allocator, move the elements one by one
+                this->clear();
+                this->resize(other_a.length);
 
-        this->buffer = std::move(other_a.buffer);
-        this->capacity = other_a.get_capacity();
-        this->length = other_a.get_length();
+                std::uninitialized_move_n(other_a.buffer, other_a.length, this->buffer);
+                this->length = other_a.length;
 
-        other_a.capacity = 0u;
-        other_a.length = 0u;
+                other_a.clear();
+
+                return *this;
+            }
+        }
+
+        if (this != &other_a)
+        {
+            std::destroy_n(this->buffer, this->length);
+            this->deallocate(this->buffer, this->capacity);
+
+            if constexpr (true == Allocator_traits::propagate_on_container_move_assignment::value)
+            {
+                this->allocator = std::move(other_a.allocator);
+            }
+
+            this->buffer = other_a.buffer;
+            this->capacity = other_a.get_capacity();
+            this->length = other_a.get_length();
+
+            other_a.buffer = nullptr;
+            other_a.capacity = 0u;
+            other_a.length = 0u;
+        }
 
         return *this;
     }
 
+    const Allocator& get_allocator() const
+    {
+        return this->allocator;
+    }
+
     operator std::span<const Type>() const
     {
-        return std::span<const Type> { this->buffer.get(), this->length };
+        return std::span<const Type> { this->buffer, this->length };
     }
 
 private:
+    Type* allocate(std::size_t capacity_a)
+    {
+        return 0u != capacity_a ? Allocator_traits::allocate(this->allocator, capacity_a) : nullptr;
+    }
+    void deallocate(Type* buffer_a, std::size_t capacity_a)
+    {
+        if (nullptr != buffer_a)
+        {
+            Allocator_traits::deallocate(this->allocator, buffer_a, capacity_a);
+        }
+    }
+    static void relocate(Type* source_a, std::size_t length_a, Type* destination_a)
+    {
+        if constexpr (true == is_trivially_relocatable_v<Type>)
+        {
+            if (0u != length_a)
+            {
+                std::memcpy(static_cast<void*>(destination_a), static_cast<const void*>(source_a), length_a * sizeof(Type));
+            }
+        }
+        else
+        {
+            std::uninitialized_move_n(source_a, length_a, destination_a);
+            std::destroy_n(source_a, length_a);
+        }
+    }
+
+    std::size_t get_grown_capacity(std::size_t required_a) const
+    {
+        return std::max(required_a, this->capacity * 2u);
+    }
+    void reallocate(std::size_t capacity_a)
+    {
+        Type* new_buffer = this->allocate(capacity_a);
+
+        relocate(this->buffer, this->length, new_buffer);
+        this->deallocate(this->buffer, this->capacity);
+
+        this->buffer = new_buffer;
+        this->capacity = capacity_a;
+    }
+
+    [[no_unique_address]] Allocator allocator;
+
     std::size_t capacity = 0u;
     std::size_t length = 0u;
-    std::unique_ptr<Type[]> buffer;
+    Type* buffer = nullptr;
 };
 
-template<typename Type> Type* begin(Vector<Type>& vec_a)
+template<typename Type, typename Allocator> Type* begin(Vector<Type, 0u, Allocator>& vec_a)
 {
     return vec_a.get_buffer();
 }
 
-template<typename Type> Type* end(Vector<Type>& vec_a)
+template<typename Type, typename Allocator> Type* end(Vector<Type, 0u, Allocator>& vec_a)
 {
     return vec_a.get_buffer() + vec_a.get_length();
 }
 
-template<typename Type> const Type* begin(const Vector<Type>& vec_a)
+template<typename Type, typename Allocator> const Type* begin(const Vector<Type, 0u, Allocator>& vec_a)
 {
     return vec_a.get_buffer();
 }
 
-template<typename Type> const Type* end(const Vector<Type>& vec_a)
+template<typename Type, typename Allocator> const Type* end(const Vector<Type, 0u, Allocator>& vec_a)
 {
     return vec_a.get_buffer() + vec_a.get_length();
 }
@@ -0,0 +1,125 @@
+#pragma once
+
+/*
+ *   Name: CPU.hpp
+ *   Copyright (c) Mateusz Semegen and contributors. All rights reserved.
+ */
+
+// lx
+#include <lx/common/non_constructible.hpp>
+
+// std
+#include <cstdint>
+
+// intrinsics
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_AMD64))
+#include <immintrin.h>
+#include <intrin.h>
+#endif
+
+namespace lx::devices {
+struct CPU : private lx::common::non_constructible
+{
+    enum class Feature : std::uint64_t
+    {
+        none = 0x0u,
+        sse2 = 0x1u,
+        sse4_1 = 0x2u,
+        avx = 0x4u,
+        avx2 = 0x8u,
+        fma = 0x10u,
+        avx512f = 0x20u,
+        neon = 0x40u
+    };
+
+    using enum Feature;
+
+    /// @brief Instruction sets usable by the running process: supported by the CPU and, for AVX, enabled by the OS.
+    /// Detected once.
+    static Feature get_features()
+    {
+        static const Feature features = detect();
+        return features;
+    }
+    static bool has(Feature feature_a)
+    {
+        const std::uint64_t feature = static_cast<std::uint64_t>(feature_a);
+        return feature == (static_cast<std::uint64_t>(get_features()) & feature);
+    }
+
+private:
+    static Feature detect()
+    {
+        std::uint64_t features = 0x0u;
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_AMD64))
+        int info[4] = {};
+
+        __cpuid(info, 0);
+        const int max_leaf = info[0];
+
+        __cpuid(info, 1);
+        const bool sse2_supported = 0 != (info[3] & (1 << 26));
+        const bool sse4_1_supported = 0 != (info[2] & (1 << 19));
+        const bool fma_supported = 0 != (info[2] & (1 << 12));
+        const bool avx_supported = 0 != (info[2] & (1 << 28));
+        const bool os_saves_state = 0 != (info[2] & (1 << 27));
+
+        bool avx2_supported = false;
+        bool avx512f_supported = false;
+
+        if (max_leaf >= 7)
+        {
+            __cpuidex(info, 7, 0);
+            avx2_supported = 0 != (info[1] & (1 << 5));
+            avx512f_supported = 0 != (info[1] & (1 << 16));
+        }
+
+        // the OS has to save the ymm (bits 1, 2) and zmm (bits 5, 6, 7) registers on context switches
+        const std::uint64_t saved_state = true == os_saves_state ? _xgetbv(0) : 0x0u;
+        const bool ymm_saved = 0x6u == (saved_state & 0x6u);
+        const bool zmm_saved = 0xE6u == (saved_state & 0xE6u);
+
+        features |= true == sse2_supported ? static_cast<std::uint64_t>(Feature::sse2) : 0x0u;
+        features |= true == sse4_1_supported ? static_cast<std::uint64_t>(Feature::sse4_1) : 0x0u;
+        features |= true == avx_supported && true == ymm_saved ? static_cast<std::uint64_t>(Feature::avx) : 0x0u;
+        features |= true == avx2_supported && true == ymm_saved ? static_cast<std::uint64_t>(Feature::avx2) : 0x0u;
+        features |= true == fma_supported && true == ymm_saved ? static_cast<std::uint64_t>(Feature::fma) : 0x0u;
+        features |= true == avx512f_supported && true == zmm_saved ? static_cast<std::uint64_t>(Feature::avx512f) : 0x0u;
+#elif (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+        // the builtins check the OS support of the extended registers as well
+        __builtin_cpu_init();
+
+        features |= 0 != __builtin_cpu_supports("sse2") ? static_cast<std::uint64_t>(Feature::sse2) : 0x0u;
+        features |= 0 != __builtin_cpu_supports("sse4.1") ? static_cast<std::uint64_t>(Feature::sse4_1) : 0x0u;
+        features |= 0 != __builtin_cpu_supports("avx") ? static_cast<std::uint64_t>(Feature::avx) : 0x0u;
+        features |= 0 != __builtin_cpu_supports("avx2") ? static_cast<std::uint64_t>(Feature::avx2) : 0x0u;
+        features |= 0 != __builtin_cpu_supports("fma") ? static_cast<std::uint64_t>(Feature::fma) : 0x0u;
+        features |= 0 != __builtin_cpu_supports("avx512f") ? static_cast<std::uint64_t>(Feature::avx512f) : 0x0u;
+#elif defined(_M_ARM64) || defined(__aarch64__)
+        features |= static_cast<std::uint64_t>(Feature::neon);
+#endif
+
+        return static_cast<Feature>(features);
+    }
+};
+
+constexpr CPU::Feature operator|(CPU::Feature left_a, CPU::Feature right_a)
+{
+    return static_cast<CPU::Feature>(static_cast<std::uint64_t>(left_a) | static_cast<std::uint64_t>(right_a));
+}
+constexpr CPU::Feature operator&(CPU::Feature left_a, CPU::Feature right_a)
+{
+    return static_cast<CPU::Feature>(static_cast<std::uint64_t>(left_a) & static_cast<std::uint64_t>(right_a));
+}
+constexpr CPU::Feature operator|=(CPU::Feature& left_a, CPU::Feature right_a)
+{
+    left_a = left_a | right_a;
+    return left_a;
+}
+constexpr CPU::Feature operator&=(CPU::Feature& left_a, CPU::Feature right_a)
+{
+    left_a = left_a & right_a;
+    return left_a;
+}
+} // namespace lx::devices
@@ -0,0 +1,259 @@
+#pragma once
+
+/*
+ *   Name: Archetype.hpp
+ *   Copyright (c) Mateusz Semegen and contributors. All rights reserved.
+ */
+
+// lx
+#include <lx/common/non_copyable.hpp>
+#include <lx/containers/FlatMap.hpp>
+#include <lx/containers/Vector.hpp>
+#include <lx/ecs/Component.hpp>
+#include <lx/ecs/Entity.hpp>
+#include <lx/memory/Allocator.hpp>
+#include <lx/memory/Resource.hpp>
+
+// std
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+
+namespace lx::ecs {
+
+/// @brief Storage of the entities which have exactly the same components. The rows live in chunks of chunk_size bytes, each laid
+/// out as structure of arrays: the entities, then one cache line aligned array per component, so a system walks contiguous
+/// memory of only the components it uses. Every chunk but the last one is full, removing a row moves the last row of the
+/// archetype into the gap.
+class Archetype : private lx::common::non_copyable
+{
+public:
+    constexpr static std::size_t chunk_size = 16u * 1024u;
+    constexpr static std::size_t column_alignment = 64u;
+
+    struct Chunk
+    {
+        std::byte* data = nullptr;
+        std::size_t length = 0u;
+    };
+
+    struct Location
+    {
+        std::uint32_t chunk = 0u;
+        std::uint32_t row = 0u;
+    };
+
+    Archetype(const Signature& signature_a, lx::memory::Resource& resource_a)
+        : resource(&resource_a)
+        , signature(signature_a)
+        , component_ids(lx::memory::Allocator<ComponentId>(resource_a))
+        , columns(lx::memory::Allocator<Column>(resource_a))
+        , chunks(lx::memory::Allocator<Chunk>(resource_a))
+        , edges(lx::memory::Allocator<std::byte>(resource_a))
+    {
+        this->column_indices.fill(npos);
+
+        std::size_t row_size = sizeof(Entity);
+        signature_a.for_each([&](ComponentId id_a) {
+            this->column_indices[id_a] = static_cast<std::uint8_t>(this->columns.get_length());
+            this->component_ids.push_back(id_a);
+            this->columns.push_back({ .info = &Components::get_info(id_a), .offset = 0u });
+
+            row_size += Components::get_info(id_a).size;
+        });
+
+        // each array start is rounded up to a cache line, at most column_alignment - 1 bytes of padding per array
+        const std::size_t padding = column_alignment * (this->columns.get_length() + 1u);
+        assert(chunk_size > padding + row_size && "components too big for a chunk");
+
+        this->capacity = (chunk_size - padding) / row_size;
+
+        std::size_t offset = align(this->capacity * sizeof(Entity));
+        for (Column& column : this->columns)
+        {
+            column.offset = offset;
+            offset = align(offset + this->capacity * column.info->size);
+        }
+
+        assert(offset <= chunk_size);
+    }
+    ~Archetype()
+    {
+        for (Chunk& chunk : this->chunks)
+        {
+            for (const Column& column : this->columns)
+            {
+                for (std::size_t row = 0u; row < chunk.length; row++)
+                {
+                    column.info->destroy(chunk.data + column.offset + row * column.info->size);
+                }
+            }
+
+            this->resource->deallocate(chunk.data, chunk_size, column_alignment);
+        }
+    }
+
+    /// @brief Adds a row for entity_a with uninitialized components, the caller constructs every one of them.
+    Location allocate(Entity entity_a)
+    {
+        if (true == this->chunks.is_empty() || this->capacity == this->chunks.get_back().length)
+        {
+            this->chunks.push_back(
+                { .data = static_cast<std::byte*>(this->resource->allocate(chunk_size, column_alignment)), .length = 0u });
+        }
+
+        Chunk& chunk = this->chunks.get_back();
+        const Location location = { .chunk = static_cast<std::uint32_t>(this->chunks.get_length() - 1u),
+                                    .row = static_cast<std::uint32_t>(chunk.length++) };
+
+        this->get_entities(chunk)[location.row] = entity_a;
+        this->length++;
+
+        return location;
+    }
+    /// @brief Removes the row by relocating the last row into it. Components of the row are destroyed, except the ones already
+    /// moved out (skip_a). Returns the entity which took the row or a null entity when the removed row was the last one.
+    Entity deallocate(Location location_a, const Signature& skip_a = {})
+    {
+        Chunk& chunk = this->chunks[location_a.chunk];
+        Chunk& last_chunk = this->chunks.get_back();
+        const std::size_t last_row = last_chunk.length - 1u;
+
+        for (std::size_t i = 0u; i < this->columns.get_length(); i++)
+        {
+            if (false == skip_a.has(this->component_ids[i]))
+            {
+                this->columns[i].info->destroy(this->get_component(i, chunk, location_a.row));
+            }
+        }
+
+        Entity moved;
+
+        if (&chunk != &last_chunk || location_a.row != last_row)
+        {
+            for (std::size_t i = 0u; i < this->columns.get_length(); i++)
+            {
+                this->columns[i].info->relocate(this->get_component(i, chunk, location_a.row),
+                                                this->get_component(i, last_chunk, last_row));
+            }
+
+            moved = this->get_entities(last_chunk)[last_row];
+            this->get_entities(chunk)[location_a.row] = moved;
+        }
+
+        this->length--;
+
+        if (0u == --last_chunk.length)
+        {
+            this->resource->deallocate(last_chunk.data, chunk_size, column_alignment);
+            this->chunks.pop_back();
+        }
+
+        return moved;
+    }
+
+    /// @brief Component id_a of a row or nullptr when the archetype does not have it.
+    void* get_component(ComponentId id_a, Location location_a)
+    {
+        const std::uint8_t column = this->column_indices[id_a];
+
+        return npos != column ? this->get_component(column, this->chunks[location_a.chunk], location_a.row) : nullptr;
+    }
+    /// @brief Array of component id_a in chunk_a, the archetype must have the component.
+    void* get_array(ComponentId id_a, const Chunk& chunk_a) const
+    {
+        assert(npos != this->column_indices[id_a]);
+        return chunk_a.data + this->columns[this->column_indices[id_a]].offset;
+    }
+    Entity* get_entities(const Chunk& chunk_a) const
+    {
+        return reinterpret_cast<Entity*>(chunk_a.data);
+    }
+
+    /// @brief Archetype with one more (is_remove_a false) or one less component, cached to make the next move a single lookup.
+    Archetype** find_edge(ComponentId id_a, bool is_remove_a)
+    {
+        return this->edges.find(get_edge_key(id_a, is_remove_a));
+    }
+    void add_edge(ComponentId id_a, bool is_remove_a, Archetype* archetype_a)
+    {
+        this->edges[get_edge_key(id_a, is_remove_a)] = archetype_a;
+    }
+
+    const Signature& get_signature() const
+    {
+        return this->signature;
+    }
+    std::span<const ComponentId> get_component_ids() const
+    {
+        return this->component_ids;
+    }
+    std::span<Chunk> get_chunks()
+    {
+        return { this->chunks.get_buffer(), this->chunks.get_length() };
+    }
+    std::span<const Chunk> get_chunks() const
+    {
+        return this->chunks;
+    }
+    /// @brief Rows per chunk.
+    std::size_t get_capacity() const
+    {
+        return this->capacity;
+    }
+    std::size_t get_length() const
+    {
+        return this->length;
+    }
+    bool is_empty() const
+    {
+        return 0u == this->length;
+    }
+
+private:
+    constexpr static std::uint8_t npos = std::numeric_limits<std::uint8_t>::max();
+
+    struct Column
+    {
+        const ComponentInfo* info;
+        std::size_t offset;
+    };
+
+    static std::size_t align(std::size_t offset_a)
+    {
+        return (offset_a + column_alignment - 1u) & ~(column_alignment - 1u);
+    }
+    static std::uint32_t get_edge_key(ComponentId id_a, bool is_remove_a)
+    {
+        return static_cast<std::uint32_t>(id_a) | (true == is_remove_a ? 0x80000000u : 0u);
+    }
+
+    void* get_component(std::size_t column_a, const Chunk& chunk_a, std::size_t row_a) const
+    {
+        const Column& column = this->columns[column_a];
+        return chunk_a.data + column.offset + row_a * column.info->size;
+    }
+
+    lx::memory::Resource* resource;
+
+    Signature signature;
+    std::array<std::uint8_t, Components::max_count> column_indices;
+    lx::containers::Vector<ComponentId, 0u, lx::memory::Allocator<ComponentId>> component_ids;
+    lx::containers::Vector<Column, 0u, lx::memory::Allocator<Column>> columns;
+
+    lx::containers::Vector<Chunk, 0u, lx::memory::Allocator<Chunk>> chunks;
+    std::size_t capacity = 0u;
+    std::size_t length = 0u;
+
+    lx::containers::FlatMap<std::uint32_t,
+                            Archetype*,
+                            lx::containers::Hash<std::uint32_t>,
+                            lx::containers::Equal<std::uint32_t>,
+                            lx::memory::Allocator<std::byte>>
+        edges;
+};
+} // namespace lx::ecs
@@ -0,0 +1,153 @@
+#pragma once
+
+/*
+ *   Name: Commands.hpp
+ *   Copyright (c) Mateusz Semegen and contributors. All rights reserved.
+ */
+
+// lx
+#include <lx/common/non_copyable.hpp>
+#include <lx/containers/Vector.hpp>
+#include <lx/ecs/Component.hpp>
+#include <lx/ecs/Entity.hpp>
+#include <lx/memory/Allocator.hpp>
+#include <lx/memory/Arena.hpp>
+
+// std
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace lx::ecs {
+
+/// @brief Structural changes recorded while a World is iterated and applied later by World::apply, in the order of recording.
+/// The components are moved into an arena, which is reset when the commands are applied or cleared.
+/// Recording is not thread safe, every thread (or system) records to its own buffer. An entity created by the commands is known by
+/// a placeholder until they are applied, the placeholder can be the target of the commands recorded after the create.
+class Commands : private lx::common::non_copyable
+{
+public:
+    explicit Commands(std::size_t capacity_a = 64u * 1024u, lx::memory::Resource& resource_a = lx::memory::Heap::get_default())
+        : arena(capacity_a, resource_a)
+        , commands(lx::memory::Allocator<Command>(resource_a))
+        , created(lx::memory::Allocator<Entity>(resource_a))
+    {
+    }
+    ~Commands()
+    {
+        this->clear();
+    }
+
+    /// @brief Creates an entity with the components. Returns the placeholder of the entity, valid in these commands only and
+    /// until they are applied or cleared.
+    template<typename... Type>
+        requires(component<std::remove_cvref_t<Type>> && ...)
+    Entity create(Type&&... components_a)
+    {
+        assert(this->created_count < Entity::index_mask);
+
+        this->commands.push_back({ .kind = Kind::create, .entity = {}, .component = 0u, .payload = nullptr });
+        (this->push(Kind::add, Entity {}, std::forward<Type>(components_a)), ...);
+
+        // the last generation is never given to an alive entity, so placeholders do not alias entities of the world
+        return { .value = (Entity::generation_mask << Entity::index_bits) | this->created_count++ };
+    }
+    void destroy(Entity entity_a)
+    {
+        assert(false == entity_a.is_null());
+        this->commands.push_back({ .kind = Kind::destroy, .entity = entity_a, .component = 0u, .payload = nullptr });
+    }
+    /// @brief Adds the component, replaces it when the entity already has one.
+    template<typename Type>
+        requires component<std::remove_cvref_t<Type>>
+    void add(Entity entity_a, Type&& component_a)
+    {
+        assert(false == entity_a.is_null());
+        this->push(Kind::add, entity_a, std::forward<Type>(component_a));
+    }
+    template<component Type> void remove(Entity entity_a)
+    {
+        assert(false == entity_a.is_null());
+        this->commands.push_back({ .kind = Kind::remove, .entity = entity_a, .component = Components::get_id<Type>(), .payload = nullptr });
+    }
+
+    /// @brief Drops the recorded commands.
+    void clear()
+    {
+        for (const Command& command : this->commands)
+        {
+            if (nullptr != command.payload)
+            {
+                Components::get_info(command.component).destroy(command.payload);
+            }
+        }
+
+        this->commands.clear();
+        this->created.clear();
+        this->created_count = 0u;
+        this->arena.reset();
+    }
+
+    std::size_t get_length() const
+    {
+        return this->commands.get_length();
+    }
+    bool is_empty() const
+    {
+        return this->commands.is_empty();
+    }
+
+private:
+    friend class World;
+
+    enum class Kind : std::uint8_t
+    {
+        create,
+        destroy,
+        add,
+        remove
+    };
+
+    // add commands with a null entity follow a create and target the created entity, the payload is set to nullptr once it
+    // was moved into the world
+    struct Command
+    {
+        Kind kind = Kind::create;
+        Entity entity;
+        ComponentId component = 0u;
+        void* payload = nullptr;
+    };
+
+    // the entity created for the placeholder entity_a by World::apply, entity_a itself when it is not a placeholder
+    Entity resolve(Entity entity_a) const
+    {
+        if (Entity::generation_mask != entity_a.get_generation() || true == entity_a.is_null())
+        {
+            return entity_a;
+        }
+
+        assert(entity_a.get_index() < this->created.get_length() && "placeholder of other commands");
+        return this->created[entity_a.get_index()];
+    }
+
+    template<typename Type> void push(Kind kind_a, Entity entity_a, Type&& component_a)
+    {
+        using Component = std::remove_cvref_t<Type>;
+
+        void* payload = this->arena.allocate(sizeof(Component), alignof(Component));
+        std::construct_at(static_cast<Component*>(payload), std::forward<Type>(component_a));
+
+        this->commands.push_back({ .kind = kind_a, .entity = entity_a, .component = Components::get_id<Component>(), .payload = payload });
+    }
+
+    lx::memory::Arena arena;
+    lx::containers::Vector<Command, 0u, lx::memory::Allocator<Command>> commands;
+
+    // entities created by World::apply, in the order of the placeholders
+    lx::containers::Vector<Entity, 0u, lx::memory::Allocator<Entity>> created;
+    std::uint32_t created_count = 0u;
+};
+} // namespace lx::ecs
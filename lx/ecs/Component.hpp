@@ -0,0 +1,202 @@
+#pragma once
+
+/*
+ *   Name: Component.hpp
+ *   Copyright (c) Mateusz Semegen and contributors. All rights reserved.
+ */
+
+// lx
+#include <lx/common/non_constructible.hpp>
+
+// std
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace lx::ecs {
+
+using ComponentId = std::uint32_t;
+
+/// @brief Any type which can be moved without throwing can be a component, empty types make tags.
+template<typename Type>
+concept component = std::is_object_v<Type> && std::is_nothrow_move_constructible_v<std::remove_cv_t<Type>> &&
+                    std::is_nothrow_destructible_v<std::remove_cv_t<Type>> && alignof(Type) <= 64u;
+
+/// @brief What an archetype needs to know to store a component without its type.
+struct ComponentInfo
+{
+    std::size_t size = 0u;
+    std::size_t alignment = 0u;
+
+    // moves the component to uninitialized destination_a and destroys the source
+    void (*relocate)(void* destination_a, void* source_a) = nullptr;
+    void (*destroy)(void* pointer_a) = nullptr;
+};
+
+/// @brief Ids of the component types, given at run time in order of the first use and shared by every World.
+struct Components : private lx::common::non_constructible
+{
+    constexpr static std::size_t max_count = 128u;
+
+    template<component Type> static ComponentId get_id()
+    {
+        return get_unqualified_id<std::remove_cv_t<Type>>();
+    }
+    static const ComponentInfo& get_info(ComponentId id_a)
+    {
+        assert(id_a < get_count());
+        return get_infos()[id_a];
+    }
+    static std::size_t get_count()
+    {
+        return get_next_id().load(std::memory_order_acquire);
+    }
+
+private:
+    template<typename Type> static ComponentId get_unqualified_id()
+    {
+        static const ComponentId id = add<Type>();
+        return id;
+    }
+    template<typename Type> static ComponentId add()
+    {
+        const ComponentId id = get_next_id().fetch_add(1u, std::memory_order_acq_rel);
+        assert(id < max_count && "too many component types");
+
+        get_infos()[id] = { .size = sizeof(Type),
+                            .alignment = alignof(Type),
+                            .relocate =
+                                [](void* destination_a, void* source_a) {
+                                    Type* source = static_cast<Type*>(source_a);
+
+                                    std::construct_at(static_cast<Type*>(destination_a), std::move(*source));
+                                    std::destroy_at(source);
+                                },
+                            .destroy = [](void* pointer_a) { std::destroy_at(static_cast<Type*>(pointer_a)); } };
+
+        return id;
+    }
+
+    static std::array<ComponentInfo, max_count>& get_infos()
+    {
+        static std::array<ComponentInfo, max_count> infos;
+        return infos;
+    }
+    static std::atomic<ComponentId>& get_next_id()
+    {
+        static std::atomic<ComponentId> next_id = 0u;
+        return next_id;
+    }
+};
+
+/// @brief A set of component ids: the key of an archetype and of a query.
+class Signature
+{
+public:
+    template<component... Type> static Signature of()
+    {
+        Signature signature;
+        (signature.set(Components::get_id<Type>()), ...);
+
+        return signature;
+    }
+
+    void set(ComponentId id_a)
+    {
+        assert(id_a < Components::max_count);
+        this->words[id_a / 64u] |= 1ull << (id_a % 64u);
+    }
+    void reset(ComponentId id_a)
+    {
+        assert(id_a < Components::max_count);
+        this->words[id_a / 64u] &= ~(1ull << (id_a % 64u));
+    }
+
+    bool has(ComponentId id_a) const
+    {
+        return 0u != (this->words[id_a / 64u] & (1ull << (id_a % 64u)));
+    }
+    /// @brief Whether every component of other_a is in the signature.
+    bool contains(const Signature& other_a) const
+    {
+        for (std::size_t i = 0u; i < words_count; i++)
+        {
+            if ((this->words[i] & other_a.words[i]) != other_a.words[i])
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+    /// @brief Whether any component of other_a is in the signature.
+    bool intersects(const Signature& other_a) const
+    {
+        for (std::size_t i = 0u; i < words_count; i++)
+        {
+            if (0u != (this->words[i] & other_a.words[i]))
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    std::size_t get_count() const
+    {
+        std::size_t count = 0u;
+
+        for (const std::uint64_t word : this->words)
+        {
+            count += static_cast<std::size_t>(std::popcount(word));
+        }
+
+        return count;
+    }
+    bool is_empty() const
+    {
+        return 0u == this->get_count();
+    }
+
+    /// @brief Calls function_a with every component id, in increasing order.
+    template<typename Function> void for_each(Function&& function_a) const
+    {
+        for (std::size_t i = 0u; i < words_count; i++)
+        {
+            for (std::uint64_t word = this->words[i]; 0u != word; word &= word - 1u)
+            {
+                function_a(static_cast<ComponentId>(i * 64u + static_cast<std::size_t>(std::countr_zero(word))));
+            }
+        }
+    }
+
+    std::uint64_t get_hash() const
+    {
+        return this->words[0] * 0x9E3779B97F4A7C15u ^ this->words[1];
+    }
+
+    bool operator==(const Signature&) const = default;
+
+private:
+    constexpr static std::size_t words_count = Components::max_count / 64u;
+
+    std::uint64_t words[words_count] = {};
+};
+} // namespace lx::ecs
+
+template<> struct std::hash<lx::ecs::Signature>
+{
+    std::size_t operator()(const lx::ecs::Signature& signature_a) const
+    {
+        return static_cast<std::size_t>(signature_a.get_hash());
+    }
+};
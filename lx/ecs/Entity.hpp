@@ -0,0 +1,21 @@
+#pragma once
+
+/*
+ *   Name: Entity.hpp
+ *   Copyright (c) Mateusz Semegen and contributors. All rights reserved.
+ */
+
+// lx
+#include <lx/common/Handle.hpp>
+
+// std
+#include <cstdint>
+
+namespace lx::ecs {
+
+class World;
+
+/// @brief A handle of an entity of a World: a 20 bit index and a 12 bit generation, bumped when the entity is destroyed, so
+/// handles of destroyed entities are detected instead of aliasing a new one.
+using Entity = lx::common::Handle<std::uint32_t, World>;
+} // namespace lx::ecs
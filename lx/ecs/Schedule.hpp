@@ -0,0 +1,305 @@
+#pragma once
+
+/*
+ *   Name: Schedule.hpp
+ *   Copyright (c) Mateusz Semegen and contributors. All rights reserved.
+ */
+
+// lx
+#include <lx/common/non_copyable.hpp>
+#include <lx/containers/Vector.hpp>
+#include <lx/ecs/Archetype.hpp>
+#include <lx/ecs/Commands.hpp>
+#include <lx/ecs/Component.hpp>
+#include <lx/ecs/Entity.hpp>
+#include <lx/ecs/World.hpp>
+#include <lx/jobs/Scheduler.hpp>
+#include <lx/memory/Allocator.hpp>
+#include <lx/memory/Resource.hpp>
+
+// std
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+namespace lx::ecs {
+
+/// @brief Systems of a frame, run in parallel on a jobs::Scheduler. A system declares the components it accesses as template
+/// arguments of add(), a const component is read, any other is written. Two systems conflict when one of them writes a component
+/// the other one accesses: the later added one then runs after the earlier one, the systems which do not conflict run at the
+/// same time. A system is called for every chunk (View) or every entity of its query, the chunks are split between the workers.
+/// A system can take Commands& as the first argument, its structural changes are applied when the frame is done, in the order
+/// in which the systems were added. Such system runs as a single job, as Commands are not thread safe.
+class Schedule : private lx::common::non_copyable
+{
+public:
+    explicit Schedule(lx::memory::Resource& resource_a = lx::memory::Heap::get_default())
+        : resource(&resource_a)
+        , systems(lx::memory::Allocator<System*>(resource_a))
+    {
+    }
+    ~Schedule()
+    {
+        for (System* system : this->systems)
+        {
+            system->destroy(system->function, *this->resource);
+
+            if (nullptr != system->commands)
+            {
+                std::destroy_at(system->commands);
+                this->resource->deallocate(system->commands, sizeof(Commands), alignof(Commands));
+            }
+
+            std::destroy_at(system);
+            this->resource->deallocate(system, sizeof(System), alignof(System));
+        }
+    }
+
+    /// @brief Adds a system: function_a(const View<Type...>&), function_a(Entity, Type&...) or function_a(Type&...), each
+    /// optionally preceded by Commands&. Returns the index of the system.
+    template<component... Type, typename Function> std::size_t add(Function&& function_a)
+    {
+        using Callable = std::remove_cvref_t<Function>;
+
+        static_assert(sizeof...(Type) > 0u, "a system accesses at least one component");
+        static_assert(is_system<Callable, false, Type...> || is_system<Callable, true, Type...>, "not callable with the components");
+
+        System* system = static_cast<System*>(this->resource->allocate(sizeof(System), alignof(System)));
+        std::construct_at(system, lx::memory::Allocator<std::byte>(*this->resource));
+
+        Callable* function = static_cast<Callable*>(this->resource->allocate(sizeof(Callable), alignof(Callable)));
+        std::construct_at(function, std::forward<Function>(function_a));
+
+        system->function = function;
+        system->run = &run_chunk<Callable, Type...>;
+        system->destroy = [](void* function_a, lx::memory::Resource& resource_a) {
+            std::destroy_at(static_cast<Callable*>(function_a));
+            resource_a.deallocate(function_a, sizeof(Callable), alignof(Callable));
+        };
+
+        system->query = Signature::of<Type...>();
+        ((false == std::is_const_v<Type> ? system->writes.set(Components::get_id<Type>()) : void()), ...);
+        assert(system->query.get_count() == sizeof...(Type) && "duplicated component");
+
+        if constexpr (true == is_system<Callable, true, Type...>)
+        {
+            system->commands = static_cast<Commands*>(this->resource->allocate(sizeof(Commands), alignof(Commands)));
+            std::construct_at(system->commands, commands_capacity, *this->resource);
+        }
+
+        const std::uint32_t index = static_cast<std::uint32_t>(this->systems.get_length());
+
+        for (std::uint32_t i = 0u; i < index; i++)
+        {
+            System* other = this->systems[i];
+
+            if (true == other->writes.intersects(system->query) || true == system->writes.intersects(other->query))
+            {
+                other->successors.push_back(index);
+                system->predecessors.push_back(i);
+            }
+        }
+
+        this->systems.push_back(system);
+
+        return index;
+    }
+
+    /// @brief Runs every system on the scheduler and the calling thread, which must be one of its threads, and returns when all
+    /// of them are done and their commands are applied.
+    void run(World& world_a, lx::jobs::Scheduler& scheduler_a)
+    {
+        this->prepare(world_a);
+
+        lx::jobs::Counter counter;
+
+        for (System* system : this->systems)
+        {
+            if (true == system->predecessors.is_empty())
+            {
+                this->start(system, scheduler_a, counter);
+            }
+        }
+
+        scheduler_a.wait(counter);
+        this->apply(world_a);
+    }
+    /// @brief Runs every system on the calling thread, in the order in which they were added.
+    void run(World& world_a)
+    {
+        this->prepare(world_a);
+
+        for (System* system : this->systems)
+        {
+            for (const Chunk_reference& chunk : system->chunks)
+            {
+                system->run(system->function, *chunk.archetype, *chunk.chunk, system->commands);
+            }
+        }
+
+        this->apply(world_a);
+    }
+
+    /// @brief Indices of the systems which run before system index_a because of the components they share.
+    std::span<const std::uint32_t> get_dependencies(std::size_t index_a) const
+    {
+        return this->systems[index_a]->predecessors;
+    }
+    std::size_t get_systems_count() const
+    {
+        return this->systems.get_length();
+    }
+
+private:
+    constexpr static std::size_t commands_capacity = 4u * 1024u;
+
+    template<typename Function, bool with_commands, typename... Type>
+    constexpr static bool is_system = true == with_commands ? std::invocable<Function&, Commands&, const View<Type...>&> ||
+                                                                  std::invocable<Function&, Commands&, Entity, Type&...> ||
+                                                                  std::invocable<Function&, Commands&, Type&...>
+                                                            : std::invocable<Function&, const View<Type...>&> ||
+                                                                  std::invocable<Function&, Entity, Type&...> ||
+                                                                  std::invocable<Function&, Type&...>;
+
+    struct Chunk_reference
+    {
+        const Archetype* archetype;
+        const Archetype::Chunk* chunk;
+    };
+
+    struct System
+    {
+        explicit System(const lx::memory::Allocator<std::byte>& allocator_a)
+            : chunks(allocator_a)
+            , predecessors(allocator_a)
+            , successors(allocator_a)
+        {
+        }
+
+        void* function = nullptr;
+        void (*run)(void* function_a, const Archetype& archetype_a, const Archetype::Chunk& chunk_a, Commands* commands_a) = nullptr;
+        void (*destroy)(void* function_a, lx::memory::Resource& resource_a) = nullptr;
+
+        Signature query;
+        Signature writes;
+        Commands* commands = nullptr;
+
+        lx::containers::Vector<Chunk_reference, 0u, lx::memory::Allocator<Chunk_reference>> chunks;
+        lx::containers::Vector<std::uint32_t, 0u, lx::memory::Allocator<std::uint32_t>> predecessors;
+        lx::containers::Vector<std::uint32_t, 0u, lx::memory::Allocator<std::uint32_t>> successors;
+
+        // predecessors not done yet in the current frame
+        std::atomic<std::uint32_t> pending = 0u;
+    };
+
+    template<typename Function, typename... Type>
+    static void run_chunk(void* function_a, const Archetype& archetype_a, const Archetype::Chunk& chunk_a, Commands* commands_a)
+    {
+        Function& function = *static_cast<Function*>(function_a);
+        const View<Type...> view(archetype_a, chunk_a);
+
+        if constexpr (std::invocable<Function&, const View<Type...>&>)
+        {
+            function(view);
+        }
+        else if constexpr (std::invocable<Function&, Commands&, const View<Type...>&>)
+        {
+            function(*commands_a, view);
+        }
+        else if constexpr (true == is_system<Function, true, Type...>)
+        {
+            view.each([&](Entity entity_a, Type&... components_a) {
+                if constexpr (std::invocable<Function&, Commands&, Entity, Type&...>)
+                {
+                    function(*commands_a, entity_a, components_a...);
+                }
+                else
+                {
+                    function(*commands_a, components_a...);
+                }
+            });
+        }
+        else
+        {
+            view.each(function);
+        }
+    }
+
+    // the queries update their caches, so the chunks are gathered on one thread before any system starts
+    void prepare(World& world_a)
+    {
+        for (System* system : this->systems)
+        {
+            system->chunks.clear();
+            system->pending.store(static_cast<std::uint32_t>(system->predecessors.get_length()), std::memory_order_relaxed);
+
+            for (const Archetype* archetype : world_a.get_archetypes(system->query))
+            {
+                for (const Archetype::Chunk& chunk : archetype->get_chunks())
+                {
+                    system->chunks.push_back({ .archetype = archetype, .chunk = &chunk });
+                }
+            }
+        }
+    }
+    void apply(World& world_a)
+    {
+        for (System* system : this->systems)
+        {
+            if (nullptr != system->commands)
+            {
+                world_a.apply(*system->commands);
+            }
+        }
+    }
+
+    // the successors are submitted before the job of system_a returns, so counter_a is done only after the last system
+    void start(System* system_a, lx::jobs::Scheduler& scheduler_a, lx::jobs::Counter& counter_a)
+    {
+        scheduler_a.submit(counter_a, [this, system_a, &scheduler_a, &counter_a]() {
+            const std::size_t count = system_a->chunks.get_length();
+
+            if (nullptr != system_a->commands || count < 2u || 1u == scheduler_a.get_workers_count())
+            {
+                for (const Chunk_reference& chunk : system_a->chunks)
+                {
+                    system_a->run(system_a->function, *chunk.archetype, *chunk.chunk, system_a->commands);
+                }
+            }
+            else
+            {
+                // a few ranges per worker leave room for stealing when the chunks are not equally expensive
+                const std::size_t grain = std::max<std::size_t>(count / (scheduler_a.get_workers_count() * 4u), 1u);
+
+                scheduler_a.parallel_for(0u, count, grain, [system_a](std::size_t begin_a, std::size_t end_a) {
+                    for (std::size_t i = begin_a; i < end_a; i++)
+                    {
+                        const Chunk_reference& chunk = system_a->chunks[i];
+                        system_a->run(system_a->function, *chunk.archetype, *chunk.chunk, nullptr);
+                    }
+                });
+            }
+
+            for (const std::uint32_t index : system_a->successors)
+            {
+                System* successor = this->systems[index];
+
+                if (1u == successor->pending.fetch_sub(1u, std::memory_order_acq_rel))
+                {
+                    this->start(successor, scheduler_a, counter_a);
+                }
+            }
+        });
+    }
+
+    lx::memory::Resource* resource;
+    lx::containers::Vector<System*, 0u, lx::memory::Allocator<System*>> systems;
+};
+} // namespace lx::ecs
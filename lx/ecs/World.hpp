@@ -0,0 +1,544 @@
+#pragma once
+
+/*
+ *   Name: World.hpp
+ *   Copyright (c) Mateusz Semegen and contributors. All rights reserved.
+ */
+
+// lx
+#include <lx/common/non_copyable.hpp>
+#include <lx/containers/FlatMap.hpp>
+#include <lx/containers/Vector.hpp>
+#include <lx/ecs/Archetype.hpp>
+#include <lx/ecs/Commands.hpp>
+#include <lx/ecs/Component.hpp>
+#include <lx/ecs/Entity.hpp>
+#include <lx/memory/Allocator.hpp>
+#include <lx/memory/Resource.hpp>
+
+// std
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace lx::ecs {
+
+/// @brief The rows of one chunk seen through the components Type..., const components are read only.
+template<component... Type> class View
+{
+public:
+    View(const Archetype& archetype_a, const Archetype::Chunk& chunk_a)
+        : entities(archetype_a.get_entities(chunk_a))
+        , length(chunk_a.length)
+        , arrays(static_cast<Type*>(archetype_a.get_array(Components::get_id<Type>(), chunk_a))...)
+    {
+    }
+
+    /// @brief Calls function_a with the components of every row, preceded by the entity when function_a takes it.
+    template<typename Function> void each(Function&& function_a) const
+    {
+        [&]<std::size_t... indices>(std::index_sequence<indices...>) {
+            for (std::size_t i = 0u; i < this->length; i++)
+            {
+                if constexpr (std::invocable<Function&, Entity, Type&...>)
+                {
+                    function_a(this->entities[i], std::get<indices>(this->arrays)[i]...);
+                }
+                else
+                {
+                    function_a(std::get<indices>(this->arrays)[i]...);
+                }
+            }
+        }(std::index_sequence_for<Type...> {});
+    }
+
+    /// @brief Array of one of the components, qualified as in the view.
+    template<typename Component> std::span<Component> get() const
+    {
+        return { std::get<Component*>(this->arrays), this->length };
+    }
+    std::span<const Entity> get_entities() const
+    {
+        return { this->entities, this->length };
+    }
+    std::size_t get_length() const
+    {
+        return this->length;
+    }
+
+private:
+    const Entity* entities;
+    std::size_t length;
+    std::tuple<Type*...> arrays;
+};
+
+/// @brief Entities and their components, stored by archetype: every set of components has its own chunked storage (Archetype).
+/// Adding or removing a component moves the entity to another archetype, the moves are cached in the archetype graph.
+/// A query keyed by a signature caches the archetypes having its components and picks up new archetypes as they appear.
+/// Not thread safe. Iteration must not change the structure (create, destroy, add, remove), such changes are recorded in
+/// Commands and applied after the iteration. Up to 2^20 - 1 entities are alive at once.
+class World : private lx::common::non_copyable
+{
+public:
+    explicit World(lx::memory::Resource& resource_a = lx::memory::Heap::get_default())
+        : resource(&resource_a)
+        , records(lx::memory::Allocator<Record>(resource_a))
+        , archetypes(lx::memory::Allocator<Archetype*>(resource_a))
+        , archetypes_by_signature(lx::memory::Allocator<std::byte>(resource_a))
+        , queries(lx::memory::Allocator<Query>(resource_a))
+        , queries_by_signature(lx::memory::Allocator<std::byte>(resource_a))
+    {
+    }
+    ~World()
+    {
+        for (Archetype* archetype : this->archetypes)
+        {
+            std::destroy_at(archetype);
+            this->resource->deallocate(archetype, sizeof(Archetype), alignof(Archetype));
+        }
+    }
+
+    template<typename... Type>
+        requires(component<std::remove_cvref_t<Type>> && ...)
+    Entity create(Type&&... components_a)
+    {
+        const Signature signature = Signature::of<std::remove_cvref_t<Type>...>();
+        assert(signature.get_count() == sizeof...(Type) && "duplicated component");
+
+        const Entity entity = this->create_entity(signature);
+        const Record& record = this->records[entity.get_index()];
+
+        (std::construct_at(static_cast<std::remove_cvref_t<Type>*>(record.archetype->get_component(
+                               Components::get_id<std::remove_cvref_t<Type>>(), record.location)),
+                           std::forward<Type>(components_a)),
+         ...);
+
+        return entity;
+    }
+    /// @brief Destroys the entity and its components. Returns false when the entity is not alive.
+    bool destroy(Entity entity_a)
+    {
+        assert(0u == this->iterations);
+
+        if (false == this->is_alive(entity_a))
+        {
+            return false;
+        }
+
+        const std::size_t index = entity_a.get_index();
+        Record& record = this->records[index];
+
+        this->remove_row(record);
+
+        // a wrapped generation would make the oldest stale entities alive again, such records are retired instead of reused
+        record.archetype = nullptr;
+        record.generation = (record.generation + 1u) & Entity::generation_mask;
+        record.next_free = this->free_head;
+
+        if (Entity::generation_mask != record.generation)
+        {
+            this->free_head = static_cast<std::uint32_t>(index);
+        }
+
+        this->alive_count--;
+
+        return true;
+    }
+
+    bool is_alive(Entity entity_a) const
+    {
+        const std::size_t index = entity_a.get_index();
+
+        return false == entity_a.is_null() && index < this->records.get_length() && nullptr != this->records[index].archetype &&
+               this->records[index].generation == entity_a.get_generation();
+    }
+    template<component Type> bool has(Entity entity_a) const
+    {
+        return true == this->is_alive(entity_a) &&
+               true == this->records[entity_a.get_index()].archetype->get_signature().has(Components::get_id<Type>());
+    }
+
+    /// @brief Returns the component or nullptr when the entity is not alive or does not have it.
+    template<component Type> Type* get(Entity entity_a)
+    {
+        if (false == this->is_alive(entity_a))
+        {
+            return nullptr;
+        }
+
+        const Record& record = this->records[entity_a.get_index()];
+        return static_cast<Type*>(record.archetype->get_component(Components::get_id<Type>(), record.location));
+    }
+
+    /// @brief Adds the component, replaces it when the entity already has one. Returns nullptr when the entity is not alive.
+    template<component Type, typename... Arg> Type* add(Entity entity_a, Arg&&... args_a)
+    {
+        assert(0u == this->iterations);
+
+        if (false == this->is_alive(entity_a))
+        {
+            return nullptr;
+        }
+
+        // the arguments may refer to components of the entity, so the value is built before any of them is replaced or moved
+        Type value(std::forward<Arg>(args_a)...);
+
+        Record& record = this->records[entity_a.get_index()];
+        const ComponentId id = Components::get_id<Type>();
+
+        if (true == record.archetype->get_signature().has(id))
+        {
+            Type* component = static_cast<Type*>(record.archetype->get_component(id, record.location));
+
+            if constexpr (std::is_move_assignable_v<Type>)
+            {
+                *component = std::move(value);
+                return component;
+            }
+            else
+            {
+                std::destroy_at(component);
+                return std::construct_at(component, std::move(value));
+            }
+        }
+
+        this->move(record, entity_a, this->get_neighbour(record.archetype, id, false));
+        return std::construct_at(static_cast<Type*>(record.archetype->get_component(id, record.location)), std::move(value));
+    }
+    /// @brief Removes the component. Returns false when the entity is not alive or does not have it.
+    template<component Type> bool remove(Entity entity_a)
+    {
+        return this->remove(entity_a, Components::get_id<Type>());
+    }
+
+    /// @brief Applies the recorded commands and clears them. Commands targeting entities which are not alive are dropped.
+    void apply(Commands& commands_a)
+    {
+        assert(0u == this->iterations);
+
+        const std::size_t length = commands_a.commands.get_length();
+
+        for (std::size_t i = 0u; i < length; i++)
+        {
+            Commands::Command& command = commands_a.commands[i];
+
+            switch (command.kind)
+            {
+                case Commands::Kind::create: {
+                    // the components follow the create, so the entity is created directly in its final archetype
+                    Signature signature;
+                    std::size_t end = i + 1u;
+
+                    for (; end < length && Commands::Kind::add == commands_a.commands[end].kind &&
+                           true == commands_a.commands[end].entity.is_null();
+                         end++)
+                    {
+                        signature.set(commands_a.commands[end].component);
+                    }
+
+                    const Entity entity = this->create_entity(signature);
+                    const Record& record = this->records[entity.get_index()];
+
+                    commands_a.created.push_back(entity);
+
+                    // a duplicated component is constructed from the last payload, the others are dropped by clear()
+                    Signature constructed;
+
+                    for (std::size_t j = end - 1u; j > i; j--)
+                    {
+                        Commands::Command& add = commands_a.commands[j];
+
+                        if (false == constructed.has(add.component))
+                        {
+                            Components::get_info(add.component).relocate(record.archetype->get_component(add.component, record.location),
+                                                                         add.payload);
+                            add.payload = nullptr;
+                            constructed.set(add.component);
+                        }
+                    }
+
+                    i = end - 1u;
+                }
+                break;
+
+                case Commands::Kind::destroy: {
+                    this->destroy(commands_a.resolve(command.entity));
+                }
+                break;
+
+                case Commands::Kind::add: {
+                    const Entity entity = commands_a.resolve(command.entity);
+
+                    if (true == this->is_alive(entity))
+                    {
+                        void* component = this->get_slot(entity, command.component);
+
+                        Components::get_info(command.component).relocate(component, command.payload);
+                        command.payload = nullptr;
+                    }
+                }
+                break;
+
+                case Commands::Kind::remove: {
+                    this->remove(commands_a.resolve(command.entity), command.component);
+                }
+                break;
+            }
+        }
+
+        commands_a.clear();
+    }
+
+    /// @brief Calls function_a(Type&...) or function_a(Entity, Type&...) for every entity having the components Type...
+    template<component... Type, typename Function> void each(Function&& function_a)
+    {
+        this->each_chunk<Type...>([&](const View<Type...>& view_a) { view_a.each(function_a); });
+    }
+    /// @brief Calls function_a(const View<Type...>&) for every chunk of entities having the components Type...
+    template<component... Type, typename Function> void each_chunk(Function&& function_a)
+    {
+        this->iterations++;
+
+        for (Archetype* archetype : this->get_archetypes(Signature::of<Type...>()))
+        {
+            for (const Archetype::Chunk& chunk : archetype->get_chunks())
+            {
+                function_a(View<Type...>(*archetype, chunk));
+            }
+        }
+
+        this->iterations--;
+    }
+
+    /// @brief Archetypes having every component of signature_a, the query is cached and updated with archetypes created since
+    /// the last call. The span is valid until the next call.
+    std::span<Archetype* const> get_archetypes(const Signature& signature_a)
+    {
+        std::uint32_t* index = this->queries_by_signature.find(signature_a);
+
+        if (nullptr == index)
+        {
+            index = &this->queries_by_signature[signature_a];
+            *index = static_cast<std::uint32_t>(this->queries.get_length());
+
+            this->queries.emplace_back(Query { .signature = signature_a,
+                                               .archetypes = lx::containers::Vector<Archetype*, 0u, lx::memory::Allocator<Archetype*>>(
+                                                   lx::memory::Allocator<Archetype*>(*this->resource)) });
+        }
+
+        Query& query = this->queries[*index];
+
+        for (; query.checked_count < this->archetypes.get_length(); query.checked_count++)
+        {
+            Archetype* archetype = this->archetypes[query.checked_count];
+
+            if (true == archetype->get_signature().contains(query.signature))
+            {
+                query.archetypes.push_back(archetype);
+            }
+        }
+
+        return query.archetypes;
+    }
+
+    std::size_t get_entities_count() const
+    {
+        return this->alive_count;
+    }
+    std::size_t get_archetypes_count() const
+    {
+        return this->archetypes.get_length();
+    }
+
+private:
+    constexpr static std::uint32_t npos = std::numeric_limits<std::uint32_t>::max();
+
+    // next_free links the free records
+    struct Record
+    {
+        Archetype* archetype;
+        Archetype::Location location;
+        std::uint32_t generation;
+        std::uint32_t next_free;
+    };
+
+    struct Query
+    {
+        Signature signature;
+        lx::containers::Vector<Archetype*, 0u, lx::memory::Allocator<Archetype*>> archetypes;
+        std::size_t checked_count = 0u;
+    };
+
+    // an entity with uninitialized components of signature_a
+    Entity create_entity(const Signature& signature_a)
+    {
+        assert(0u == this->iterations);
+
+        std::uint32_t index = this->free_head;
+
+        if (npos == index)
+        {
+            assert(this->records.get_length() < Entity::index_mask);
+
+            index = static_cast<std::uint32_t>(this->records.get_length());
+            this->records.push_back({ .archetype = nullptr, .location = {}, .generation = 0u, .next_free = npos });
+        }
+        else
+        {
+            this->free_head = this->records[index].next_free;
+        }
+
+        Record& record = this->records[index];
+        const Entity entity = { .value = (record.generation << Entity::index_bits) | index };
+
+        record.archetype = this->get_archetype(signature_a);
+        record.location = record.archetype->allocate(entity);
+
+        this->alive_count++;
+
+        return entity;
+    }
+    bool remove(Entity entity_a, ComponentId id_a)
+    {
+        assert(0u == this->iterations);
+
+        if (false == this->is_alive(entity_a) || false == this->records[entity_a.get_index()].archetype->get_signature().has(id_a))
+        {
+            return false;
+        }
+
+        Record& record = this->records[entity_a.get_index()];
+        this->move(record, entity_a, this->get_neighbour(record.archetype, id_a, true));
+
+        return true;
+    }
+
+    // uninitialized memory for component id_a of the entity, the current component is destroyed when the entity has one, so
+    // it is for payloads of Commands only, which cannot refer to the components
+    void* get_slot(Entity entity_a, ComponentId id_a)
+    {
+        Record& record = this->records[entity_a.get_index()];
+
+        if (true == record.archetype->get_signature().has(id_a))
+        {
+            void* component = record.archetype->get_component(id_a, record.location);
+            Components::get_info(id_a).destroy(component);
+
+            return component;
+        }
+
+        this->move(record, entity_a, this->get_neighbour(record.archetype, id_a, false));
+        return record.archetype->get_component(id_a, record.location);
+    }
+
+    // moves the row of record_a to archetype_a, the components archetype_a has and the source has not stay uninitialized
+    void move(Record& record_a, Entity entity_a, Archetype* archetype_a)
+    {
+        Archetype* source = record_a.archetype;
+        const Archetype::Location location = archetype_a->allocate(entity_a);
+
+        Signature moved;
+        for (const ComponentId id : source->get_component_ids())
+        {
+            void* destination = archetype_a->get_component(id, location);
+
+            if (nullptr != destination)
+            {
+                Components::get_info(id).relocate(destination, source->get_component(id, record_a.location));
+                moved.set(id);
+            }
+        }
+
+        this->remove_row(record_a, moved);
+
+        record_a.archetype = archetype_a;
+        record_a.location = location;
+    }
+    void remove_row(const Record& record_a, const Signature& skip_a = {})
+    {
+        const Entity moved = record_a.archetype->deallocate(record_a.location, skip_a);
+
+        if (false == moved.is_null())
+        {
+            this->records[moved.get_index()].location = record_a.location;
+        }
+    }
+
+    Archetype* get_archetype(const Signature& signature_a)
+    {
+        Archetype** found = this->archetypes_by_signature.find(signature_a);
+
+        if (nullptr != found)
+        {
+            return *found;
+        }
+
+        Archetype* archetype = static_cast<Archetype*>(this->resource->allocate(sizeof(Archetype), alignof(Archetype)));
+        std::construct_at(archetype, signature_a, *this->resource);
+
+        this->archetypes.push_back(archetype);
+        this->archetypes_by_signature[signature_a] = archetype;
+
+        return archetype;
+    }
+    // archetype_a with id_a added or removed
+    Archetype* get_neighbour(Archetype* archetype_a, ComponentId id_a, bool is_remove_a)
+    {
+        Archetype** edge = archetype_a->find_edge(id_a, is_remove_a);
+
+        if (nullptr != edge)
+        {
+            return *edge;
+        }
+
+        Signature signature = archetype_a->get_signature();
+
+        if (true == is_remove_a)
+        {
+            signature.reset(id_a);
+        }
+        else
+        {
+            signature.set(id_a);
+        }
+
+        Archetype* neighbour = this->get_archetype(signature);
+        archetype_a->add_edge(id_a, is_remove_a, neighbour);
+        neighbour->add_edge(id_a, false == is_remove_a, archetype_a);
+
+        return neighbour;
+    }
+
+    lx::memory::Resource* resource;
+
+    lx::containers::Vector<Record, 0u, lx::memory::Allocator<Record>> records;
+    std::uint32_t free_head = npos;
+    std::size_t alive_count = 0u;
+
+    lx::containers::Vector<Archetype*, 0u, lx::memory::Allocator<Archetype*>> archetypes;
+    lx::containers::FlatMap<Signature,
+                            Archetype*,
+                            lx::containers::Hash<Signature>,
+                            lx::containers::Equal<Signature>,
+                            lx::memory::Allocator<std::byte>>
+        archetypes_by_signature;
+
+    lx::containers::Vector<Query, 0u, lx::memory::Allocator<Query>> queries;
+    lx::containers::FlatMap<Signature,
+                            std::uint32_t,
+                            lx::containers::Hash<Signature>,
+                            lx::containers::Equal<Signature>,
+                            lx::memory::Allocator<std::byte>>
+        queries_by_signature;
+
+    // structural changes while iterating would move the rows being visited
+    std::size_t iterations = 0u;
+};
+} // namespace lx::ecs
@@ -2,6 +2,7 @@
 #include <lx/app.hpp>
 
 // lx
+#include <lx/containers/SmallVector.hpp>
 #include <lx/containers/Vector.hpp>
 #include <lx/gpu/loader/vulkan.hpp>
 #include <lx/utils/logger.hpp>
@@ -56,7 +57,14 @@ VKAPI_ATTR VkBool32 VKAPI_CALL vk_debug_callback(VkDebugUtilsMessageSeverityFlag
                                                  const VkDebugUtilsMessengerCallbackDataEXT* pCallbackData,
                                                  void*)
 {
-    logger::write_line(logger::dbg, std::source_location::current(), pCallbackData->pMessage);
+    if constexpr (true == logger::is_compiled(logger::dbg))
+    {
+        if (true == logger::is_filter(logger::dbg))
+        {
+            logger::write_line(logger::dbg, std::source_location::current(), "{}", pCallbackData->pMessage);
+        }
+    }
+
     return VK_FALSE;
 }
 
@@ -64,74 +72,12 @@ constexpr std::string_view engine_name = "lx";
 constexpr Version engine_version = Version::Components { .major = 0u, .minor = 0u, .patch = 1u };
 constexpr Version vulkan_version = Version::Components { .major = 1u, .minor = 3u, .patch = 0u };
 
+constexpr std::size_t frame_arena_capacity = 4u * 1024u * 1024u;
+
 FILE* p_log_file = nullptr;
 bool log_console_output = false;
 } // namespace
 
-namespace lx::utils {
-using namespace lx::containers;
-
-void logger::Composer::begin(Kind kind_a, const std::source_location& source_location_a)
-{
-    if (static_cast<std::uint64_t>(kind_a) == (static_cast<std::uint64_t>(logger::kind) & static_cast<std::uint64_t>(kind_a)))
-    {
-        this->kind = kind_a;
-
-        String<char, 34u> buffer;
-        buffer.reserve(21);
-
-        auto now = std::chrono::floor<std::chrono::seconds>(std::chrono::system_clock::now());
-        auto local_time = std::chrono::zoned_time { std::chrono::current_zone(), now };
-
-        std::format_to(buffer.get_buffer(), "[{:%H:%M:%S %d.%m.%Y}]", local_time);
-
-        switch (this->kind)
-        {
-            case Kind::inf:
-                buffer.push_back("[inf]");
-                break;
-            case Kind::wrn:
-                buffer.push_back("[wrn]");
-                break;
-            case Kind::err:
-                buffer.push_back("[err]");
-                break;
-            case Kind::omg:
-                buffer.push_back("[omg]");
-                break;
-            case Kind::dbg:
-                buffer.push_back("[dbg]");
-                break;
-        }
-
-        logger::log(buffer.get_cstring());
-        logger::log(std::format("[{}][{},{}] ", source_location_a.file_name(), source_location_a.line(), source_location_a.column()));
-    }
-}
-void logger::Composer::end()
-{
-    if (static_cast<std::uint64_t>(this->kind) == (static_cast<std::uint64_t>(logger::kind) & static_cast<std::uint64_t>(this->kind)))
-    {
-        logger::log("\n");
-        fflush(p_log_file);
-        if (true == log_console_output)
-        {
-            fflush(stdout);
-        }
-    }
-}
-
-void logger::log(std::string_view log_a)
-{
-    std::print(p_log_file, "{}", log_a);
-
-    if (true == log_console_output)
-    {
-        std::print(stdout, "{}", log_a);
-    }
-}
-} // namespace lx::utils
-
 int WINAPI WinMain(_In_ HINSTANCE, _In_opt_ HINSTANCE, _In_ LPSTR cmd_line, _In_ int)
 {
     using namespace lx::common;
@@ -157,7 +103,7 @@ int WINAPI WinMain(_In_ HINSTANCE, _In_opt_ HINSTANCE, _In_ LPSTR cmd_line, _In_
             return -1;
         }
 
-        errno_t file_err = fopen_s(&p_log_file, config.log.path.get_cstring(), "w+");
+        errno_t file_err = fopen_s(&p_log_file, config.log.path.get_cstring(), true == config.log.binary ? "w+b" : "w+");
 
         if (0 != file_err)
         {
@@ -180,8 +126,20 @@ int WINAPI WinMain(_In_ HINSTANCE, _In_opt_ HINSTANCE, _In_ LPSTR cmd_line, _In_
             }
         }
 
-        Vector<const char*> instance_layers;
-        Vector<const char*> instance_extensions;
+        logger::set_output(p_log_file, log_console_output);
+
+        if (true == config.log.binary)
+        {
+            // nothing is printed to the console in binary mode, decode the file with the log_decoder tool
+            logger::set_mode(logger::Mode::binary);
+        }
+        else if (true == config.log.async)
+        {
+            logger::set_mode(logger::Mode::async);
+        }
+
+        SmallVector<const char*, 8u> instance_layers;
+        SmallVector<const char*, 8u> instance_extensions;
 
         Vector<const char*, 3u> default_instance_extensions;
         Vector<const char*, 3u> default_instance_layers;
@@ -724,10 +682,16 @@ int WINAPI WinMain(_In_ HINSTANCE, _In_opt_ HINSTANCE, _In_ LPSTR cmd_line, _In_
             gpus.shrink_to_fit();
 
             lx::gpu::Context graphics_context;
-            std::int32_t entry_point_ret = lx::app::entry_point(displays, gpus, graphics_context, windower, cmd_line);
+            lx::memory::FrameArena<2u> frame_arena(frame_arena_capacity);
+            lx::jobs::Scheduler scheduler;
+            std::int32_t entry_point_ret =
+                lx::app::entry_point(displays, gpus, graphics_context, windower, frame_arena, scheduler, cmd_line);
 
             loader::vulkan::release();
 
+            // drains the ring and joins the writer thread before the file goes away
+            logger::set_mode(logger::Mode::sync);
+
             if (nullptr != p_log_file)
             {
                 fclose(p_log_file);
@@ -7,45 +7,66 @@
 #include <lx/containers/Vector.hpp>
 #include <lx/devices/GPU.hpp>
 #include <lx/gpu/Device.hpp>
+#include <lx/memory/Pool.hpp>
 
 namespace lx::gpu {
 class Context : public lx::common::non_copyable
 {
 public:
+    Context()
+        : devices(max_devices_count)
+    {
+    }
+    ~Context()
+    {
+        for (Device& device : this->devices)
+        {
+            device.destroy();
+        }
+    }
+
     template<typename Type> Type* create(const lx::devices::GPU& gpu_a,
                                          const lx::Canvas<lx::Windower::framed>* canvas_a,
                                          typename const Type::Properties& properties_a) = delete;
     template<typename Type> void destroy(lx::common::out<Type*> obj) = delete;
 
 private:
-    lx::containers::Vector<lx::gpu::Device*> devices;
+    constexpr static std::size_t max_devices_count = 8u;
+
+    lx::memory::Pool<lx::gpu::Device> devices;
 };
 
 template<> inline lx::gpu::Device* Context::create<lx::gpu::Device>(const lx::devices::GPU& gpu_a,
                                                                     const lx::Canvas<lx::Windower::framed>* canvas_a,
                                                                     const lx::gpu::Device::Properties& properties_a)
 {
-    auto device = new Device(gpu_a,
-                             *canvas_a,
-                             { .width = static_cast<std::uint32_t>(canvas_a->get_properties().size.w),
-                               .height = static_cast<std::uint32_t>(canvas_a->get_properties().size.h) },
-                             properties_a);
+    auto handle = this->devices.create(gpu_a,
+                                       *canvas_a,
+                                       VkExtent2D { .width = static_cast<std::uint32_t>(canvas_a->get_properties().size.w),
+                                                    .height = static_cast<std::uint32_t>(canvas_a->get_properties().size.h) },
+                                       properties_a);
+    Device* device = this->devices.get(handle);
 
-    if (true == device->is_created())
+    if (nullptr != device && false == device->is_created())
     {
-        this->devices.push_back(device);
-        return this->devices.get_back();
+        device->destroy();
+        this->devices.destroy(handle);
+
+        return nullptr;
     }
 
-    return nullptr;
+    return device;
 }
 
 template<> inline void Context::destroy<lx::gpu::Device>(lx::common::out<lx::gpu::Device*> device_a)
 {
-    (*device_a)->destroy();
-    delete (*device_a);
+    auto handle = this->devices.get_handle(*device_a);
 
-    //TODO: delete from devices
+    if (true == this->devices.is_valid(handle))
+    {
+        (*device_a)->destroy();
+        this->devices.destroy(handle);
+    }
 
     (*device_a) = nullptr;
 }
@@ -20,7 +20,7 @@ Device::Device(const GPU& gpu_a, VkSurfaceKHR vk_surface_a, const VkExtent2D& sw
     assert(false == properties_a.queue_families.empty());
     assert(false == gpu_a.queue_families.is_empty());
 
-    Vector<VkDeviceQueueCreateInfo> vk_device_queues_create_info(properties_a.queue_families.size());
+    SmallVector<VkDeviceQueueCreateInfo, 4u> vk_device_queues_create_info(properties_a.queue_families.size());
 
     for (std::size_t qf_property_index = 0; qf_property_index < properties_a.queue_families.size(); qf_property_index++)
     {
@@ -53,7 +53,7 @@ Device::Device(const GPU& gpu_a, VkSurfaceKHR vk_surface_a, const VkExtent2D& sw
 
     if (false == vk_device_queues_create_info.is_empty())
     {
-        Vector<const char*> extensions(properties_a.extensions.size() + 1u);
+        SmallVector<const char*, 8u> extensions(properties_a.extensions.size() + 1u);
         extensions.push_back(VK_KHR_SWAPCHAIN_EXTENSION_NAME);
         extensions.push_back(properties_a.extensions);
 
@@ -3,6 +3,7 @@
 // lx
 #include <lx/Windower.hpp>
 #include <lx/common/non_copyable.hpp>
+#include <lx/containers/SmallVector.hpp>
 #include <lx/containers/Vector.hpp>
 #include <lx/devices/GPU.hpp>
 #include <lx/gpu/loader/vulkan.hpp>
@@ -10,6 +11,10 @@
 // std
 #include <cassert>
 
+namespace lx::memory {
+template<typename Type, typename Value> class Pool;
+}
+
 namespace lx::gpu {
 class Device : private lx::common::non_copyable
 {
@@ -25,7 +30,7 @@ public:
         Kind kind;
         std::size_t count = 0u;
 
-        lx::containers::Vector<float> priorities;
+        lx::containers::SmallVector<float, 4u> priorities;
         bool presentation = false;
     };
     struct SwapChain
@@ -124,5 +129,6 @@ private:
     lx::containers::Vector<VkImageView> vk_swap_chain_image_views;
 
     friend class Context;
+    template<typename, typename> friend class lx::memory::Pool;
 };
 } // namespace lx::gpu
\ No newline at end of file
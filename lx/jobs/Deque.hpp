@@ -0,0 +1,121 @@
+#pragma once
+
+/*
+ *   Name: Deque.hpp
+ *   Copyright (c) Mateusz Semegen and contributors. All rights reserved.
+ */
+
+// lx
+#include <lx/common/non_copyable.hpp>
+
+// std
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace lx::jobs {
+
+/// @brief A bounded Chase-Lev work-stealing deque of pointers (Le, Pop, Cohen, Nardelli: "Correct and efficient work-stealing
+/// for weak memory models"). The owner thread pushes and pops at the bottom without a compare-exchange unless it competes
+/// for the last element, any thread steals the oldest element from the top. The array does not grow, push fails when it is full.
+/// @tparam Type of the pointed elements.
+/// @tparam capacity number of cells, must be a power of two.
+template<typename Type, std::size_t capacity> class Deque : private lx::common::non_copyable
+{
+    static_assert(capacity > 1u && 0u == (capacity & (capacity - 1u)));
+
+public:
+    /// @brief Adds value_a at the bottom. Returns false when the deque is full. Only the owner thread may call it.
+    bool push(Type* value_a)
+    {
+        const std::int64_t bottom = this->bottom.load(std::memory_order_relaxed);
+        const std::int64_t top = this->top.load(std::memory_order_acquire);
+
+        if (bottom - top >= static_cast<std::int64_t>(capacity))
+        {
+            return false;
+        }
+
+        this->cells[bottom & mask].store(value_a, std::memory_order_relaxed);
+        this->bottom.store(bottom + 1, std::memory_order_release);
+
+        return true;
+    }
+    /// @brief Takes the newest element. Returns nullptr when the deque is empty. Only the owner thread may call it.
+    Type* pop()
+    {
+        // the bottom is published before the top is read, in a single total order with steal(): either the thief sees the
+        // element taken or the owner sees the top moved
+        const std::int64_t bottom = this->bottom.load(std::memory_order_relaxed) - 1;
+        this->bottom.store(bottom, std::memory_order_seq_cst);
+        std::int64_t top = this->top.load(std::memory_order_seq_cst);
+
+        if (top > bottom)
+        {
+            this->bottom.store(bottom + 1, std::memory_order_relaxed);
+            return nullptr;
+        }
+
+        Type* value = this->cells[bottom & mask].load(std::memory_order_relaxed);
+
+        if (top == bottom)
+        {
+            // the last element, raced for with the thieves
+            if (false == this->top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+            {
+                value = nullptr;
+            }
+
+            this->bottom.store(bottom + 1, std::memory_order_relaxed);
+        }
+
+        return value;
+    }
+    /// @brief Takes the oldest element. Returns nullptr when the deque is empty or another thread won the element. Safe to call
+    /// from any thread.
+    Type* steal()
+    {
+        std::int64_t top = this->top.load(std::memory_order_seq_cst);
+        const std::int64_t bottom = this->bottom.load(std::memory_order_seq_cst);
+
+        if (top >= bottom)
+        {
+            return nullptr;
+        }
+
+        Type* value = this->cells[top & mask].load(std::memory_order_relaxed);
+
+        if (false == this->top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+        {
+            return nullptr;
+        }
+
+        return value;
+    }
+
+    /// @brief Approximate number of elements, exact only when called from the owner thread with no thief running.
+    std::size_t get_length() const
+    {
+        const std::int64_t bottom = this->bottom.load(std::memory_order_relaxed);
+        const std::int64_t top = this->top.load(std::memory_order_relaxed);
+
+        return bottom > top ? static_cast<std::size_t>(bottom - top) : 0u;
+    }
+    constexpr std::size_t get_capacity() const
+    {
+        return capacity;
+    }
+    bool is_empty() const
+    {
+        return 0u == this->get_length();
+    }
+
+private:
+    constexpr static std::int64_t mask = static_cast<std::int64_t>(capacity) - 1;
+    constexpr static std::size_t cache_line_size = 64u;
+
+    alignas(cache_line_size) std::atomic<std::int64_t> top = 0;
+    alignas(cache_line_size) std::atomic<std::int64_t> bottom = 0;
+    alignas(cache_line_size) std::atomic<Type*> cells[capacity] = {};
+};
+} // namespace lx::jobs
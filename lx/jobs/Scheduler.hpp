@@ -0,0 +1,652 @@
+#pragma once
+
+/*
+ *   Name: Scheduler.hpp
+ *   Copyright (c) Mateusz Semegen and contributors. All rights reserved.
+ */
+
+// lx
+#include <lx/common/non_copyable.hpp>
+#include <lx/common/out.hpp>
+#include <lx/containers/MpmcQueue.hpp>
+#include <lx/containers/Vector.hpp>
+#include <lx/jobs/Deque.hpp>
+
+// std
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <concepts>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <stop_token>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+namespace lx::jobs {
+
+class Scheduler;
+template<typename Type> class Task;
+
+/// @brief A coroutine suspended until a Counter or an Event is ready, linked into its list of waiters.
+struct Waiter
+{
+    std::coroutine_handle<> handle;
+    Scheduler* scheduler = nullptr;
+    Waiter* next = nullptr;
+
+    /// @brief Resumes the coroutines of the list starting at first_a through their schedulers.
+    static void resume_all(Waiter* first_a);
+};
+
+/// @brief co_await of a Counter or an Event: suspends the coroutine unless the source is ready already.
+template<typename Source> class WaitAwaiter
+{
+public:
+    explicit WaitAwaiter(Source& source_a)
+        : source(&source_a)
+    {
+    }
+
+    bool await_ready() const
+    {
+        return this->source->is_ready();
+    }
+    bool await_suspend(std::coroutine_handle<> handle_a);
+    void await_resume() const {}
+
+private:
+    Source* source;
+    Waiter waiter;
+};
+
+/// @brief Number of submitted jobs not finished yet, the join point of a fork/join. Jobs can wait on other counters, which
+/// makes the dependencies: blocking with Scheduler::wait() or, in a coroutine, suspending with co_await.
+/// The list of waiting coroutines is locked by a bit of the same word as the count, so the counter reads as done only after
+/// the last job stops touching it and can be destroyed right then.
+class Counter : private lx::common::non_copyable
+{
+public:
+    bool is_done() const
+    {
+        return 0u == this->state.load(std::memory_order_acquire);
+    }
+
+    WaitAwaiter<Counter> operator co_await()
+    {
+        return WaitAwaiter<Counter> { *this };
+    }
+
+private:
+    friend class Scheduler;
+    friend class WaitAwaiter<Counter>;
+    template<typename Type> friend class Task;
+
+    constexpr static std::uint64_t locked = 1ull << 63u;
+
+    bool is_ready() const
+    {
+        return this->is_done();
+    }
+
+    void add()
+    {
+        this->state.fetch_add(1u, std::memory_order_relaxed);
+    }
+    void release()
+    {
+        std::uint64_t state = this->state.load(std::memory_order_relaxed);
+
+        while (true)
+        {
+            if ((state & ~locked) > 1u)
+            {
+                if (true == this->state.compare_exchange_weak(state, state - 1u, std::memory_order_release, std::memory_order_relaxed))
+                {
+                    return;
+                }
+            }
+            else if (0u != (state & locked))
+            {
+                std::this_thread::yield();
+                state = this->state.load(std::memory_order_relaxed);
+            }
+            else if (true == this->state.compare_exchange_weak(state, locked, std::memory_order_acq_rel, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+
+        Waiter* waiters = std::exchange(this->waiters, nullptr);
+
+        // the last access, the counter may be gone right after it
+        this->state.fetch_and(~locked, std::memory_order_release);
+        Waiter::resume_all(waiters);
+    }
+    bool try_add_waiter(Waiter* waiter_a)
+    {
+        std::uint64_t state = this->state.load(std::memory_order_acquire);
+
+        while (true)
+        {
+            if (0u == state)
+            {
+                return false;
+            }
+
+            if (0u != (state & locked))
+            {
+                std::this_thread::yield();
+                state = this->state.load(std::memory_order_acquire);
+            }
+            else if (true == this->state.compare_exchange_weak(state, state | locked, std::memory_order_acquire))
+            {
+                break;
+            }
+        }
+
+        waiter_a->next = std::exchange(this->waiters, waiter_a);
+        this->state.fetch_and(~locked, std::memory_order_release);
+
+        return true;
+    }
+
+    std::atomic<std::uint64_t> state = 0u;
+    Waiter* waiters = nullptr;
+};
+
+/// @brief A flag which coroutines co_await, set typically by an I/O completion on a thread outside of the scheduler.
+/// As for Counter, the list of waiting coroutines is locked by a bit of the flag word.
+class Event : private lx::common::non_copyable
+{
+public:
+    /// @brief Sets the flag and resumes the coroutines waiting for it. Safe to call from any thread.
+    void set()
+    {
+        std::uint32_t state = this->state.load(std::memory_order_relaxed);
+
+        while (true)
+        {
+            if (is_set_bit == state)
+            {
+                return;
+            }
+
+            if (0u != (state & locked))
+            {
+                std::this_thread::yield();
+                state = this->state.load(std::memory_order_relaxed);
+            }
+            else if (true == this->state.compare_exchange_weak(state, locked, std::memory_order_acquire, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+
+        Waiter* waiters = std::exchange(this->waiters, nullptr);
+
+        // the last access, the event may be gone right after it
+        this->state.store(is_set_bit, std::memory_order_release);
+        Waiter::resume_all(waiters);
+    }
+    void reset()
+    {
+        std::uint32_t state = is_set_bit;
+        this->state.compare_exchange_strong(state, 0u, std::memory_order_relaxed);
+    }
+
+    bool is_set() const
+    {
+        return is_set_bit == this->state.load(std::memory_order_acquire);
+    }
+
+    WaitAwaiter<Event> operator co_await()
+    {
+        return WaitAwaiter<Event> { *this };
+    }
+
+private:
+    friend class WaitAwaiter<Event>;
+
+    constexpr static std::uint32_t is_set_bit = 0x1u;
+    constexpr static std::uint32_t locked = 0x2u;
+
+    bool is_ready() const
+    {
+        return this->is_set();
+    }
+
+    bool try_add_waiter(Waiter* waiter_a)
+    {
+        std::uint32_t state = this->state.load(std::memory_order_acquire);
+
+        while (true)
+        {
+            if (is_set_bit == state)
+            {
+                return false;
+            }
+
+            if (0u != (state & locked))
+            {
+                std::this_thread::yield();
+                state = this->state.load(std::memory_order_acquire);
+            }
+            else if (true == this->state.compare_exchange_weak(state, locked, std::memory_order_acquire))
+            {
+                break;
+            }
+        }
+
+        waiter_a->next = std::exchange(this->waiters, waiter_a);
+        this->state.store(0u, std::memory_order_release);
+
+        return true;
+    }
+
+    std::atomic<std::uint32_t> state = 0u;
+    Waiter* waiters = nullptr;
+};
+
+/// @brief A work-stealing job scheduler: one worker thread per core besides the thread which constructed the scheduler, which
+/// becomes a worker too and runs jobs while it waits on a counter.
+/// Every worker owns a Deque of jobs it submitted: it runs the newest of them first, while the idle workers steal the oldest
+/// from random victims, which for the recursive splits of parallel_for are the largest. Jobs live in a ring of slots per
+/// worker, freed as soon as the job starts. When the slot or the deque of the submitting worker is still taken the job runs
+/// right away instead, so submitting never blocks. Idle workers spin shortly and then sleep until a job is submitted.
+/// Jobs can be submitted only from the threads of the scheduler, coroutines can be resumed through it from any thread.
+/// The jobs still queued when the scheduler is destroyed run on the destroying thread, after the workers are joined.
+class Scheduler : private lx::common::non_copyable
+{
+public:
+    /// @brief Bytes available for the callable of a job, larger ones do not compile.
+    constexpr static std::size_t job_storage_size = 96u;
+    constexpr static std::size_t jobs_capacity = 1024u;
+    /// @brief Coroutines resumed from threads outside of the scheduler wait in a queue of that many cells.
+    constexpr static std::size_t injected_capacity = 1024u;
+
+    /// @param workers_count_a number of worker threads, besides the calling thread.
+    explicit Scheduler(std::size_t workers_count_a = get_default_workers_count())
+        : workers(workers_count_a + 1u)
+        , injected(injected_capacity)
+    {
+        for (std::size_t i = 0u; i <= workers_count_a; i++)
+        {
+            Worker* worker = new Worker();
+
+            worker->scheduler = this;
+            worker->random = static_cast<std::uint32_t>(i * 0x9E3779B9u + 1u);
+
+            this->workers.push_back(worker);
+        }
+
+        this->previous_worker = std::exchange(current_worker, this->workers[0]);
+
+        for (std::size_t i = 1u; i <= workers_count_a; i++)
+        {
+            this->workers[i]->thread = std::jthread([this, i](std::stop_token stop_token_a) { this->run(i, stop_token_a); });
+        }
+    }
+    ~Scheduler()
+    {
+        for (std::size_t i = 1u; i < this->workers.get_length(); i++)
+        {
+            this->workers[i]->thread.request_stop();
+        }
+
+        this->wake_all();
+
+        // every thread is joined before any worker goes away, the others could still be stealing from it
+        for (std::size_t i = 1u; i < this->workers.get_length(); i++)
+        {
+            this->workers[i]->thread.join();
+        }
+
+        // the jobs left behind run here, so their captures are released and their counters done; they may submit more
+        for (bool found = true; true == found;)
+        {
+            found = false;
+
+            for (Worker* worker : this->workers)
+            {
+                for (Job* job = worker->deque.pop(); nullptr != job; job = worker->deque.pop())
+                {
+                    job->function(*job);
+                    found = true;
+                }
+            }
+
+            std::coroutine_handle<> handle;
+
+            while (true == this->injected.try_pop(lx::common::out(handle)))
+            {
+                handle.resume();
+                found = true;
+            }
+        }
+
+        for (Worker* worker : this->workers)
+        {
+            delete worker;
+        }
+
+        current_worker = this->previous_worker;
+    }
+
+    /// @brief Schedules function_a, counted by counter_a until it returns.
+    template<typename Function> void submit(Counter& counter_a, Function&& function_a)
+    {
+        this->submit_job(&counter_a, std::forward<Function>(function_a));
+    }
+    /// @brief Starts task_a on a worker, counted by counter_a until it finishes. The task frees itself.
+    void submit(Counter& counter_a, Task<void>&& task_a);
+
+    /// @brief Starts task_a on a worker and runs jobs until it finishes. Returns its result.
+    template<typename Type> Type run(Task<Type> task_a);
+
+    /// @brief Resumes handle_a on a worker. Safe to call from any thread.
+    void resume(std::coroutine_handle<> handle_a)
+    {
+        Worker* worker = current_worker;
+
+        if (nullptr != worker && this == worker->scheduler)
+        {
+            this->submit_job(nullptr, [handle_a]() { handle_a.resume(); });
+            return;
+        }
+
+        while (false == this->injected.try_push(handle_a))
+        {
+            std::this_thread::yield();
+        }
+
+        this->wake_one();
+    }
+    /// @brief co_await scheduler.schedule() continues the coroutine as a job, which another worker can steal.
+    auto schedule()
+    {
+        struct Awaiter
+        {
+            Scheduler* scheduler;
+
+            bool await_ready() const
+            {
+                return false;
+            }
+            void await_suspend(std::coroutine_handle<> handle_a) const
+            {
+                this->scheduler->resume(handle_a);
+            }
+            void await_resume() const {}
+        };
+
+        return Awaiter { this };
+    }
+
+    /// @brief Calls function_a(begin, end) over subranges of [begin_a, end_a) no longer than grain_a in parallel and returns when
+    /// all of them are done. The range is split in halves recursively, the halves are stolen by the idle workers.
+    template<typename Function> void parallel_for(std::size_t begin_a, std::size_t end_a, std::size_t grain_a, const Function& function_a)
+    {
+        Counter counter;
+
+        this->split(counter, begin_a, end_a, std::max<std::size_t>(grain_a, 1u), function_a);
+        this->wait(counter);
+    }
+
+    /// @brief Runs jobs until counter_a is done.
+    void wait(const Counter& counter_a)
+    {
+        Worker* worker = current_worker;
+        assert(nullptr != worker && this == worker->scheduler && "counters are waited on from the threads of the scheduler");
+
+        while (false == counter_a.is_done())
+        {
+            if (false == this->run_one(worker))
+            {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    /// @brief Number of threads running jobs, including the one which constructed the scheduler.
+    std::size_t get_workers_count() const
+    {
+        return this->workers.get_length();
+    }
+
+    static std::size_t get_default_workers_count()
+    {
+        const std::size_t cores = std::thread::hardware_concurrency();
+        return cores > 1u ? cores - 1u : 0u;
+    }
+    /// @brief The scheduler running the calling thread, nullptr on other threads.
+    static Scheduler* get_current()
+    {
+        return nullptr != current_worker ? current_worker->scheduler : nullptr;
+    }
+
+private:
+    struct alignas(64u) Job
+    {
+        void (*function)(Job&) = nullptr;
+        Counter* counter = nullptr;
+        std::atomic<bool> is_free = true;
+
+        alignas(std::max_align_t) std::byte storage[job_storage_size];
+    };
+
+    struct Worker
+    {
+        Scheduler* scheduler = nullptr;
+        std::uint32_t random = 1u;
+        std::size_t next_job = 0u;
+
+        Deque<Job, jobs_capacity> deque;
+        Job jobs[jobs_capacity];
+
+        std::jthread thread;
+    };
+
+    // spins on the deques that long before sleeping
+    constexpr static std::size_t idle_spins_count = 64u;
+
+    inline static thread_local Worker* current_worker = nullptr;
+
+    // counter_a is nullptr for the jobs resuming coroutines
+    template<typename Function> void submit_job(Counter* counter_a, Function&& function_a)
+    {
+        using Callable = std::decay_t<Function>;
+
+        static_assert(sizeof(Callable) <= job_storage_size && alignof(Callable) <= alignof(std::max_align_t));
+        static_assert(std::is_nothrow_move_constructible_v<Callable> && std::invocable<Callable&>);
+
+        Worker* worker = current_worker;
+        assert(nullptr != worker && this == worker->scheduler && "jobs are submitted from the threads of the scheduler");
+
+        Job& job = worker->jobs[worker->next_job & (jobs_capacity - 1u)];
+
+        if (false == job.is_free.load(std::memory_order_acquire))
+        {
+            function_a();
+            return;
+        }
+
+        job.counter = counter_a;
+        job.function = [](Job& job_a) {
+            Callable* stored = std::launder(reinterpret_cast<Callable*>(job_a.storage));
+            Callable callable = std::move(*stored);
+            Counter* counter = job_a.counter;
+
+            std::destroy_at(stored);
+            job_a.is_free.store(true, std::memory_order_release);
+
+            callable();
+
+            if (nullptr != counter)
+            {
+                counter->release();
+            }
+        };
+        std::construct_at(reinterpret_cast<Callable*>(job.storage), std::forward<Function>(function_a));
+
+        if (nullptr != counter_a)
+        {
+            counter_a->add();
+        }
+
+        job.is_free.store(false, std::memory_order_relaxed);
+
+        if (false == worker->deque.push(&job))
+        {
+            job.function(job);
+            return;
+        }
+
+        worker->next_job++;
+        this->wake_one();
+    }
+
+    template<typename Function>
+    void split(Counter& counter_a, std::size_t begin_a, std::size_t end_a, std::size_t grain_a, const Function& function_a)
+    {
+        while (end_a - begin_a > grain_a)
+        {
+            const std::size_t middle = begin_a + (end_a - begin_a) / 2u;
+
+            this->submit(counter_a, [this, &counter_a, middle, end_a, grain_a, &function_a]() {
+                this->split(counter_a, middle, end_a, grain_a, function_a);
+            });
+
+            end_a = middle;
+        }
+
+        if (begin_a < end_a)
+        {
+            function_a(begin_a, end_a);
+        }
+    }
+
+    // own jobs newest first, then the coroutines resumed from outside, then the oldest job of a random victim
+    bool run_one(Worker* worker_a)
+    {
+        Job* job = worker_a->deque.pop();
+
+        if (nullptr == job && false == this->injected.is_empty())
+        {
+            std::coroutine_handle<> handle;
+
+            if (true == this->injected.try_pop(lx::common::out(handle)))
+            {
+                handle.resume();
+                return true;
+            }
+        }
+
+        const std::size_t workers_count = this->workers.get_length();
+
+        for (std::size_t i = 0u; nullptr == job && i < workers_count; i++)
+        {
+            worker_a->random ^= worker_a->random << 13u;
+            worker_a->random ^= worker_a->random >> 17u;
+            worker_a->random ^= worker_a->random << 5u;
+
+            Worker* victim = this->workers[worker_a->random % workers_count];
+
+            if (victim != worker_a)
+            {
+                job = victim->deque.steal();
+            }
+        }
+
+        if (nullptr == job)
+        {
+            return false;
+        }
+
+        job->function(*job);
+        return true;
+    }
+
+    void run(std::size_t index_a, std::stop_token stop_token_a)
+    {
+        Worker* worker = this->workers[index_a];
+        current_worker = worker;
+
+        while (false == stop_token_a.stop_requested())
+        {
+            bool found = false;
+
+            for (std::size_t i = 0u; false == found && i < idle_spins_count; i++)
+            {
+                found = this->run_one(worker);
+            }
+
+            if (false == found)
+            {
+                // a submit after the epoch was read changes it, so the wait below cannot miss the job. The increment pairs with
+                // the read-modify-write in wake_one(): either it is counted there or it reads that write, and then the job
+                // pushed before it is visible to run_one()
+                const std::uint32_t epoch = this->epoch.load(std::memory_order_acquire);
+                this->sleeping.fetch_add(1u, std::memory_order_seq_cst);
+
+                if (false == stop_token_a.stop_requested() && false == this->run_one(worker))
+                {
+                    this->epoch.wait(epoch, std::memory_order_acquire);
+                }
+
+                this->sleeping.fetch_sub(1u, std::memory_order_relaxed);
+            }
+        }
+
+        current_worker = nullptr;
+    }
+
+    void wake_one()
+    {
+        // a read-modify-write rather than a load: it is ordered with the increment of a worker going to sleep, which either
+        // is counted here or reads this write and so finds the job pushed before it
+        if (0u != this->sleeping.fetch_add(0u, std::memory_order_seq_cst))
+        {
+            this->epoch.fetch_add(1u, std::memory_order_release);
+            this->epoch.notify_one();
+        }
+    }
+    void wake_all()
+    {
+        this->epoch.fetch_add(1u, std::memory_order_release);
+        this->epoch.notify_all();
+    }
+
+    lx::containers::Vector<Worker*> workers;
+    lx::containers::MpmcQueue<std::coroutine_handle<>> injected;
+    Worker* previous_worker = nullptr;
+
+    alignas(64u) std::atomic<std::uint32_t> epoch = 0u;
+    alignas(64u) std::atomic<std::uint32_t> sleeping = 0u;
+};
+
+inline void Waiter::resume_all(Waiter* first_a)
+{
+    while (nullptr != first_a)
+    {
+        // the resumed coroutine may free the waiter
+        Waiter* next = first_a->next;
+        first_a->scheduler->resume(first_a->handle);
+        first_a = next;
+    }
+}
+
+template<typename Source> bool WaitAwaiter<Source>::await_suspend(std::coroutine_handle<> handle_a)
+{
+    this->waiter.handle = handle_a;
+    this->waiter.scheduler = Scheduler::get_current();
+    assert(nullptr != this->waiter.scheduler && "coroutines wait on the threads of a scheduler");
+
+    // the coroutine can be resumed on another thread as soon as the waiter is added, the awaiter is not touched after that
+    return this->source->try_add_waiter(&this->waiter);
+}
+} // namespace lx::jobs
@@ -0,0 +1,212 @@
+#pragma once
+
+/*
+ *   Name: Task.hpp
+ *   Copyright (c) Mateusz Semegen and contributors. All rights reserved.
+ */
+
+// lx
+#include <lx/common/non_copyable.hpp>
+#include <lx/jobs/Scheduler.hpp>
+
+// std
+#include <cassert>
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <utility>
+
+namespace lx::jobs {
+
+/// @brief The part of the promise of a Task which keeps the returned value.
+template<typename Type> class TaskResult
+{
+public:
+    template<typename Value> void return_value(Value&& value_a)
+    {
+        this->value.emplace(std::forward<Value>(value_a));
+    }
+
+    Type get_result()
+    {
+        assert(true == this->value.has_value());
+        return std::move(*this->value);
+    }
+
+private:
+    std::optional<Type> value;
+};
+template<> class TaskResult<void>
+{
+public:
+    void return_void() {}
+
+    void get_result() {}
+};
+
+/// @brief A coroutine run by the job scheduler. It starts when awaited, so co_await task runs it right away on the awaiting
+/// worker and resumes the awaiting coroutine on whichever worker the task finishes, without a job in between. Inside a task
+/// co_await of a Counter or an Event suspends it instead of blocking the worker, and it is resumed as a job when they are
+/// ready; co_await scheduler.schedule() moves it to a job another worker can steal.
+/// Tasks are started from plain code with Scheduler::run() or Scheduler::submit().
+/// @tparam Type of the returned value.
+template<typename Type = void> class [[nodiscard]] Task : private lx::common::non_copyable
+{
+public:
+    class promise_type : public TaskResult<Type>
+    {
+    public:
+        Task<Type> get_return_object()
+        {
+            return Task<Type> { std::coroutine_handle<promise_type>::from_promise(*this) };
+        }
+
+        std::suspend_always initial_suspend() noexcept
+        {
+            return {};
+        }
+        auto final_suspend() noexcept
+        {
+            struct Awaiter
+            {
+                bool await_ready() noexcept
+                {
+                    return false;
+                }
+                std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> handle_a) noexcept
+                {
+                    promise_type& promise = handle_a.promise();
+
+                    if (nullptr != promise.continuation)
+                    {
+                        return promise.continuation;
+                    }
+
+                    Counter* counter = promise.counter;
+
+                    if (true == promise.is_detached)
+                    {
+                        handle_a.destroy();
+                    }
+
+                    // the owner of a task run by Scheduler::run() destroys it as soon as the counter is done
+                    if (nullptr != counter)
+                    {
+                        counter->release();
+                    }
+
+                    return std::noop_coroutine();
+                }
+                void await_resume() noexcept {}
+            };
+
+            return Awaiter {};
+        }
+
+        // the engine is built without exceptions
+        void unhandled_exception()
+        {
+            std::terminate();
+        }
+
+    private:
+        friend class Task<Type>;
+        friend class Scheduler;
+
+        std::coroutine_handle<> continuation;
+        Counter* counter = nullptr;
+        bool is_detached = false;
+    };
+
+    Task(Task<Type>&& other_a) noexcept
+        : handle(std::exchange(other_a.handle, nullptr))
+    {
+    }
+    ~Task()
+    {
+        if (nullptr != this->handle)
+        {
+            this->handle.destroy();
+        }
+    }
+
+    Task<Type>& operator=(Task<Type>&& other_a) noexcept
+    {
+        if (this != &other_a)
+        {
+            if (nullptr != this->handle)
+            {
+                this->handle.destroy();
+            }
+
+            this->handle = std::exchange(other_a.handle, nullptr);
+        }
+
+        return *this;
+    }
+
+    bool is_done() const
+    {
+        return nullptr != this->handle && true == this->handle.done();
+    }
+
+    auto operator co_await() noexcept
+    {
+        struct Awaiter
+        {
+            std::coroutine_handle<promise_type> handle;
+
+            bool await_ready() const noexcept
+            {
+                return false;
+            }
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting_a) const noexcept
+            {
+                this->handle.promise().continuation = awaiting_a;
+                return this->handle;
+            }
+            Type await_resume() const
+            {
+                return this->handle.promise().get_result();
+            }
+        };
+
+        assert(nullptr != this->handle);
+        return Awaiter { this->handle };
+    }
+
+private:
+    friend class Scheduler;
+
+    explicit Task(std::coroutine_handle<promise_type> handle_a)
+        : handle(handle_a)
+    {
+    }
+
+    std::coroutine_handle<promise_type> handle;
+};
+
+inline void Scheduler::submit(Counter& counter_a, Task<void>&& task_a)
+{
+    auto& promise = task_a.handle.promise();
+
+    promise.counter = &counter_a;
+    promise.is_detached = true;
+    counter_a.add();
+
+    this->resume(std::exchange(task_a.handle, nullptr));
+}
+
+template<typename Type> Type Scheduler::run(Task<Type> task_a)
+{
+    Counter counter;
+
+    task_a.handle.promise().counter = &counter;
+    counter.add();
+
+    this->resume(task_a.handle);
+    this->wait(counter);
+
+    return task_a.handle.promise().get_result();
+}
+} // namespace lx::jobs
@@ -0,0 +1,160 @@
+#pragma once
+
+/*
+ *   Name: Affine.hpp
+ *   Copyright (c) Mateusz Semegen and contributors. All rights reserved.
+ */
+
+// lx
+#include <lx/math/Matrix.hpp>
+#include <lx/math/Vector.hpp>
+#include <lx/math/simd.hpp>
+
+// std
+#include <cmath>
+#include <span>
+#include <type_traits>
+
+namespace lx::math {
+/// @brief 2D affine transform stored as a 2x3 matrix: the two basis columns and the translation of a Matrix<Type, 3u> whose
+/// last row is { 0, 0, 1 }. Six values instead of nine, a third less to move per sprite.
+template<typename Type> struct Affine
+{
+    Vector<Type, 2u> column_0;
+    Vector<Type, 2u> column_1;
+    Vector<Type, 2u> column_2;
+
+    [[nodiscard]] constexpr static Affine<Type> translation(Vector<Type, 2u> offset_a)
+    {
+        return { .column_0 = { .x = static_cast<Type>(1) }, .column_1 = { .y = static_cast<Type>(1) }, .column_2 = offset_a };
+    }
+    /// @brief Counterclockwise rotation by angle_a radians. Constant evaluated only where std::sin and std::cos are.
+    [[nodiscard]] constexpr static Affine<Type> rotation(Type angle_a)
+    {
+        using std::cos;
+        using std::sin;
+
+        const Type sine = sin(angle_a);
+        const Type cosine = cos(angle_a);
+
+        return { .column_0 = { .x = cosine, .y = sine }, .column_1 = { .x = -sine, .y = cosine }, .column_2 = {} };
+    }
+    [[nodiscard]] constexpr static Affine<Type> scaling(Vector<Type, 2u> factors_a)
+    {
+        return { .column_0 = { .x = factors_a.x }, .column_1 = { .y = factors_a.y }, .column_2 = {} };
+    }
+    /// @brief Maps the rectangle [left_a, right_a] x [bottom_a, top_a] onto [-1, 1] x [-1, 1].
+    [[nodiscard]] constexpr static Affine<Type> orthographic(Type left_a, Type right_a, Type bottom_a, Type top_a)
+    {
+        const Type width = right_a - left_a;
+        const Type height = top_a - bottom_a;
+
+        return { .column_0 = { .x = static_cast<Type>(2) / width },
+                 .column_1 = { .y = static_cast<Type>(2) / height },
+                 .column_2 = { .x = -(right_a + left_a) / width, .y = -(top_a + bottom_a) / height } };
+    }
+
+    [[nodiscard]] constexpr explicit operator Matrix<Type, 3u>() const
+    {
+        return { .column_0 = { .x = this->column_0.x, .y = this->column_0.y },
+                 .column_1 = { .x = this->column_1.x, .y = this->column_1.y },
+                 .column_2 = { .x = this->column_2.x, .y = this->column_2.y, .z = static_cast<Type>(1) } };
+    }
+    /// @brief The transform on the z = 0 plane, z passes through unchanged.
+    [[nodiscard]] constexpr explicit operator Matrix<Type, 4u>() const
+    {
+        return { .column_0 = { .x = this->column_0.x, .y = this->column_0.y },
+                 .column_1 = { .x = this->column_1.x, .y = this->column_1.y },
+                 .column_2 = { .z = static_cast<Type>(1) },
+                 .column_3 = { .x = this->column_2.x, .y = this->column_2.y, .w = static_cast<Type>(1) } };
+    }
+
+    const static Affine<Type> identity;
+};
+
+// constexpr, though declared const in the class, which is incomplete there
+template<typename Type> constexpr Affine<Type> Affine<Type>::identity = {
+    .column_0 = { .x = static_cast<Type>(1) },
+    .column_1 = { .y = static_cast<Type>(1) },
+    .column_2 = {},
+};
+
+template<typename Type> [[nodiscard]] constexpr bool operator==(const Affine<Type>& left_a, const Affine<Type>& right_a)
+{
+    return left_a.column_0 == right_a.column_0 && left_a.column_1 == right_a.column_1 && left_a.column_2 == right_a.column_2;
+}
+template<typename Type> [[nodiscard]] constexpr bool operator!=(const Affine<Type>& left_a, const Affine<Type>& right_a)
+{
+    return false == (left_a == right_a);
+}
+
+/// @brief Composition, (a * b) applies b first, the same as for the square matrices.
+template<typename Type> [[nodiscard]] constexpr Affine<Type> operator*(const Affine<Type>& left_a, const Affine<Type>& right_a)
+{
+    if constexpr (true == simd::is_accelerated<Type>)
+    {
+        if !consteval
+        {
+            // { l0.x, l0.y, l0.x, l0.y } * { r0.x, r0.x, r1.x, r1.x } + { l1.x, l1.y, l1.x, l1.y } * { r0.y, r0.y, r1.y, r1.y }
+            // gives both basis columns at once
+            const simd::float4 left_basis = simd::load(&left_a.column_0.x);
+            const simd::float4 right_basis = simd::load(&right_a.column_0.x);
+            const simd::float4 left_column_0 = simd::shuffle<0u, 1u, 0u, 1u>(left_basis, left_basis);
+            const simd::float4 left_column_1 = simd::shuffle<2u, 3u, 2u, 3u>(left_basis, left_basis);
+
+            const simd::float4 right_xs = simd::shuffle<0u, 0u, 2u, 2u>(right_basis, right_basis);
+            const simd::float4 right_ys = simd::shuffle<1u, 1u, 3u, 3u>(right_basis, right_basis);
+            const simd::float4 basis = simd::multiply_add(left_column_1, right_ys, simd::mul(left_column_0, right_xs));
+
+            Affine<Type> result;
+            simd::store(&result.column_0.x, basis);
+            result.column_2 = left_a.column_0 * right_a.column_2.x + left_a.column_1 * right_a.column_2.y + left_a.column_2;
+
+            return result;
+        }
+    }
+
+    return { .column_0 = left_a.column_0 * right_a.column_0.x + left_a.column_1 * right_a.column_0.y,
+             .column_1 = left_a.column_0 * right_a.column_1.x + left_a.column_1 * right_a.column_1.y,
+             .column_2 = left_a.column_0 * right_a.column_2.x + left_a.column_1 * right_a.column_2.y + left_a.column_2 };
+}
+
+template<typename Type> [[nodiscard]] constexpr Type determinant(const Affine<Type>& affine_a)
+{
+    return cross(affine_a.column_0, affine_a.column_1);
+}
+/// @brief The transform has to be invertible, a singular one yields infinities.
+template<typename Type> [[nodiscard]] constexpr Affine<Type> inverted(const Affine<Type>& affine_a)
+{
+    const Type determinant_reciprocal = static_cast<Type>(1) / determinant(affine_a);
+
+    const Vector<Type, 2u> column_0 = Vector<Type, 2u> { .x = affine_a.column_1.y, .y = -affine_a.column_0.y } * determinant_reciprocal;
+    const Vector<Type, 2u> column_1 = Vector<Type, 2u> { .x = -affine_a.column_1.x, .y = affine_a.column_0.x } * determinant_reciprocal;
+
+    return { .column_0 = column_0,
+             .column_1 = column_1,
+             .column_2 = -(column_0 * affine_a.column_2.x + column_1 * affine_a.column_2.y) };
+}
+
+/// @brief Transforms a point, the translation applies.
+template<typename Type> [[nodiscard]] constexpr Vector<Type, 2u> transform_point(const Affine<Type>& affine_a, Vector<Type, 2u> point_a)
+{
+    return affine_a.column_0 * point_a.x + affine_a.column_1 * point_a.y + affine_a.column_2;
+}
+/// @brief Transforms a direction, the translation does not apply.
+template<typename Type>
+[[nodiscard]] constexpr Vector<Type, 2u> transform_vector(const Affine<Type>& affine_a, Vector<Type, 2u> vector_a)
+{
+    return affine_a.column_0 * vector_a.x + affine_a.column_1 * vector_a.y;
+}
+
+/// @brief Transforms points_a into transformed_a, both spans have the same length and may be the same memory. Goes through
+/// the SSE/NEON/AVX path of transform_points for Matrix<Type, 4u>.
+template<typename Type>
+void transform_points(const Affine<Type>& affine_a,
+                      std::type_identity_t<std::span<const Vector<Type, 2u>>> points_a,
+                      std::type_identity_t<std::span<Vector<Type, 2u>>> transformed_a)
+{
+    transform_points(static_cast<Matrix<Type, 4u>>(affine_a), points_a, transformed_a);
+}
+} // namespace lx::math
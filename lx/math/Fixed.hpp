@@ -0,0 +1,386 @@
+#pragma once
+
+/*
+ *   Name: Fixed.hpp
+ *   Copyright (c) Mateusz Semegen and contributors. All rights reserved.
+ */
+
+// std
+#include <bit>
+#include <cassert>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numbers>
+#include <type_traits>
+
+namespace lx::math {
+
+/// @brief What Fixed does with results out of its range: clamp to the nearest representable value, or assert (in builds with
+/// assertions) and wrap around, which is the cheapest.
+enum class Overflow : std::uint8_t
+{
+    saturate,
+    check
+};
+
+/// @brief Signed fixed point number of int_bits integer bits (including the sign) and frac_bits fractional bits, 16 or 32 in
+/// total. Every operation, sqrt and the trigonometry included, is integer only and so gives bit exact results on every machine
+/// and compiler, which lockstep simulation and replays need. Usable as the element type of Vector and Matrix.
+/// Multiplication rounds to the nearest value, division truncates toward zero.
+template<std::size_t int_bits, std::size_t frac_bits, Overflow overflow = Overflow::saturate> class Fixed
+{
+public:
+    static_assert(16u == int_bits + frac_bits || 32u == int_bits + frac_bits);
+    static_assert(int_bits > 0u, "one integer bit is the sign");
+
+    using Raw = std::conditional_t<16u == int_bits + frac_bits, std::int16_t, std::int32_t>;
+
+    constexpr static Raw raw_one = static_cast<Raw>(Raw { 1 } << frac_bits);
+
+    constexpr Fixed() = default;
+
+    template<std::integral Integer>
+    constexpr explicit Fixed(Integer value_a)
+        : raw(from_integer(value_a))
+    {
+    }
+    template<std::floating_point Floating>
+    constexpr explicit Fixed(Floating value_a)
+        : raw(from_floating(static_cast<double>(value_a)))
+    {
+    }
+
+    [[nodiscard]] constexpr static Fixed from_raw(Raw raw_a)
+    {
+        Fixed fixed;
+        fixed.raw = raw_a;
+
+        return fixed;
+    }
+    [[nodiscard]] constexpr Raw get_raw() const
+    {
+        return this->raw;
+    }
+
+    /// @brief Truncates toward zero, as a float to integer conversion does.
+    template<std::integral Integer> [[nodiscard]] constexpr explicit operator Integer() const
+    {
+        return static_cast<Integer>(this->raw / raw_one);
+    }
+    template<std::floating_point Floating> [[nodiscard]] constexpr explicit operator Floating() const
+    {
+        return static_cast<Floating>(static_cast<double>(this->raw) / static_cast<double>(raw_one));
+    }
+
+    [[nodiscard]] constexpr Fixed operator-() const
+    {
+        return from_wide(-static_cast<std::int64_t>(this->raw));
+    }
+    [[nodiscard]] constexpr Fixed operator+() const
+    {
+        return *this;
+    }
+
+    constexpr Fixed& operator+=(Fixed other_a)
+    {
+        *this = *this + other_a;
+        return *this;
+    }
+    constexpr Fixed& operator-=(Fixed other_a)
+    {
+        *this = *this - other_a;
+        return *this;
+    }
+    constexpr Fixed& operator*=(Fixed other_a)
+    {
+        *this = *this * other_a;
+        return *this;
+    }
+    constexpr Fixed& operator/=(Fixed other_a)
+    {
+        *this = *this / other_a;
+        return *this;
+    }
+
+    [[nodiscard]] friend constexpr Fixed operator+(Fixed left_a, Fixed right_a)
+    {
+        return from_wide(static_cast<std::int64_t>(left_a.raw) + right_a.raw);
+    }
+    [[nodiscard]] friend constexpr Fixed operator-(Fixed left_a, Fixed right_a)
+    {
+        return from_wide(static_cast<std::int64_t>(left_a.raw) - right_a.raw);
+    }
+    [[nodiscard]] friend constexpr Fixed operator*(Fixed left_a, Fixed right_a)
+    {
+        const std::int64_t product = static_cast<std::int64_t>(left_a.raw) * right_a.raw;
+        return from_wide(round_shift(product, frac_bits));
+    }
+    /// @brief Division by zero asserts, with saturation it yields the limit of the sign of the dividend.
+    [[nodiscard]] friend constexpr Fixed operator/(Fixed left_a, Fixed right_a)
+    {
+        assert(0 != right_a.raw);
+
+        if constexpr (Overflow::saturate == overflow)
+        {
+            if (0 == right_a.raw)
+            {
+                return left_a.raw < 0 ? std::numeric_limits<Fixed>::lowest() : std::numeric_limits<Fixed>::max();
+            }
+        }
+
+        return from_wide(static_cast<std::int64_t>(left_a.raw) * (std::int64_t { 1 } << frac_bits) / right_a.raw);
+    }
+
+    [[nodiscard]] friend constexpr bool operator==(Fixed left_a, Fixed right_a) = default;
+    [[nodiscard]] friend constexpr std::strong_ordering operator<=>(Fixed left_a, Fixed right_a) = default;
+
+    // found through argument dependent lookup, the way Vector and Matrix call sqrt, sin and cos
+
+    [[nodiscard]] friend constexpr Fixed abs(Fixed value_a)
+    {
+        return value_a.raw < 0 ? -value_a : value_a;
+    }
+    /// @brief Rounded to the nearest value, negative arguments assert and yield zero.
+    [[nodiscard]] friend constexpr Fixed sqrt(Fixed value_a)
+    {
+        assert(value_a.raw >= 0);
+
+        if (value_a.raw <= 0)
+        {
+            return {};
+        }
+
+        // sqrt(raw / 2^frac) * 2^frac == sqrt(raw * 2^frac), digit by digit from the highest power of four
+        std::uint64_t remainder = static_cast<std::uint64_t>(value_a.raw) << frac_bits;
+        std::uint64_t root = 0u;
+        std::uint64_t bit = std::uint64_t { 1 } << ((std::bit_width(remainder) - 1u) & ~std::uint64_t { 1 });
+
+        while (0u != bit)
+        {
+            if (remainder >= root + bit)
+            {
+                remainder -= root + bit;
+                root = (root >> 1u) + bit;
+            }
+            else
+            {
+                root >>= 1u;
+            }
+
+            bit >>= 2u;
+        }
+
+        return from_wide(static_cast<std::int64_t>(remainder > root ? root + 1u : root));
+    }
+    /// @brief Error below 2^-29 before the rounding to frac_bits.
+    [[nodiscard]] friend constexpr Fixed sin(Fixed angle_a)
+    {
+        return from_q30(get_sine_cosine(to_q30(angle_a)).sine);
+    }
+    [[nodiscard]] friend constexpr Fixed cos(Fixed angle_a)
+    {
+        return from_q30(get_sine_cosine(to_q30(angle_a)).cosine);
+    }
+    /// @brief Angle of (x_a, y_a) in [-pi, pi], zero for (0, 0). Error below 2e-6 radians before the rounding to frac_bits.
+    [[nodiscard]] friend constexpr Fixed atan2(Fixed y_a, Fixed x_a)
+    {
+        const std::int64_t x = x_a.raw < 0 ? -static_cast<std::int64_t>(x_a.raw) : x_a.raw;
+        const std::int64_t y = y_a.raw < 0 ? -static_cast<std::int64_t>(y_a.raw) : y_a.raw;
+        const std::int64_t maximum = x > y ? x : y;
+        const std::int64_t minimum = x > y ? y : x;
+
+        if (0 == maximum)
+        {
+            return {};
+        }
+
+        // atan over [0, 1], then mirrored into the octant of (x_a, y_a), the coefficients of fast::atan2
+        const std::int64_t ratio = (minimum << 30u) / maximum;
+        const std::int64_t squared = multiply_q30(ratio, ratio);
+
+        std::int64_t angle = to_q30(-0.01172120);
+        angle = multiply_q30(angle, squared) + to_q30(0.05265332);
+        angle = multiply_q30(angle, squared) - to_q30(0.11643287);
+        angle = multiply_q30(angle, squared) + to_q30(0.19354346);
+        angle = multiply_q30(angle, squared) - to_q30(0.33262347);
+        angle = multiply_q30(multiply_q30(angle, squared) + to_q30(0.99997726), ratio);
+
+        angle = y > x ? to_q30(std::numbers::pi / 2.0) - angle : angle;
+        angle = x_a.raw < 0 ? to_q30(std::numbers::pi) - angle : angle;
+
+        return from_q30(y_a.raw < 0 ? -angle : angle);
+    }
+
+    /// @brief Rounds value_a / 2^shift_a to the nearest integer, halves up.
+    [[nodiscard]] constexpr static std::int64_t round_shift(std::int64_t value_a, std::size_t shift_a)
+    {
+        return 0u == shift_a ? value_a : (value_a + (std::int64_t { 1 } << (shift_a - 1u))) >> shift_a;
+    }
+    /// @brief Narrows a wider intermediate result according to the overflow policy.
+    [[nodiscard]] constexpr static Fixed from_wide(std::int64_t value_a)
+    {
+        constexpr std::int64_t lowest = std::numeric_limits<Raw>::lowest();
+        constexpr std::int64_t highest = std::numeric_limits<Raw>::max();
+
+        if constexpr (Overflow::saturate == overflow)
+        {
+            return from_raw(static_cast<Raw>(value_a < lowest ? lowest : value_a > highest ? highest : value_a));
+        }
+        else
+        {
+            assert(value_a >= lowest && value_a <= highest);
+            return from_raw(static_cast<Raw>(value_a));
+        }
+    }
+
+private:
+    template<std::integral Integer> constexpr static Raw from_integer(Integer value_a)
+    {
+        // clamped first, so the shift cannot overflow the 64 bits
+        constexpr std::int64_t limit = std::int64_t { 1 } << int_bits;
+
+        std::int64_t value = 0;
+
+        if constexpr (std::is_signed_v<Integer>)
+        {
+            value = value_a < -limit ? -limit : value_a > limit ? limit : static_cast<std::int64_t>(value_a);
+        }
+        else
+        {
+            value = value_a > static_cast<std::uint64_t>(limit) ? limit : static_cast<std::int64_t>(value_a);
+        }
+
+        return from_wide(value * (std::int64_t { 1 } << frac_bits)).raw;
+    }
+    constexpr static Raw from_floating(double value_a)
+    {
+        constexpr double limit = static_cast<double>(std::int64_t { 1 } << int_bits);
+
+        assert(value_a == value_a);
+
+        const double value = value_a < -limit ? -limit : value_a > limit ? limit : value_a;
+        const double scaled = value * static_cast<double>(std::int64_t { 1 } << frac_bits);
+
+        return from_wide(static_cast<std::int64_t>(scaled < 0.0 ? scaled - 0.5 : scaled + 0.5)).raw;
+    }
+
+    // the trigonometry runs in Q33.30 on 64 bit integers, which holds every Fixed angle with more fractional bits than any of them
+
+    struct Sine_cosine
+    {
+        std::int64_t sine;
+        std::int64_t cosine;
+    };
+
+    constexpr static std::int64_t to_q30(double value_a)
+    {
+        return static_cast<std::int64_t>(value_a * static_cast<double>(std::int64_t { 1 } << 30u) + (value_a < 0.0 ? -0.5 : 0.5));
+    }
+    constexpr static std::int64_t to_q30(Fixed value_a)
+    {
+        if constexpr (frac_bits > 30u)
+        {
+            return round_shift(value_a.raw, frac_bits - 30u);
+        }
+        else
+        {
+            return static_cast<std::int64_t>(value_a.raw) * (std::int64_t { 1 } << (30u - frac_bits));
+        }
+    }
+    constexpr static Fixed from_q30(std::int64_t value_a)
+    {
+        if constexpr (frac_bits > 30u)
+        {
+            return from_wide(value_a * (std::int64_t { 1 } << (frac_bits - 30u)));
+        }
+        else
+        {
+            return from_wide(round_shift(value_a, 30u - frac_bits));
+        }
+    }
+    constexpr static std::int64_t multiply_q30(std::int64_t left_a, std::int64_t right_a)
+    {
+        return round_shift(left_a * right_a, 30u);
+    }
+
+    constexpr static Sine_cosine get_sine_cosine(std::int64_t angle_a)
+    {
+        // angle = quadrant * pi / 2 + r with r in [-pi / 4, pi / 4), the quadrant by a floor division
+        constexpr std::int64_t half_pi = to_q30(std::numbers::pi / 2.0);
+
+        const std::int64_t shifted = angle_a + half_pi / 2;
+        const std::int64_t quadrant = shifted / half_pi - (shifted < 0 && 0 != shifted % half_pi ? 1 : 0);
+
+        const std::int64_t r = angle_a - quadrant * half_pi;
+        const std::int64_t squared = multiply_q30(r, r);
+
+        // the polynomials of fast::sin and fast::cos
+        std::int64_t sine = to_q30(-1.9515295891e-4);
+        sine = multiply_q30(sine, squared) + to_q30(8.3321608736e-3);
+        sine = multiply_q30(sine, squared) + to_q30(-1.6666654611e-1);
+        sine = r + multiply_q30(multiply_q30(sine, squared), r);
+
+        std::int64_t cosine = to_q30(2.443315711809948e-5);
+        cosine = multiply_q30(cosine, squared) + to_q30(-1.388731625493765e-3);
+        cosine = multiply_q30(cosine, squared) + to_q30(4.166664568298827e-2);
+        cosine = multiply_q30(multiply_q30(cosine, squared), squared) - squared / 2 + (std::int64_t { 1 } << 30u);
+
+        // quadrants 1 and 3 swap sine with cosine, the sign of sine flips in 2 and 3, the sign of cosine in 1 and 2
+        const bool swap = 0 != (quadrant & 1);
+        const std::int64_t quadrant_sine = true == swap ? cosine : sine;
+        const std::int64_t quadrant_cosine = true == swap ? sine : cosine;
+
+        return { .sine = 0 != (quadrant & 2) ? -quadrant_sine : quadrant_sine,
+                 .cosine = 0 != ((quadrant + 1) & 2) ? -quadrant_cosine : quadrant_cosine };
+    }
+
+    Raw raw = 0;
+};
+
+} // namespace lx::math
+
+template<std::size_t int_bits, std::size_t frac_bits, lx::math::Overflow overflow>
+class std::numeric_limits<lx::math::Fixed<int_bits, frac_bits, overflow>>
+{
+    using Fixed = lx::math::Fixed<int_bits, frac_bits, overflow>;
+    using Raw = typename Fixed::Raw;
+
+public:
+    constexpr static bool is_specialized = true;
+    constexpr static bool is_signed = true;
+    constexpr static bool is_integer = false;
+    constexpr static bool is_exact = true;
+    constexpr static bool has_infinity = false;
+    constexpr static bool has_quiet_NaN = false;
+    constexpr static bool has_signaling_NaN = false;
+    constexpr static bool is_bounded = true;
+    constexpr static bool is_modulo = lx::math::Overflow::check == overflow;
+    constexpr static int radix = 2;
+    constexpr static int digits = static_cast<int>(int_bits + frac_bits) - 1;
+
+    /// @brief The smallest value, as for the integer types.
+    [[nodiscard]] constexpr static Fixed min()
+    {
+        return lowest();
+    }
+    [[nodiscard]] constexpr static Fixed lowest()
+    {
+        return Fixed::from_raw(std::numeric_limits<Raw>::lowest());
+    }
+    [[nodiscard]] constexpr static Fixed max()
+    {
+        return Fixed::from_raw(std::numeric_limits<Raw>::max());
+    }
+    /// @brief The step between two neighbouring values.
+    [[nodiscard]] constexpr static Fixed epsilon()
+    {
+        return Fixed::from_raw(1);
+    }
+    [[nodiscard]] constexpr static Fixed round_error()
+    {
+        return Fixed::from_raw(static_cast<Raw>(Fixed::raw_one / 2));
+    }
+};
@@ -1,11 +1,17 @@
+#pragma once
+
 // lx
 #include <lx/common/non_constructible.hpp>
 #include <lx/math/Vector.hpp>
+#include <lx/math/simd.hpp>
 
 // std
 #include <bit>
 #include <cassert>
+#include <cmath>
 #include <cstddef>
+#include <span>
+#include <type_traits>
 
 namespace lx::math {
 template<typename Type, std::size_t dimmensions> struct Matrix : private common::non_constructible
@@ -27,6 +33,8 @@ template<typename Type> struct Matrix<Type, 2u>
         assert(index_a < 2u);
         return std::bit_cast<Vector<Type, 2u>*>(this)[index_a];
     }
+
+    const static Matrix<Type, 2u> identity;
 };
 template<typename Type> struct Matrix<Type, 3u>
 {
@@ -44,6 +52,46 @@ template<typename Type> struct Matrix<Type, 3u>
         assert(index_a < 3u);
         return std::bit_cast<Vector<Type, 3u>*>(this)[index_a];
     }
+
+    // 2D affine transforms in homogeneous coordinates, points are { x, y, 1 } and the last row stays { 0, 0, 1 }
+
+    [[nodiscard]] constexpr static Matrix<Type, 3u> translation(Vector<Type, 2u> offset_a)
+    {
+        return { .column_0 = { .x = static_cast<Type>(1) },
+                 .column_1 = { .y = static_cast<Type>(1) },
+                 .column_2 = { .x = offset_a.x, .y = offset_a.y, .z = static_cast<Type>(1) } };
+    }
+    /// @brief Counterclockwise rotation by angle_a radians. Constant evaluated only where std::sin and std::cos are.
+    [[nodiscard]] constexpr static Matrix<Type, 3u> rotation(Type angle_a)
+    {
+        using std::cos;
+        using std::sin;
+
+        const Type sine = sin(angle_a);
+        const Type cosine = cos(angle_a);
+
+        return { .column_0 = { .x = cosine, .y = sine },
+                 .column_1 = { .x = -sine, .y = cosine },
+                 .column_2 = { .z = static_cast<Type>(1) } };
+    }
+    [[nodiscard]] constexpr static Matrix<Type, 3u> scaling(Vector<Type, 2u> factors_a)
+    {
+        return { .column_0 = { .x = factors_a.x },
+                 .column_1 = { .y = factors_a.y },
+                 .column_2 = { .z = static_cast<Type>(1) } };
+    }
+    /// @brief Maps the rectangle [left_a, right_a] x [bottom_a, top_a] onto [-1, 1] x [-1, 1].
+    [[nodiscard]] constexpr static Matrix<Type, 3u> orthographic(Type left_a, Type right_a, Type bottom_a, Type top_a)
+    {
+        const Type width = right_a - left_a;
+        const Type height = top_a - bottom_a;
+
+        return { .column_0 = { .x = static_cast<Type>(2) / width },
+                 .column_1 = { .y = static_cast<Type>(2) / height },
+                 .column_2 = { .x = -(right_a + left_a) / width, .y = -(top_a + bottom_a) / height, .z = static_cast<Type>(1) } };
+    }
+
+    const static Matrix<Type, 3u> identity;
 };
 template<typename Type> struct Matrix<Type, 4u>
 {
@@ -62,5 +110,522 @@ template<typename Type> struct Matrix<Type, 4u>
         assert(index_a < 4u);
         return std::bit_cast<Vector<Type, 4u>*>(this)[index_a];
     }
+
+    const static Matrix<Type, 4u> identity;
+};
+
+// constexpr, though declared const in the class, which is incomplete there
+template<typename Type> constexpr Matrix<Type, 2u> Matrix<Type, 2u>::identity = {
+    .column_0 = { .x = static_cast<Type>(1) },
+    .column_1 = { .y = static_cast<Type>(1) },
 };
+template<typename Type> constexpr Matrix<Type, 3u> Matrix<Type, 3u>::identity = {
+    .column_0 = { .x = static_cast<Type>(1) },
+    .column_1 = { .y = static_cast<Type>(1) },
+    .column_2 = { .z = static_cast<Type>(1) },
+};
+template<typename Type> constexpr Matrix<Type, 4u> Matrix<Type, 4u>::identity = {
+    .column_0 = { .x = static_cast<Type>(1) },
+    .column_1 = { .y = static_cast<Type>(1) },
+    .column_2 = { .z = static_cast<Type>(1) },
+    .column_3 = { .w = static_cast<Type>(1) },
+};
+
+// Matrices are column major: matrix * vector transforms a column vector and (a * b) * v == a * (b * v).
+// For float the 3x3 and 4x4 operations go through simd, the scalar code is the fallback and the constant evaluation path.
+
+template<typename Type> [[nodiscard]] constexpr bool operator==(const Matrix<Type, 2u>& left_a, const Matrix<Type, 2u>& right_a)
+{
+    return left_a.column_0 == right_a.column_0 && left_a.column_1 == right_a.column_1;
+}
+template<typename Type> [[nodiscard]] constexpr bool operator!=(const Matrix<Type, 2u>& left_a, const Matrix<Type, 2u>& right_a)
+{
+    return false == (left_a == right_a);
+}
+
+template<typename Type> [[nodiscard]] constexpr Vector<Type, 2u> operator*(const Matrix<Type, 2u>& matrix_a, Vector<Type, 2u> vector_a)
+{
+    return matrix_a.column_0 * vector_a.x + matrix_a.column_1 * vector_a.y;
+}
+template<typename Type>
+[[nodiscard]] constexpr Matrix<Type, 2u> operator*(const Matrix<Type, 2u>& left_a, const Matrix<Type, 2u>& right_a)
+{
+    return { .column_0 = left_a * right_a.column_0, .column_1 = left_a * right_a.column_1 };
+}
+
+template<typename Type> [[nodiscard]] constexpr Matrix<Type, 2u> transposed(const Matrix<Type, 2u>& matrix_a)
+{
+    return { .column_0 = { .x = matrix_a.column_0.x, .y = matrix_a.column_1.x },
+             .column_1 = { .x = matrix_a.column_0.y, .y = matrix_a.column_1.y } };
+}
+template<typename Type> [[nodiscard]] constexpr Type determinant(const Matrix<Type, 2u>& matrix_a)
+{
+    return cross(matrix_a.column_0, matrix_a.column_1);
+}
+/// @brief The matrix has to be invertible, a singular one yields infinities.
+template<typename Type> [[nodiscard]] constexpr Matrix<Type, 2u> inverted(const Matrix<Type, 2u>& matrix_a)
+{
+    const Type determinant_reciprocal = static_cast<Type>(1) / determinant(matrix_a);
+
+    return { .column_0 = Vector<Type, 2u> { .x = matrix_a.column_1.y, .y = -matrix_a.column_0.y } * determinant_reciprocal,
+             .column_1 = Vector<Type, 2u> { .x = -matrix_a.column_1.x, .y = matrix_a.column_0.x } * determinant_reciprocal };
+}
+
+template<typename Type> [[nodiscard]] constexpr bool operator==(const Matrix<Type, 3u>& left_a, const Matrix<Type, 3u>& right_a)
+{
+    return left_a.column_0 == right_a.column_0 && left_a.column_1 == right_a.column_1 && left_a.column_2 == right_a.column_2;
+}
+template<typename Type> [[nodiscard]] constexpr bool operator!=(const Matrix<Type, 3u>& left_a, const Matrix<Type, 3u>& right_a)
+{
+    return false == (left_a == right_a);
+}
+
+template<typename Type> [[nodiscard]] constexpr Vector<Type, 3u> operator*(const Matrix<Type, 3u>& matrix_a, Vector<Type, 3u> vector_a)
+{
+    if constexpr (true == simd::is_accelerated<Type>)
+    {
+        if !consteval
+        {
+            simd::float4 result = simd::mul(simd::load3(&matrix_a.column_0.x), simd::splat(vector_a.x));
+            result = simd::multiply_add(simd::load3(&matrix_a.column_1.x), simd::splat(vector_a.y), result);
+            result = simd::multiply_add(simd::load3(&matrix_a.column_2.x), simd::splat(vector_a.z), result);
+
+            Vector<Type, 3u> transformed;
+            simd::store3(&transformed.x, result);
+
+            return transformed;
+        }
+    }
+
+    return matrix_a.column_0 * vector_a.x + matrix_a.column_1 * vector_a.y + matrix_a.column_2 * vector_a.z;
+}
+template<typename Type>
+[[nodiscard]] constexpr Matrix<Type, 3u> operator*(const Matrix<Type, 3u>& left_a, const Matrix<Type, 3u>& right_a)
+{
+    return { .column_0 = left_a * right_a.column_0, .column_1 = left_a * right_a.column_1, .column_2 = left_a * right_a.column_2 };
+}
+
+template<typename Type> [[nodiscard]] constexpr Matrix<Type, 3u> transposed(const Matrix<Type, 3u>& matrix_a)
+{
+    return { .column_0 = { .x = matrix_a.column_0.x, .y = matrix_a.column_1.x, .z = matrix_a.column_2.x },
+             .column_1 = { .x = matrix_a.column_0.y, .y = matrix_a.column_1.y, .z = matrix_a.column_2.y },
+             .column_2 = { .x = matrix_a.column_0.z, .y = matrix_a.column_1.z, .z = matrix_a.column_2.z } };
+}
+template<typename Type> [[nodiscard]] constexpr Type determinant(const Matrix<Type, 3u>& matrix_a)
+{
+    return dot(matrix_a.column_0, cross(matrix_a.column_1, matrix_a.column_2));
+}
+/// @brief The rows of the inverse are the cross products of the column pairs over the determinant. The matrix has to be
+/// invertible, a singular one yields infinities.
+template<typename Type> [[nodiscard]] constexpr Matrix<Type, 3u> inverted(const Matrix<Type, 3u>& matrix_a)
+{
+    const Vector<Type, 3u> row_0 = cross(matrix_a.column_1, matrix_a.column_2);
+    const Vector<Type, 3u> row_1 = cross(matrix_a.column_2, matrix_a.column_0);
+    const Vector<Type, 3u> row_2 = cross(matrix_a.column_0, matrix_a.column_1);
+
+    const Type determinant_reciprocal = static_cast<Type>(1) / dot(matrix_a.column_0, row_0);
+
+    return transposed(Matrix<Type, 3u> { .column_0 = row_0 * determinant_reciprocal,
+                                         .column_1 = row_1 * determinant_reciprocal,
+                                         .column_2 = row_2 * determinant_reciprocal });
+}
+
+/// @brief Transforms a 2D point, w = 1, so the translation applies. The last row is ignored, no perspective divide is done.
+template<typename Type>
+[[nodiscard]] constexpr Vector<Type, 2u> transform_point(const Matrix<Type, 3u>& matrix_a, Vector<Type, 2u> point_a)
+{
+    return { .x = matrix_a.column_0.x * point_a.x + matrix_a.column_1.x * point_a.y + matrix_a.column_2.x,
+             .y = matrix_a.column_0.y * point_a.x + matrix_a.column_1.y * point_a.y + matrix_a.column_2.y };
+}
+
+template<typename Type> [[nodiscard]] constexpr bool operator==(const Matrix<Type, 4u>& left_a, const Matrix<Type, 4u>& right_a)
+{
+    return left_a.column_0 == right_a.column_0 && left_a.column_1 == right_a.column_1 && left_a.column_2 == right_a.column_2 &&
+           left_a.column_3 == right_a.column_3;
+}
+template<typename Type> [[nodiscard]] constexpr bool operator!=(const Matrix<Type, 4u>& left_a, const Matrix<Type, 4u>& right_a)
+{
+    return false == (left_a == right_a);
+}
+
+template<typename Type> [[nodiscard]] constexpr Vector<Type, 4u> operator*(const Matrix<Type, 4u>& matrix_a, Vector<Type, 4u> vector_a)
+{
+    if constexpr (true == simd::is_accelerated<Type>)
+    {
+        if !consteval
+        {
+            const simd::float4 vector = simd::load(&vector_a.x);
+
+            simd::float4 result = simd::mul(simd::load(&matrix_a.column_0.x), simd::splat<0u>(vector));
+            result = simd::multiply_add(simd::load(&matrix_a.column_1.x), simd::splat<1u>(vector), result);
+            result = simd::multiply_add(simd::load(&matrix_a.column_2.x), simd::splat<2u>(vector), result);
+            result = simd::multiply_add(simd::load(&matrix_a.column_3.x), simd::splat<3u>(vector), result);
+
+            Vector<Type, 4u> transformed;
+            simd::store(&transformed.x, result);
+
+            return transformed;
+        }
+    }
+
+    return matrix_a.column_0 * vector_a.x + matrix_a.column_1 * vector_a.y + matrix_a.column_2 * vector_a.z +
+           matrix_a.column_3 * vector_a.w;
+}
+template<typename Type>
+[[nodiscard]] constexpr Matrix<Type, 4u> operator*(const Matrix<Type, 4u>& left_a, const Matrix<Type, 4u>& right_a)
+{
+    if constexpr (true == simd::is_accelerated<Type>)
+    {
+        if !consteval
+        {
+            const simd::float4 left[4] = { simd::load(&left_a.column_0.x),
+                                           simd::load(&left_a.column_1.x),
+                                           simd::load(&left_a.column_2.x),
+                                           simd::load(&left_a.column_3.x) };
+
+            Matrix<Type, 4u> result;
+
+            for (std::size_t i = 0u; i < 4u; i++)
+            {
+                const simd::float4 column = simd::load(&right_a[i].x);
+
+                simd::float4 product = simd::mul(left[0], simd::splat<0u>(column));
+                product = simd::multiply_add(left[1], simd::splat<1u>(column), product);
+                product = simd::multiply_add(left[2], simd::splat<2u>(column), product);
+                product = simd::multiply_add(left[3], simd::splat<3u>(column), product);
+
+                simd::store(&result[i].x, product);
+            }
+
+            return result;
+        }
+    }
+
+    return { .column_0 = left_a * right_a.column_0,
+             .column_1 = left_a * right_a.column_1,
+             .column_2 = left_a * right_a.column_2,
+             .column_3 = left_a * right_a.column_3 };
+}
+
+template<typename Type> [[nodiscard]] constexpr Matrix<Type, 4u> transposed(const Matrix<Type, 4u>& matrix_a)
+{
+    if constexpr (true == simd::is_accelerated<Type>)
+    {
+        if !consteval
+        {
+            const simd::float4 column_0 = simd::load(&matrix_a.column_0.x);
+            const simd::float4 column_1 = simd::load(&matrix_a.column_1.x);
+            const simd::float4 column_2 = simd::load(&matrix_a.column_2.x);
+            const simd::float4 column_3 = simd::load(&matrix_a.column_3.x);
+
+            // { c0.x, c0.y, c1.x, c1.y }, { c2.x, c2.y, c3.x, c3.y }, { c0.z, c0.w, c1.z, c1.w }, { c2.z, c2.w, c3.z, c3.w }
+            const simd::float4 low_01 = simd::shuffle<0u, 1u, 0u, 1u>(column_0, column_1);
+            const simd::float4 low_23 = simd::shuffle<0u, 1u, 0u, 1u>(column_2, column_3);
+            const simd::float4 high_01 = simd::shuffle<2u, 3u, 2u, 3u>(column_0, column_1);
+            const simd::float4 high_23 = simd::shuffle<2u, 3u, 2u, 3u>(column_2, column_3);
+
+            Matrix<Type, 4u> result;
+
+            simd::store(&result.column_0.x, simd::shuffle<0u, 2u, 0u, 2u>(low_01, low_23));
+            simd::store(&result.column_1.x, simd::shuffle<1u, 3u, 1u, 3u>(low_01, low_23));
+            simd::store(&result.column_2.x, simd::shuffle<0u, 2u, 0u, 2u>(high_01, high_23));
+            simd::store(&result.column_3.x, simd::shuffle<1u, 3u, 1u, 3u>(high_01, high_23));
+
+            return result;
+        }
+    }
+
+    return { .column_0 = { .x = matrix_a.column_0.x, .y = matrix_a.column_1.x, .z = matrix_a.column_2.x, .w = matrix_a.column_3.x },
+             .column_1 = { .x = matrix_a.column_0.y, .y = matrix_a.column_1.y, .z = matrix_a.column_2.y, .w = matrix_a.column_3.y },
+             .column_2 = { .x = matrix_a.column_0.z, .y = matrix_a.column_1.z, .z = matrix_a.column_2.z, .w = matrix_a.column_3.z },
+             .column_3 = { .x = matrix_a.column_0.w, .y = matrix_a.column_1.w, .z = matrix_a.column_2.w, .w = matrix_a.column_3.w } };
+}
+
+/// @brief Laplace expansion over the complementary 2x2 minors of the first two and the last two columns.
+template<typename Type> [[nodiscard]] constexpr Type determinant(const Matrix<Type, 4u>& matrix_a)
+{
+    if constexpr (true == simd::is_accelerated<Type>)
+    {
+        if !consteval
+        {
+            const simd::float4 column_0 = simd::load(&matrix_a.column_0.x);
+            const simd::float4 column_1 = simd::load(&matrix_a.column_1.x);
+            const simd::float4 column_2 = simd::load(&matrix_a.column_2.x);
+            const simd::float4 column_3 = simd::load(&matrix_a.column_3.x);
+
+            // minors of the left columns for the rows { (0, 1), (0, 2), (0, 3), (1, 2) } and { (1, 3), (2, 3), -, - }, each lane
+            // paired with the minor of the right columns for the remaining two rows
+            const simd::float4 left = simd::sub(
+                simd::mul(simd::shuffle<0u, 0u, 0u, 1u>(column_0, column_0), simd::shuffle<1u, 2u, 3u, 2u>(column_1, column_1)),
+                simd::mul(simd::shuffle<0u, 0u, 0u, 1u>(column_1, column_1), simd::shuffle<1u, 2u, 3u, 2u>(column_0, column_0)));
+            const simd::float4 left_rest = simd::sub(
+                simd::mul(simd::shuffle<1u, 2u, 1u, 2u>(column_0, column_0), simd::shuffle<3u, 3u, 3u, 3u>(column_1, column_1)),
+                simd::mul(simd::shuffle<1u, 2u, 1u, 2u>(column_1, column_1), simd::shuffle<3u, 3u, 3u, 3u>(column_0, column_0)));
+            const simd::float4 right = simd::sub(
+                simd::mul(simd::shuffle<2u, 1u, 1u, 0u>(column_2, column_2), simd::shuffle<3u, 3u, 2u, 3u>(column_3, column_3)),
+                simd::mul(simd::shuffle<2u, 1u, 1u, 0u>(column_3, column_3), simd::shuffle<3u, 3u, 2u, 3u>(column_2, column_2)));
+            const simd::float4 right_rest = simd::sub(
+                simd::mul(simd::shuffle<0u, 0u, 0u, 0u>(column_2, column_2), simd::shuffle<2u, 1u, 2u, 1u>(column_3, column_3)),
+                simd::mul(simd::shuffle<0u, 0u, 0u, 0u>(column_3, column_3), simd::shuffle<2u, 1u, 2u, 1u>(column_2, column_2)));
+
+            // signs of the row permutations, the duplicated last two lanes of the rest are masked out
+            const simd::float4 products = simd::mul(simd::mul(left, right), simd::set(1.0f, -1.0f, 1.0f, 1.0f));
+            const simd::float4 products_rest = simd::mul(simd::mul(left_rest, right_rest), simd::set(-1.0f, 1.0f, 0.0f, 0.0f));
+
+            return simd::get_x(simd::sum(simd::add(products, products_rest)));
+        }
+    }
+
+    const Vector<Type, 4u>& c0 = matrix_a.column_0;
+    const Vector<Type, 4u>& c1 = matrix_a.column_1;
+    const Vector<Type, 4u>& c2 = matrix_a.column_2;
+    const Vector<Type, 4u>& c3 = matrix_a.column_3;
+
+    return (c0.x * c1.y - c1.x * c0.y) * (c2.z * c3.w - c3.z * c2.w) - (c0.x * c1.z - c1.x * c0.z) * (c2.y * c3.w - c3.y * c2.w) +
+           (c0.x * c1.w - c1.x * c0.w) * (c2.y * c3.z - c3.y * c2.z) + (c0.y * c1.z - c1.y * c0.z) * (c2.x * c3.w - c3.x * c2.w) -
+           (c0.y * c1.w - c1.y * c0.w) * (c2.x * c3.z - c3.x * c2.z) + (c0.z * c1.w - c1.z * c0.w) * (c2.x * c3.y - c3.x * c2.y);
+}
+
+/// @brief Inverse by cofactors. The matrix has to be invertible, a singular one yields infinities.
+template<typename Type> [[nodiscard]] constexpr Matrix<Type, 4u> inverted(const Matrix<Type, 4u>& matrix_a)
+{
+    if constexpr (true == simd::is_accelerated<Type>)
+    {
+        if !consteval
+        {
+            const simd::float4 column_0 = simd::load(&matrix_a.column_0.x);
+            const simd::float4 column_1 = simd::load(&matrix_a.column_1.x);
+            const simd::float4 column_2 = simd::load(&matrix_a.column_2.x);
+            const simd::float4 column_3 = simd::load(&matrix_a.column_3.x);
+
+            // 2x2 minors of the last three columns taken from rows (i, j):
+            // { m2i * m3j - m3i * m2j, (same), m1i * m3j - m3i * m1j, m1i * m2j - m2i * m1j }
+            const auto minors = [&]<std::size_t i, std::size_t j>() {
+                const simd::float4 a = simd::shuffle<i, i, i, i>(column_2, column_1);
+                const simd::float4 b = simd::shuffle<j, j, j, j>(column_3, column_2);
+                const simd::float4 c = simd::shuffle<i, i, i, i>(column_3, column_2);
+                const simd::float4 d = simd::shuffle<j, j, j, j>(column_2, column_1);
+
+                return simd::sub(simd::mul(a, simd::shuffle<0u, 0u, 0u, 2u>(b, b)), simd::mul(simd::shuffle<0u, 0u, 0u, 2u>(c, c), d));
+            };
+
+            const simd::float4 factor_0 = minors.template operator()<2u, 3u>();
+            const simd::float4 factor_1 = minors.template operator()<1u, 3u>();
+            const simd::float4 factor_2 = minors.template operator()<1u, 2u>();
+            const simd::float4 factor_3 = minors.template operator()<0u, 3u>();
+            const simd::float4 factor_4 = minors.template operator()<0u, 2u>();
+            const simd::float4 factor_5 = minors.template operator()<0u, 1u>();
+
+            // row r of the first two columns as { m1r, m0r, m0r, m0r }
+            const auto row = [&]<std::size_t r>() {
+                const simd::float4 pairs = simd::shuffle<r, r, r, r>(column_1, column_0);
+                return simd::shuffle<0u, 2u, 2u, 2u>(pairs, pairs);
+            };
+
+            const simd::float4 row_0 = row.template operator()<0u>();
+            const simd::float4 row_1 = row.template operator()<1u>();
+            const simd::float4 row_2 = row.template operator()<2u>();
+            const simd::float4 row_3 = row.template operator()<3u>();
+
+            const simd::float4 sign_a = simd::set(1.0f, -1.0f, 1.0f, -1.0f);
+            const simd::float4 sign_b = simd::set(-1.0f, 1.0f, -1.0f, 1.0f);
+
+            const simd::float4 inverse_0 = simd::mul(
+                simd::add(simd::sub(simd::mul(row_1, factor_0), simd::mul(row_2, factor_1)), simd::mul(row_3, factor_2)), sign_a);
+            const simd::float4 inverse_1 = simd::mul(
+                simd::add(simd::sub(simd::mul(row_0, factor_0), simd::mul(row_2, factor_3)), simd::mul(row_3, factor_4)), sign_b);
+            const simd::float4 inverse_2 = simd::mul(
+                simd::add(simd::sub(simd::mul(row_0, factor_1), simd::mul(row_1, factor_3)), simd::mul(row_3, factor_5)), sign_a);
+            const simd::float4 inverse_3 = simd::mul(
+                simd::add(simd::sub(simd::mul(row_0, factor_2), simd::mul(row_1, factor_4)), simd::mul(row_2, factor_5)), sign_b);
+
+            // determinant: the first column dotted with the first row of the adjugate
+            const simd::float4 firsts_01 = simd::shuffle<0u, 0u, 0u, 0u>(inverse_0, inverse_1);
+            const simd::float4 firsts_23 = simd::shuffle<0u, 0u, 0u, 0u>(inverse_2, inverse_3);
+            const simd::float4 firsts = simd::shuffle<0u, 2u, 0u, 2u>(firsts_01, firsts_23);
+            const simd::float4 determinant_reciprocal = simd::div(simd::splat(1.0f), simd::dot(column_0, firsts));
+
+            Matrix<Type, 4u> result;
+
+            simd::store(&result.column_0.x, simd::mul(inverse_0, determinant_reciprocal));
+            simd::store(&result.column_1.x, simd::mul(inverse_1, determinant_reciprocal));
+            simd::store(&result.column_2.x, simd::mul(inverse_2, determinant_reciprocal));
+            simd::store(&result.column_3.x, simd::mul(inverse_3, determinant_reciprocal));
+
+            return result;
+        }
+    }
+
+    // operator[] is not usable in constant expressions
+    const auto at = [](const Vector<Type, 4u>& column_a, std::size_t row_a) -> Type {
+        return 0u == row_a ? column_a.x : 1u == row_a ? column_a.y : 2u == row_a ? column_a.z : column_a.w;
+    };
+    const auto minors = [&](std::size_t i_a, std::size_t j_a) -> Vector<Type, 4u> {
+        const Vector<Type, 4u>& c1 = matrix_a.column_1;
+        const Vector<Type, 4u>& c2 = matrix_a.column_2;
+        const Vector<Type, 4u>& c3 = matrix_a.column_3;
+
+        const Type m23 = at(c2, i_a) * at(c3, j_a) - at(c3, i_a) * at(c2, j_a);
+        const Type m13 = at(c1, i_a) * at(c3, j_a) - at(c3, i_a) * at(c1, j_a);
+        const Type m12 = at(c1, i_a) * at(c2, j_a) - at(c2, i_a) * at(c1, j_a);
+
+        return { .x = m23, .y = m23, .z = m13, .w = m12 };
+    };
+    const auto row = [&](std::size_t r_a) -> Vector<Type, 4u> {
+        const Type first = at(matrix_a.column_0, r_a);
+        return { .x = at(matrix_a.column_1, r_a), .y = first, .z = first, .w = first };
+    };
+    const auto multiply = [](Vector<Type, 4u> left_a, Vector<Type, 4u> right_a) -> Vector<Type, 4u> {
+        return { .x = left_a.x * right_a.x, .y = left_a.y * right_a.y, .z = left_a.z * right_a.z, .w = left_a.w * right_a.w };
+    };
+
+    const Vector<Type, 4u> factor_0 = minors(2u, 3u);
+    const Vector<Type, 4u> factor_1 = minors(1u, 3u);
+    const Vector<Type, 4u> factor_2 = minors(1u, 2u);
+    const Vector<Type, 4u> factor_3 = minors(0u, 3u);
+    const Vector<Type, 4u> factor_4 = minors(0u, 2u);
+    const Vector<Type, 4u> factor_5 = minors(0u, 1u);
+
+    const Vector<Type, 4u> row_0 = row(0u);
+    const Vector<Type, 4u> row_1 = row(1u);
+    const Vector<Type, 4u> row_2 = row(2u);
+    const Vector<Type, 4u> row_3 = row(3u);
+
+    const Type one = static_cast<Type>(1);
+    const Vector<Type, 4u> sign_a { .x = one, .y = -one, .z = one, .w = -one };
+    const Vector<Type, 4u> sign_b { .x = -one, .y = one, .z = -one, .w = one };
+
+    const Vector<Type, 4u> inverse_0 =
+        multiply(multiply(row_1, factor_0) - multiply(row_2, factor_1) + multiply(row_3, factor_2), sign_a);
+    const Vector<Type, 4u> inverse_1 =
+        multiply(multiply(row_0, factor_0) - multiply(row_2, factor_3) + multiply(row_3, factor_4), sign_b);
+    const Vector<Type, 4u> inverse_2 =
+        multiply(multiply(row_0, factor_1) - multiply(row_1, factor_3) + multiply(row_3, factor_5), sign_a);
+    const Vector<Type, 4u> inverse_3 =
+        multiply(multiply(row_0, factor_2) - multiply(row_1, factor_4) + multiply(row_2, factor_5), sign_b);
+
+    const Type determinant = matrix_a.column_0.x * inverse_0.x + matrix_a.column_0.y * inverse_1.x +
+                             matrix_a.column_0.z * inverse_2.x + matrix_a.column_0.w * inverse_3.x;
+    const Type determinant_reciprocal = one / determinant;
+
+    return { .column_0 = inverse_0 * determinant_reciprocal,
+             .column_1 = inverse_1 * determinant_reciprocal,
+             .column_2 = inverse_2 * determinant_reciprocal,
+             .column_3 = inverse_3 * determinant_reciprocal };
+}
+
+/// @brief Transforms a point, w = 1, so the translation applies. No perspective divide is done.
+template<typename Type>
+[[nodiscard]] constexpr Vector<Type, 3u> transform_point(const Matrix<Type, 4u>& matrix_a, Vector<Type, 3u> point_a)
+{
+    if constexpr (true == simd::is_accelerated<Type>)
+    {
+        if !consteval
+        {
+            simd::float4 result = simd::load(&matrix_a.column_3.x);
+            result = simd::multiply_add(simd::load(&matrix_a.column_0.x), simd::splat(point_a.x), result);
+            result = simd::multiply_add(simd::load(&matrix_a.column_1.x), simd::splat(point_a.y), result);
+            result = simd::multiply_add(simd::load(&matrix_a.column_2.x), simd::splat(point_a.z), result);
+
+            Vector<Type, 3u> transformed;
+            simd::store3(&transformed.x, result);
+
+            return transformed;
+        }
+    }
+
+    const Vector<Type, 4u> result =
+        matrix_a * Vector<Type, 4u> { .x = point_a.x, .y = point_a.y, .z = point_a.z, .w = static_cast<Type>(1) };
+    return { .x = result.x, .y = result.y, .z = result.z };
+}
+/// @brief Transforms a 2D point lying on the z = 0 plane, w = 1.
+template<typename Type>
+[[nodiscard]] constexpr Vector<Type, 2u> transform_point(const Matrix<Type, 4u>& matrix_a, Vector<Type, 2u> point_a)
+{
+    return { .x = matrix_a.column_0.x * point_a.x + matrix_a.column_1.x * point_a.y + matrix_a.column_3.x,
+             .y = matrix_a.column_0.y * point_a.x + matrix_a.column_1.y * point_a.y + matrix_a.column_3.y };
+}
+
+/// @brief Transforms points_a into transformed_a, both spans have the same length and may be the same memory. Spans are not
+/// deduced, so containers convert to them directly.
+/// Two (SSE/NEON) or four (AVX) points are transformed per iteration.
+template<typename Type>
+void transform_points(const Matrix<Type, 4u>& matrix_a,
+                      std::type_identity_t<std::span<const Vector<Type, 2u>>> points_a,
+                      std::type_identity_t<std::span<Vector<Type, 2u>>> transformed_a)
+{
+    assert(points_a.size() == transformed_a.size());
+
+    std::size_t i = 0u;
+
+    if constexpr (true == simd::is_accelerated<Type>)
+    {
+        // points are interleaved { x0, y0, x1, y1 }: x and y are spread over pairs of lanes and multiplied by the matching
+        // { m0x, m0y, m0x, m0y } and { m1x, m1y, m1x, m1y } columns
+        const float* source = reinterpret_cast<const float*>(points_a.data());
+        float* destination = reinterpret_cast<float*>(transformed_a.data());
+
+        const simd::float4 column_0 = simd::load(&matrix_a.column_0.x);
+        const simd::float4 column_1 = simd::load(&matrix_a.column_1.x);
+        const simd::float4 column_3 = simd::load(&matrix_a.column_3.x);
+
+        const simd::float4 xs = simd::shuffle<0u, 1u, 0u, 1u>(column_0, column_0);
+        const simd::float4 ys = simd::shuffle<0u, 1u, 0u, 1u>(column_1, column_1);
+        const simd::float4 translation = simd::shuffle<0u, 1u, 0u, 1u>(column_3, column_3);
+
+#if defined(LX_MATH_SIMD_AVX)
+        const __m256 xs_8 = _mm256_insertf128_ps(_mm256_castps128_ps256(xs), xs, 1);
+        const __m256 ys_8 = _mm256_insertf128_ps(_mm256_castps128_ps256(ys), ys, 1);
+        const __m256 translation_8 = _mm256_insertf128_ps(_mm256_castps128_ps256(translation), translation, 1);
+
+        for (; i + 4u <= points_a.size(); i += 4u)
+        {
+            const __m256 points = _mm256_loadu_ps(source + i * 2u);
+
+            __m256 result = _mm256_add_ps(translation_8, _mm256_mul_ps(_mm256_moveldup_ps(points), xs_8));
+            result = _mm256_add_ps(result, _mm256_mul_ps(_mm256_movehdup_ps(points), ys_8));
+
+            _mm256_storeu_ps(destination + i * 2u, result);
+        }
+#endif
+        for (; i + 2u <= points_a.size(); i += 2u)
+        {
+            const simd::float4 points = simd::load(source + i * 2u);
+
+            simd::float4 result = simd::multiply_add(simd::shuffle<0u, 0u, 2u, 2u>(points, points), xs, translation);
+            result = simd::multiply_add(simd::shuffle<1u, 1u, 3u, 3u>(points, points), ys, result);
+
+            simd::store(destination + i * 2u, result);
+        }
+    }
+
+    for (; i < points_a.size(); i++)
+    {
+        transformed_a[i] = transform_point(matrix_a, points_a[i]);
+    }
+}
+template<typename Type>
+void transform_points(const Matrix<Type, 4u>& matrix_a,
+                      std::type_identity_t<std::span<const Vector<Type, 3u>>> points_a,
+                      std::type_identity_t<std::span<Vector<Type, 3u>>> transformed_a)
+{
+    assert(points_a.size() == transformed_a.size());
+
+    for (std::size_t i = 0u; i < points_a.size(); i++)
+    {
+        transformed_a[i] = transform_point(matrix_a, points_a[i]);
+    }
+}
+template<typename Type>
+void transform(const Matrix<Type, 4u>& matrix_a,
+               std::type_identity_t<std::span<const Vector<Type, 4u>>> vectors_a,
+               std::type_identity_t<std::span<Vector<Type, 4u>>> transformed_a)
+{
+    assert(vectors_a.size() == transformed_a.size());
+
+    for (std::size_t i = 0u; i < vectors_a.size(); i++)
+    {
+        transformed_a[i] = matrix_a * vectors_a[i];
+    }
+}
 } // namespace lx::math
\ No newline at end of file
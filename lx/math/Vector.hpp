@@ -3,12 +3,15 @@
 // lx
 #include <lx/common/non_constructible.hpp>
 #include <lx/common/out.hpp>
+#include <lx/math/simd.hpp>
 #include <lx/math/tools.hpp>
 
 // std
 #include <bit>
 #include <cassert>
+#include <cmath>
 #include <cstddef>
+#include <type_traits>
 
 namespace lx::math {
 template<typename Type, std::size_t dimmensions> struct Vector : private common::non_constructible
@@ -33,11 +36,11 @@ template<typename Type> struct Vector<Type, 2u>
         return std::bit_cast<Type*>(this)[index_a];
     }
 
-    constexpr [[nodiscard]] Vector<Type, 2u> operator-() const
+    [[nodiscard]] constexpr Vector<Type, 2u> operator-() const
     {
         return { .x = -this->x, .y = -this->y };
     }
-    constexpr [[nodiscard]] Vector<Type, 2u> operator+() const
+    [[nodiscard]] constexpr Vector<Type, 2u> operator+() const
     {
         return { .x = +this->x, .y = +this->y };
     }
@@ -49,11 +52,11 @@ template<typename Type> struct Vector<Type, 2u>
 template<typename Type> const Vector<Type, 2u> Vector<Type, 2u>::unit_x = { static_cast<Type>(1), static_cast<Type>(0) };
 template<typename Type> const Vector<Type, 2u> Vector<Type, 2u>::unit_y = { static_cast<Type>(0), static_cast<Type>(1) };
 
-template<typename Type> [[nodiscard]] bool operator==(Vector<Type, 2u> left_a, Vector<Type, 2u> right_a)
+template<typename Type> [[nodiscard]] constexpr bool operator==(Vector<Type, 2u> left_a, Vector<Type, 2u> right_a)
 {
     return tools::is_equal(left_a.x, right_a.x) && tools::is_equal(left_a.y, right_a.y);
 }
-template<typename Type> [[nodiscard]] bool operator!=(Vector<Type, 2u> left_a, Vector<Type, 2u> right_a)
+template<typename Type> [[nodiscard]] constexpr bool operator!=(Vector<Type, 2u> left_a, Vector<Type, 2u> right_a)
 {
     return false == (left_a == right_a);
 }
@@ -76,25 +79,25 @@ template<typename Type> [[nodiscard]] bool operator<=(Vector<Type, 2u> left_a, V
     return left_a.x <= right_a.x && left_a.y <= right_a.y;
 }
 
-template<typename Type> constexpr [[nodiscard]] Vector<Type, 2u> operator+(Vector<Type, 2u> left_a, Vector<Type, 2u> right_a)
+template<typename Type> [[nodiscard]] constexpr Vector<Type, 2u> operator+(Vector<Type, 2u> left_a, Vector<Type, 2u> right_a)
 {
     return { .x = left_a.x + right_a.x, .y = left_a.y + right_a.y };
 }
-template<typename Type> constexpr [[nodiscard]] Vector<Type, 2u> operator-(Vector<Type, 2u> left_a, Vector<Type, 2u> right_a)
+template<typename Type> [[nodiscard]] constexpr Vector<Type, 2u> operator-(Vector<Type, 2u> left_a, Vector<Type, 2u> right_a)
 {
     return { .x = left_a.x - right_a.x, .y = left_a.y - right_a.y };
 }
 
-template<typename Type> constexpr [[nodiscard]] Vector<Type, 2u> operator*(Vector<Type, 2u> left_a, Type right_a)
+template<typename Type> [[nodiscard]] constexpr Vector<Type, 2u> operator*(Vector<Type, 2u> left_a, Type right_a)
 {
     return { .x = left_a.x * right_a, .y = left_a.y * right_a };
 }
-template<typename Type> constexpr [[nodiscard]] Vector<Type, 2u> operator*(Type left_a, Vector<Type, 2u> right_a)
+template<typename Type> [[nodiscard]] constexpr Vector<Type, 2u> operator*(Type left_a, Vector<Type, 2u> right_a)
 {
     return right_a * left_a;
 }
 
-template<typename Type> constexpr [[nodiscard]] Vector<Type, 2u> operator/(Vector<Type, 2u> left_a, Type right_a)
+template<typename Type> [[nodiscard]] constexpr Vector<Type, 2u> operator/(Vector<Type, 2u> left_a, Type right_a)
 {
     return { .x = left_a.x / right_a, .y = left_a.y / right_a };
 }
@@ -104,23 +107,25 @@ template<typename Type> constexpr void zero(lx::common::out<Vector<Type, 2u>> ve
     vec_a->x = static_cast<Type>(0);
     vec_a->y = static_cast<Type>(0);
 }
-template<typename Type> constexpr [[nodiscard]] Type zeroed()
+template<typename Type> [[nodiscard]] constexpr Type zeroed()
 {
     return {};
 }
-template<typename Type> constexpr [[nodiscard]] bool is_zero(const Vector<Type, 2u>& vector_a)
+template<typename Type> [[nodiscard]] constexpr bool is_zero(const Vector<Type, 2u>& vector_a)
 {
     return Vector<Type, 2u> { .x = static_cast<Type>(0), .y = static_cast<Type>(0) } == vector_a;
 }
 
-template<typename Type> constexpr [[nodiscard]] Type length_squared(Vector<Type, 2u> vector_a)
+template<typename Type> [[nodiscard]] constexpr Type length_squared(Vector<Type, 2u> vector_a)
 {
     return vector_a.x * vector_a.x + vector_a.y * vector_a.y;
 }
-template<typename Type> constexpr Type [[nodiscard]] length(Vector<Type, 2u> vector_a)
+template<typename Type> [[nodiscard]] constexpr Type length(Vector<Type, 2u> vector_a)
 {
     Type sq = length_squared(vector_a);
-    return static_cast<Type>(std::sqrt(sq));
+    // unqualified, so element types other than the built in ones bring their own through argument dependent lookup
+    using std::sqrt;
+    return static_cast<Type>(sqrt(sq));
 }
 
 template<typename Type> constexpr void normalize(lx::common::out<Vector<Type, 2u>> vector_a)
@@ -137,7 +142,7 @@ template<typename Type> constexpr Vector<Type, 2u> normalized(Vector<Type, 2u> v
 }
 template<typename Type> constexpr bool is_normalized(Vector<Type, 2u> vector_a)
 {
-    return tools::is_equal(1.0f, length(vector_a));
+    return tools::is_equal(static_cast<Type>(1), length(vector_a));
 }
 
 template<typename Type> constexpr Type dot(Vector<Type, 2u> left_a, Vector<Type, 2u> right_a)
@@ -149,9 +154,9 @@ template<typename Type> constexpr Type cross(Vector<Type, 2u> left_a, Vector<Typ
     return left_a.x * right_a.y - left_a.y * right_a.x;
 }
 
-template<typename Type> Vector<Type, 2u> lerp(Vector<Type, 2u> start_a, const Vector<Type, 2u> end_a, float step_a)
+template<typename Type> Vector<Type, 2u> lerp(Vector<Type, 2u> start_a, const Vector<Type, 2u> end_a, std::type_identity_t<Type> step_a)
 {
-    return start_a * (1.0f - step_a) + end_a * step_a;
+    return start_a * (static_cast<Type>(1) - step_a) + end_a * step_a;
 }
 
 template<typename Type> struct Vector<Type, 3u>
@@ -173,16 +178,18 @@ template<typename Type> struct Vector<Type, 3u>
         return std::bit_cast<Type*>(this)[index_a];
     }
 
-    [[nodiscard]] constexpr Vector<Type, 2u> operator-() const
+    [[nodiscard]] constexpr Vector<Type, 3u> operator-() const
     {
         return { .x = -this->x, .y = -this->y, .z = -this->z };
     }
-    [[nodiscard]] constexpr Vector<Type, 2u> operator+() const
+    [[nodiscard]] constexpr Vector<Type, 3u> operator+() const
     {
         return { .x = +this->x, .y = +this->y, .z = +this->z };
     }
 };
-template<typename Type> struct Vector<Type, 4u>
+
+// aligned to its size, so a Vector<float, 4u> is a single aligned SSE/NEON load
+template<typename Type> struct alignas(4u * sizeof(Type)) Vector<Type, 4u>
 {
     Type x = static_cast<Type>(0);
     Type y = static_cast<Type>(0);
@@ -202,16 +209,77 @@ template<typename Type> struct Vector<Type, 4u>
         return std::bit_cast<Type*>(this)[index_a];
     }
 
-    [[nodiscard]] constexpr Vector<Type, 2u> operator-() const
+    [[nodiscard]] constexpr Vector<Type, 4u> operator-() const
     {
         return { .x = -this->x, .y = -this->y, .z = -this->z, .w = -this->w };
     }
-    [[nodiscard]] constexpr Vector<Type, 2u> operator+() const
+    [[nodiscard]] constexpr Vector<Type, 4u> operator+() const
     {
-        return { .x = +this->x, .y = +this->y, .z = +this->z, .w = -this->w };
+        return { .x = +this->x, .y = +this->y, .z = +this->z, .w = +this->w };
     }
 };
 
+template<typename Type> [[nodiscard]] constexpr bool operator==(Vector<Type, 3u> left_a, Vector<Type, 3u> right_a)
+{
+    return tools::is_equal(left_a.x, right_a.x) && tools::is_equal(left_a.y, right_a.y) && tools::is_equal(left_a.z, right_a.z);
+}
+template<typename Type> [[nodiscard]] constexpr bool operator!=(Vector<Type, 3u> left_a, Vector<Type, 3u> right_a)
+{
+    return false == (left_a == right_a);
+}
+template<typename Type> [[nodiscard]] constexpr bool operator==(Vector<Type, 4u> left_a, Vector<Type, 4u> right_a)
+{
+    return tools::is_equal(left_a.x, right_a.x) && tools::is_equal(left_a.y, right_a.y) && tools::is_equal(left_a.z, right_a.z) &&
+           tools::is_equal(left_a.w, right_a.w);
+}
+template<typename Type> [[nodiscard]] constexpr bool operator!=(Vector<Type, 4u> left_a, Vector<Type, 4u> right_a)
+{
+    return false == (left_a == right_a);
+}
+
+// element wise operators stay scalar: compilers vectorize them on their own and they remain usable in constant expressions
+template<typename Type> [[nodiscard]] constexpr Vector<Type, 3u> operator+(Vector<Type, 3u> left_a, Vector<Type, 3u> right_a)
+{
+    return { .x = left_a.x + right_a.x, .y = left_a.y + right_a.y, .z = left_a.z + right_a.z };
+}
+template<typename Type> [[nodiscard]] constexpr Vector<Type, 3u> operator-(Vector<Type, 3u> left_a, Vector<Type, 3u> right_a)
+{
+    return { .x = left_a.x - right_a.x, .y = left_a.y - right_a.y, .z = left_a.z - right_a.z };
+}
+template<typename Type> [[nodiscard]] constexpr Vector<Type, 3u> operator*(Vector<Type, 3u> left_a, Type right_a)
+{
+    return { .x = left_a.x * right_a, .y = left_a.y * right_a, .z = left_a.z * right_a };
+}
+template<typename Type> [[nodiscard]] constexpr Vector<Type, 3u> operator*(Type left_a, Vector<Type, 3u> right_a)
+{
+    return right_a * left_a;
+}
+template<typename Type> [[nodiscard]] constexpr Vector<Type, 3u> operator/(Vector<Type, 3u> left_a, Type right_a)
+{
+    return { .x = left_a.x / right_a, .y = left_a.y / right_a, .z = left_a.z / right_a };
+}
+
+template<typename Type> [[nodiscard]] constexpr Vector<Type, 4u> operator+(Vector<Type, 4u> left_a, Vector<Type, 4u> right_a)
+{
+    return { .x = left_a.x + right_a.x, .y = left_a.y + right_a.y, .z = left_a.z + right_a.z, .w = left_a.w + right_a.w };
+}
+template<typename Type> [[nodiscard]] constexpr Vector<Type, 4u> operator-(Vector<Type, 4u> left_a, Vector<Type, 4u> right_a)
+{
+    return { .x = left_a.x - right_a.x, .y = left_a.y - right_a.y, .z = left_a.z - right_a.z, .w = left_a.w - right_a.w };
+}
+template<typename Type> [[nodiscard]] constexpr Vector<Type, 4u> operator*(Vector<Type, 4u> left_a, Type right_a)
+{
+    return { .x = left_a.x * right_a, .y = left_a.y * right_a, .z = left_a.z * right_a, .w = left_a.w * right_a };
+}
+template<typename Type> [[nodiscard]] constexpr Vector<Type, 4u> operator*(Type left_a, Vector<Type, 4u> right_a)
+{
+    return right_a * left_a;
+}
+template<typename Type> [[nodiscard]] constexpr Vector<Type, 4u> operator/(Vector<Type, 4u> left_a, Type right_a)
+{
+    return { .x = left_a.x / right_a, .y = left_a.y / right_a, .z = left_a.z / right_a, .w = left_a.w / right_a };
+}
+
 template<typename Type> void zero(lx::common::out<Vector<Type, 3u>> vec_a)
 {
     vec_a->x = static_cast<Type>(0);
@@ -225,24 +293,144 @@ template<typename Type> void zero(lx::common::out<Vector<Type, 4u>> vec_a)
     vec_a->z = static_cast<Type>(0);
     vec_a->w = static_cast<Type>(0);
 }
+template<typename Type> [[nodiscard]] constexpr bool is_zero(const Vector<Type, 3u>& vector_a)
+{
+    return Vector<Type, 3u> {} == vector_a;
+}
+template<typename Type> [[nodiscard]] constexpr bool is_zero(const Vector<Type, 4u>& vector_a)
+{
+    return Vector<Type, 4u> {} == vector_a;
+}
 
-template<typename Type> constexpr [[nodiscard]] Type length_squared(Vector<Type, 3u> vector_a)
+template<typename Type> [[nodiscard]] constexpr Type dot(Vector<Type, 3u> left_a, Vector<Type, 3u> right_a)
 {
-    return vector_a.x * vector_a.x + vector_a.y * vector_a.y + vector_a.z * vector_a.z;
+    if constexpr (true == simd::is_accelerated<Type>)
+    {
+        if !consteval
+        {
+            return simd::get_x(simd::dot(simd::load3(&left_a.x), simd::load3(&right_a.x)));
+        }
+    }
+
+    return left_a.x * right_a.x + left_a.y * right_a.y + left_a.z * right_a.z;
 }
-template<typename Type> constexpr [[nodiscard]] Type length_squared(Vector<Type, 4u> vector_a)
+template<typename Type> [[nodiscard]] constexpr Type dot(Vector<Type, 4u> left_a, Vector<Type, 4u> right_a)
 {
-    return vector_a.x * vector_a.x + vector_a.y * vector_a.y + vector_a.z * vector_a.z + vector_a.w * vector_a.w;
+    if constexpr (true == simd::is_accelerated<Type>)
+    {
+        if !consteval
+        {
+            return simd::get_x(simd::dot(simd::load(&left_a.x), simd::load(&right_a.x)));
+        }
+    }
+
+    return left_a.x * right_a.x + left_a.y * right_a.y + left_a.z * right_a.z + left_a.w * right_a.w;
 }
+template<typename Type> [[nodiscard]] constexpr Vector<Type, 3u> cross(Vector<Type, 3u> left_a, Vector<Type, 3u> right_a)
+{
+    if constexpr (true == simd::is_accelerated<Type>)
+    {
+        if !consteval
+        {
+            // left.yzx * right.zxy - left.zxy * right.yzx
+            const simd::float4 left = simd::load3(&left_a.x);
+            const simd::float4 right = simd::load3(&right_a.x);
+
+            const simd::float4 result =
+                simd::sub(simd::mul(simd::shuffle<1u, 2u, 0u, 3u>(left, left), simd::shuffle<2u, 0u, 1u, 3u>(right, right)),
+                          simd::mul(simd::shuffle<2u, 0u, 1u, 3u>(left, left), simd::shuffle<1u, 2u, 0u, 3u>(right, right)));
+
+            Vector<Type, 3u> vector;
+            simd::store3(&vector.x, result);
 
-template<typename Type> constexpr Type [[nodiscard]] length(Vector<Type, 3u> vector_a)
+            return vector;
+        }
+    }
+
+    return { .x = left_a.y * right_a.z - left_a.z * right_a.y,
+             .y = left_a.z * right_a.x - left_a.x * right_a.z,
+             .z = left_a.x * right_a.y - left_a.y * right_a.x };
+}
+
+template<typename Type> [[nodiscard]] constexpr Type length_squared(Vector<Type, 3u> vector_a)
+{
+    return dot(vector_a, vector_a);
+}
+template<typename Type> [[nodiscard]] constexpr Type length_squared(Vector<Type, 4u> vector_a)
+{
+    return dot(vector_a, vector_a);
+}
+
+template<typename Type> [[nodiscard]] constexpr Type length(Vector<Type, 3u> vector_a)
 {
     Type sq = length_squared(vector_a);
-    return static_cast<Type>(std::sqrt(sq));
+    using std::sqrt;
+    return static_cast<Type>(sqrt(sq));
 }
-template<typename Type> constexpr Type [[nodiscard]] length(Vector<Type, 4u> vector_a)
+template<typename Type> [[nodiscard]] constexpr Type length(Vector<Type, 4u> vector_a)
 {
     Type sq = length_squared(vector_a);
-    return static_cast<Type>(std::sqrt(sq));
+    using std::sqrt;
+    return static_cast<Type>(sqrt(sq));
+}
+
+template<typename Type> [[nodiscard]] constexpr Vector<Type, 3u> normalized(Vector<Type, 3u> vector_a)
+{
+    if constexpr (true == simd::is_accelerated<Type>)
+    {
+        if !consteval
+        {
+            const simd::float4 vector = simd::load3(&vector_a.x);
+
+            Vector<Type, 3u> result;
+            simd::store3(&result.x, simd::div(vector, simd::sqrt(simd::dot(vector, vector))));
+
+            return result;
+        }
+    }
+
+    return vector_a / length(vector_a);
+}
+template<typename Type> [[nodiscard]] constexpr Vector<Type, 4u> normalized(Vector<Type, 4u> vector_a)
+{
+    if constexpr (true == simd::is_accelerated<Type>)
+    {
+        if !consteval
+        {
+            const simd::float4 vector = simd::load(&vector_a.x);
+
+            Vector<Type, 4u> result;
+            simd::store(&result.x, simd::div(vector, simd::sqrt(simd::dot(vector, vector))));
+
+            return result;
+        }
+    }
+
+    return vector_a / length(vector_a);
+}
+template<typename Type> constexpr void normalize(lx::common::out<Vector<Type, 3u>> vector_a)
+{
+    (*vector_a) = normalized(*vector_a);
+}
+template<typename Type> constexpr void normalize(lx::common::out<Vector<Type, 4u>> vector_a)
+{
+    (*vector_a) = normalized(*vector_a);
+}
+template<typename Type> constexpr bool is_normalized(Vector<Type, 3u> vector_a)
+{
+    return tools::is_equal(static_cast<Type>(1), length(vector_a));
+}
+template<typename Type> constexpr bool is_normalized(Vector<Type, 4u> vector_a)
+{
+    return tools::is_equal(static_cast<Type>(1), length(vector_a));
+}
+
+template<typename Type> Vector<Type, 3u> lerp(Vector<Type, 3u> start_a, const Vector<Type, 3u> end_a, std::type_identity_t<Type> step_a)
+{
+    return start_a * (static_cast<Type>(1) - step_a) + end_a * step_a;
+}
+template<typename Type> Vector<Type, 4u> lerp(Vector<Type, 4u> start_a, const Vector<Type, 4u> end_a, std::type_identity_t<Type> step_a)
+{
+    return start_a * (static_cast<Type>(1) - step_a) + end_a * step_a;
 }
-} // namespace lx::math
\ No newline at end of file
+} // namespace lx::math
@@ -0,0 +1,486 @@
+#pragma once
+
+/*
+ *   Name: batch.hpp
+ *   Copyright (c) Mateusz Semegen and contributors. All rights reserved.
+ */
+
+// lx
+#include <lx/common/non_constructible.hpp>
+#include <lx/devices/CPU.hpp>
+#include <lx/math/Affine.hpp>
+#include <lx/math/Matrix.hpp>
+#include <lx/math/Vector.hpp>
+#include <lx/math/simd.hpp>
+
+// std
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+
+namespace lx::math {
+
+// kernels of batch, one namespace per instruction set, see batch_kernels.hpp
+namespace batch_kernels {
+struct Table
+{
+    void (*add)(const float*, const float*, float*, std::size_t);
+    void (*scale)(const float*, float, float*, std::size_t);
+    void (*lerp)(const float*, const float*, float, float*, std::size_t);
+
+    void (*transform)(const float*, const float*, const float*, float*, float*, std::size_t);
+    void (*normalize)(const float*, const float*, float*, float*, std::size_t);
+    void (*dot)(const float*, const float*, const float*, const float*, float*, std::size_t);
+    void (*length)(const float*, const float*, float*, std::size_t);
+
+    void (*transform_interleaved)(const float*, const float*, float*, std::size_t);
+    void (*normalize_interleaved)(const float*, float*, std::size_t);
+    void (*dot_interleaved)(const float*, const float*, float*, std::size_t);
+    void (*length_interleaved)(const float*, float*, std::size_t);
+};
+
+// SSE2 or NEON through simd, scalar with LX_MATH_SIMD_NONE
+namespace base {
+struct Lanes : private common::non_constructible
+{
+    using type = simd::float4;
+    constexpr static std::size_t width = 4u;
+
+    static type load(const float* data_a)
+    {
+        return simd::load(data_a);
+    }
+    static void store(float* data_a, type value_a)
+    {
+        simd::store(data_a, value_a);
+    }
+    static void store_even(float* data_a, type value_a)
+    {
+        float lanes[4];
+        simd::store(lanes, value_a);
+
+        data_a[0] = lanes[0];
+        data_a[1] = lanes[2];
+    }
+    static type splat(float value_a)
+    {
+        return simd::splat(value_a);
+    }
+    static type pairs(float even_a, float odd_a)
+    {
+        return simd::set(even_a, odd_a, even_a, odd_a);
+    }
+    static type add(type left_a, type right_a)
+    {
+        return simd::add(left_a, right_a);
+    }
+    static type mul(type left_a, type right_a)
+    {
+        return simd::mul(left_a, right_a);
+    }
+    static type div(type left_a, type right_a)
+    {
+        return simd::div(left_a, right_a);
+    }
+    static type multiply_add(type left_a, type right_a, type add_a)
+    {
+        return simd::multiply_add(left_a, right_a, add_a);
+    }
+    static type sqrt(type value_a)
+    {
+        return simd::sqrt(value_a);
+    }
+    static type swap_pairs(type value_a)
+    {
+        return simd::shuffle<1u, 0u, 3u, 2u>(value_a, value_a);
+    }
+    static type duplicate_even(type value_a)
+    {
+        return simd::shuffle<0u, 0u, 2u, 2u>(value_a, value_a);
+    }
+    static type duplicate_odd(type value_a)
+    {
+        return simd::shuffle<1u, 1u, 3u, 3u>(value_a, value_a);
+    }
+};
+
+#include <lx/math/batch_kernels.hpp>
+} // namespace base
+
+#if defined(LX_MATH_SIMD_SSE)
+
+// AVX2 and AVX-512 kernels are compiled for their instruction set regardless of the target of the build, batch picks them
+// at runtime when the CPU has them
+#if defined(__clang__)
+#pragma clang attribute push(__attribute__((target("avx2,fma"))), apply_to = function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("avx2,fma")
+#endif
+
+namespace avx2 {
+struct Lanes : private common::non_constructible
+{
+    using type = __m256;
+    constexpr static std::size_t width = 8u;
+
+    static type load(const float* data_a)
+    {
+        return _mm256_loadu_ps(data_a);
+    }
+    static void store(float* data_a, type value_a)
+    {
+        _mm256_storeu_ps(data_a, value_a);
+    }
+    static void store_even(float* data_a, type value_a)
+    {
+        const __m256 evens = _mm256_permutevar8x32_ps(value_a, _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6));
+        _mm_storeu_ps(data_a, _mm256_castps256_ps128(evens));
+    }
+    static type splat(float value_a)
+    {
+        return _mm256_set1_ps(value_a);
+    }
+    static type pairs(float even_a, float odd_a)
+    {
+        return _mm256_setr_ps(even_a, odd_a, even_a, odd_a, even_a, odd_a, even_a, odd_a);
+    }
+    static type add(type left_a, type right_a)
+    {
+        return _mm256_add_ps(left_a, right_a);
+    }
+    static type mul(type left_a, type right_a)
+    {
+        return _mm256_mul_ps(left_a, right_a);
+    }
+    static type div(type left_a, type right_a)
+    {
+        return _mm256_div_ps(left_a, right_a);
+    }
+    static type multiply_add(type left_a, type right_a, type add_a)
+    {
+        return _mm256_fmadd_ps(left_a, right_a, add_a);
+    }
+    static type sqrt(type value_a)
+    {
+        return _mm256_sqrt_ps(value_a);
+    }
+    static type swap_pairs(type value_a)
+    {
+        return _mm256_permute_ps(value_a, _MM_SHUFFLE(2, 3, 0, 1));
+    }
+    static type duplicate_even(type value_a)
+    {
+        return _mm256_moveldup_ps(value_a);
+    }
+    static type duplicate_odd(type value_a)
+    {
+        return _mm256_movehdup_ps(value_a);
+    }
+};
+
+#include <lx/math/batch_kernels.hpp>
+} // namespace avx2
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#pragma clang attribute push(__attribute__((target("avx512f,avx2,fma"))), apply_to = function)
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#pragma GCC push_options
+#pragma GCC target("avx512f,avx2,fma")
+// the AVX-512 intrinsics of GCC pass _mm512_undefined_ps() as the unused merge source and trip this warning
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+namespace avx512 {
+struct Lanes : private common::non_constructible
+{
+    using type = __m512;
+    constexpr static std::size_t width = 16u;
+
+    static type load(const float* data_a)
+    {
+        return _mm512_loadu_ps(data_a);
+    }
+    static void store(float* data_a, type value_a)
+    {
+        _mm512_storeu_ps(data_a, value_a);
+    }
+    static void store_even(float* data_a, type value_a)
+    {
+        const __m512i indices = _mm512_setr_epi32(0, 2, 4, 6, 8, 10, 12, 14, 0, 2, 4, 6, 8, 10, 12, 14);
+        _mm256_storeu_ps(data_a, _mm512_castps512_ps256(_mm512_permutexvar_ps(indices, value_a)));
+    }
+    static type splat(float value_a)
+    {
+        return _mm512_set1_ps(value_a);
+    }
+    static type pairs(float even_a, float odd_a)
+    {
+        return _mm512_setr4_ps(even_a, odd_a, even_a, odd_a);
+    }
+    static type add(type left_a, type right_a)
+    {
+        return _mm512_add_ps(left_a, right_a);
+    }
+    static type mul(type left_a, type right_a)
+    {
+        return _mm512_mul_ps(left_a, right_a);
+    }
+    static type div(type left_a, type right_a)
+    {
+        return _mm512_div_ps(left_a, right_a);
+    }
+    static type multiply_add(type left_a, type right_a, type add_a)
+    {
+        return _mm512_fmadd_ps(left_a, right_a, add_a);
+    }
+    static type sqrt(type value_a)
+    {
+        return _mm512_sqrt_ps(value_a);
+    }
+    static type swap_pairs(type value_a)
+    {
+        return _mm512_permute_ps(value_a, _MM_SHUFFLE(2, 3, 0, 1));
+    }
+    static type duplicate_even(type value_a)
+    {
+        return _mm512_moveldup_ps(value_a);
+    }
+    static type duplicate_odd(type value_a)
+    {
+        return _mm512_movehdup_ps(value_a);
+    }
+};
+
+#include <lx/math/batch_kernels.hpp>
+} // namespace avx512
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC diagnostic pop
+#pragma GCC pop_options
+#endif
+
+#endif
+} // namespace batch_kernels
+
+/// @brief Throughput oriented math over many 2D float vectors at once, for sprite and particle updates. Every function has
+/// an overload for spans of interleaved Vector<float, 2u> and one for Streams, a structure of arrays with x and y in
+/// separate spans, which needs no shuffling and is the faster layout. Results may be written over the inputs.
+/// Kernels are picked at runtime: AVX-512 (16 floats per instruction) or AVX2 (8) when the CPU has them, SSE2/NEON (4)
+/// otherwise.
+struct batch : private common::non_constructible
+{
+    enum class Level : std::uint8_t
+    {
+        base,
+        avx2,
+        avx512
+    };
+
+    template<typename Type> struct Streams
+    {
+        static_assert(std::is_same_v<float, std::remove_const_t<Type>>);
+
+        std::span<Type> x;
+        std::span<Type> y;
+
+        std::size_t get_length() const
+        {
+            assert(this->x.size() == this->y.size());
+            return this->x.size();
+        }
+
+        operator Streams<const float>() const
+            requires(false == std::is_const_v<Type>)
+        {
+            return { .x = this->x, .y = this->y };
+        }
+    };
+
+    using Vectors = std::span<const Vector<float, 2u>>;
+    using Result_vectors = std::span<Vector<float, 2u>>;
+
+    /// @brief The highest level the CPU and the build support.
+    static Level get_max_level()
+    {
+#if defined(LX_MATH_SIMD_SSE)
+        if (true == devices::CPU::has(devices::CPU::avx512f | devices::CPU::avx2 | devices::CPU::fma))
+        {
+            return Level::avx512;
+        }
+        if (true == devices::CPU::has(devices::CPU::avx2 | devices::CPU::fma))
+        {
+            return Level::avx2;
+        }
+#endif
+        return Level::base;
+    }
+    static Level get_level()
+    {
+        return level;
+    }
+    /// @brief Forces a lower level, for tests and benchmarks. Not thread safe, nothing may run a batch meanwhile.
+    static void set_level(Level level_a)
+    {
+        assert(level_a <= get_max_level());
+
+        level = level_a;
+        table = select(level_a);
+    }
+
+    static void add(Vectors left_a, Vectors right_a, Result_vectors result_a)
+    {
+        assert(left_a.size() == right_a.size() && left_a.size() == result_a.size());
+        table->add(get_floats(left_a), get_floats(right_a), get_floats(result_a), left_a.size() * 2u);
+    }
+    static void add(Streams<const float> left_a, Streams<const float> right_a, Streams<float> result_a)
+    {
+        assert(left_a.get_length() == right_a.get_length() && left_a.get_length() == result_a.get_length());
+
+        table->add(left_a.x.data(), right_a.x.data(), result_a.x.data(), left_a.get_length());
+        table->add(left_a.y.data(), right_a.y.data(), result_a.y.data(), left_a.get_length());
+    }
+
+    static void scale(Vectors vectors_a, float factor_a, Result_vectors result_a)
+    {
+        assert(vectors_a.size() == result_a.size());
+        table->scale(get_floats(vectors_a), factor_a, get_floats(result_a), vectors_a.size() * 2u);
+    }
+    static void scale(Streams<const float> vectors_a, float factor_a, Streams<float> result_a)
+    {
+        assert(vectors_a.get_length() == result_a.get_length());
+
+        table->scale(vectors_a.x.data(), factor_a, result_a.x.data(), vectors_a.get_length());
+        table->scale(vectors_a.y.data(), factor_a, result_a.y.data(), vectors_a.get_length());
+    }
+
+    static void lerp(Vectors start_a, Vectors end_a, float step_a, Result_vectors result_a)
+    {
+        assert(start_a.size() == end_a.size() && start_a.size() == result_a.size());
+        table->lerp(get_floats(start_a), get_floats(end_a), step_a, get_floats(result_a), start_a.size() * 2u);
+    }
+    static void lerp(Streams<const float> start_a, Streams<const float> end_a, float step_a, Streams<float> result_a)
+    {
+        assert(start_a.get_length() == end_a.get_length() && start_a.get_length() == result_a.get_length());
+
+        table->lerp(start_a.x.data(), end_a.x.data(), step_a, result_a.x.data(), start_a.get_length());
+        table->lerp(start_a.y.data(), end_a.y.data(), step_a, result_a.y.data(), start_a.get_length());
+    }
+
+    /// @brief Transforms points lying on the z = 0 plane, see transform_point.
+    static void transform(const Matrix<float, 4u>& matrix_a, Vectors points_a, Result_vectors result_a)
+    {
+        assert(points_a.size() == result_a.size());
+
+        const std::array<float, 6u> affine = get_affine(matrix_a);
+        table->transform_interleaved(affine.data(), get_floats(points_a), get_floats(result_a), points_a.size());
+    }
+    static void transform(const Matrix<float, 4u>& matrix_a, Streams<const float> points_a, Streams<float> result_a)
+    {
+        assert(points_a.get_length() == result_a.get_length());
+
+        const std::array<float, 6u> affine = get_affine(matrix_a);
+        table->transform(affine.data(), points_a.x.data(), points_a.y.data(), result_a.x.data(), result_a.y.data(), points_a.get_length());
+    }
+
+    static void transform(const Affine<float>& affine_a, Vectors points_a, Result_vectors result_a)
+    {
+        assert(points_a.size() == result_a.size());
+
+        const std::array<float, 6u> affine = get_affine(affine_a);
+        table->transform_interleaved(affine.data(), get_floats(points_a), get_floats(result_a), points_a.size());
+    }
+    static void transform(const Affine<float>& affine_a, Streams<const float> points_a, Streams<float> result_a)
+    {
+        assert(points_a.get_length() == result_a.get_length());
+
+        const std::array<float, 6u> affine = get_affine(affine_a);
+        table->transform(affine.data(), points_a.x.data(), points_a.y.data(), result_a.x.data(), result_a.y.data(), points_a.get_length());
+    }
+
+    /// @brief Zero vectors yield NaNs, as for normalized.
+    static void normalize(Vectors vectors_a, Result_vectors result_a)
+    {
+        assert(vectors_a.size() == result_a.size());
+        table->normalize_interleaved(get_floats(vectors_a), get_floats(result_a), vectors_a.size());
+    }
+    static void normalize(Streams<const float> vectors_a, Streams<float> result_a)
+    {
+        assert(vectors_a.get_length() == result_a.get_length());
+        table->normalize(vectors_a.x.data(), vectors_a.y.data(), result_a.x.data(), result_a.y.data(), vectors_a.get_length());
+    }
+
+    static void dot(Vectors left_a, Vectors right_a, std::span<float> result_a)
+    {
+        assert(left_a.size() == right_a.size() && left_a.size() == result_a.size());
+        table->dot_interleaved(get_floats(left_a), get_floats(right_a), result_a.data(), left_a.size());
+    }
+    static void dot(Streams<const float> left_a, Streams<const float> right_a, std::span<float> result_a)
+    {
+        assert(left_a.get_length() == right_a.get_length() && left_a.get_length() == result_a.size());
+        table->dot(left_a.x.data(), left_a.y.data(), right_a.x.data(), right_a.y.data(), result_a.data(), left_a.get_length());
+    }
+
+    static void length(Vectors vectors_a, std::span<float> result_a)
+    {
+        assert(vectors_a.size() == result_a.size());
+        table->length_interleaved(get_floats(vectors_a), result_a.data(), vectors_a.size());
+    }
+    static void length(Streams<const float> vectors_a, std::span<float> result_a)
+    {
+        assert(vectors_a.get_length() == result_a.size());
+        table->length(vectors_a.x.data(), vectors_a.y.data(), result_a.data(), vectors_a.get_length());
+    }
+
+private:
+    static const batch_kernels::Table* select(Level level_a)
+    {
+#if defined(LX_MATH_SIMD_SSE)
+        switch (level_a)
+        {
+            case Level::avx512:
+                return &batch_kernels::avx512::table;
+            case Level::avx2:
+                return &batch_kernels::avx2::table;
+            case Level::base:
+                break;
+        }
+#else
+        static_cast<void>(level_a);
+#endif
+        return &batch_kernels::base::table;
+    }
+
+    // Vector<float, 2u> is two packed floats, a span of them is a stream of 2 * size floats
+    static const float* get_floats(Vectors vectors_a)
+    {
+        return reinterpret_cast<const float*>(vectors_a.data());
+    }
+    static float* get_floats(Result_vectors vectors_a)
+    {
+        return reinterpret_cast<float*>(vectors_a.data());
+    }
+    static std::array<float, 6u> get_affine(const Matrix<float, 4u>& matrix_a)
+    {
+        return { matrix_a.column_0.x, matrix_a.column_0.y, matrix_a.column_1.x,
+                 matrix_a.column_1.y, matrix_a.column_3.x, matrix_a.column_3.y };
+    }
+    static std::array<float, 6u> get_affine(const Affine<float>& affine_a)
+    {
+        return { affine_a.column_0.x, affine_a.column_0.y, affine_a.column_1.x,
+                 affine_a.column_1.y, affine_a.column_2.x, affine_a.column_2.y };
+    }
+
+    inline static Level level = get_max_level();
+    inline static const batch_kernels::Table* table = select(level);
+};
+} // namespace lx::math
@@ -0,0 +1,254 @@
+/*
+ *   Name: batch_kernels.hpp
+ *   Copyright (c) Mateusz Semegen and contributors. All rights reserved.
+ */
+
+// No include guard: lx/math/batch.hpp includes this file once per instruction set, inside the namespace of that set, after
+// defining Lanes (its registers) and under the target pragma of the set. Every function below is therefore compiled for a
+// single instruction set and only reached through the dispatch table of batch. Kernels process Lanes::width floats per
+// iteration and finish the remainder with scalar code, pointers do not need any alignment and may alias when they point
+// to the same element.
+
+// streams of floats, interleaved 2D vectors are streams of 2 * count floats
+
+inline void add(const float* left_a, const float* right_a, float* result_a, std::size_t count_a)
+{
+    std::size_t i = 0u;
+
+    for (; i + Lanes::width <= count_a; i += Lanes::width)
+    {
+        Lanes::store(result_a + i, Lanes::add(Lanes::load(left_a + i), Lanes::load(right_a + i)));
+    }
+    for (; i < count_a; i++)
+    {
+        result_a[i] = left_a[i] + right_a[i];
+    }
+}
+inline void scale(const float* values_a, float factor_a, float* result_a, std::size_t count_a)
+{
+    const Lanes::type factor = Lanes::splat(factor_a);
+
+    std::size_t i = 0u;
+
+    for (; i + Lanes::width <= count_a; i += Lanes::width)
+    {
+        Lanes::store(result_a + i, Lanes::mul(Lanes::load(values_a + i), factor));
+    }
+    for (; i < count_a; i++)
+    {
+        result_a[i] = values_a[i] * factor_a;
+    }
+}
+inline void lerp(const float* start_a, const float* end_a, float step_a, float* result_a, std::size_t count_a)
+{
+    // start * (1 - step) + end * step, the same rounding as the lerp of Vector
+    const Lanes::type start_factor = Lanes::splat(1.0f - step_a);
+    const Lanes::type end_factor = Lanes::splat(step_a);
+
+    std::size_t i = 0u;
+
+    for (; i + Lanes::width <= count_a; i += Lanes::width)
+    {
+        const Lanes::type start = Lanes::mul(Lanes::load(start_a + i), start_factor);
+        Lanes::store(result_a + i, Lanes::add(start, Lanes::mul(Lanes::load(end_a + i), end_factor)));
+    }
+    for (; i < count_a; i++)
+    {
+        result_a[i] = start_a[i] * (1.0f - step_a) + end_a[i] * step_a;
+    }
+}
+
+// structure of arrays: x and y in separate streams of count floats
+
+/// @brief affine_a is { column_0.x, column_0.y, column_1.x, column_1.y, column_3.x, column_3.y } of a Matrix<float, 4u>.
+inline void transform(const float* affine_a,
+                      const float* x_a,
+                      const float* y_a,
+                      float* result_x_a,
+                      float* result_y_a,
+                      std::size_t count_a)
+{
+    const Lanes::type xx = Lanes::splat(affine_a[0]);
+    const Lanes::type xy = Lanes::splat(affine_a[1]);
+    const Lanes::type yx = Lanes::splat(affine_a[2]);
+    const Lanes::type yy = Lanes::splat(affine_a[3]);
+    const Lanes::type tx = Lanes::splat(affine_a[4]);
+    const Lanes::type ty = Lanes::splat(affine_a[5]);
+
+    std::size_t i = 0u;
+
+    for (; i + Lanes::width <= count_a; i += Lanes::width)
+    {
+        const Lanes::type x = Lanes::load(x_a + i);
+        const Lanes::type y = Lanes::load(y_a + i);
+
+        Lanes::store(result_x_a + i, Lanes::multiply_add(y, yx, Lanes::multiply_add(x, xx, tx)));
+        Lanes::store(result_y_a + i, Lanes::multiply_add(y, yy, Lanes::multiply_add(x, xy, ty)));
+    }
+    for (; i < count_a; i++)
+    {
+        const float x = x_a[i];
+        const float y = y_a[i];
+
+        result_x_a[i] = affine_a[0] * x + affine_a[2] * y + affine_a[4];
+        result_y_a[i] = affine_a[1] * x + affine_a[3] * y + affine_a[5];
+    }
+}
+inline void normalize(const float* x_a, const float* y_a, float* result_x_a, float* result_y_a, std::size_t count_a)
+{
+    std::size_t i = 0u;
+
+    for (; i + Lanes::width <= count_a; i += Lanes::width)
+    {
+        const Lanes::type x = Lanes::load(x_a + i);
+        const Lanes::type y = Lanes::load(y_a + i);
+        const Lanes::type length = Lanes::sqrt(Lanes::multiply_add(y, y, Lanes::mul(x, x)));
+
+        Lanes::store(result_x_a + i, Lanes::div(x, length));
+        Lanes::store(result_y_a + i, Lanes::div(y, length));
+    }
+    for (; i < count_a; i++)
+    {
+        const float length = std::sqrt(x_a[i] * x_a[i] + y_a[i] * y_a[i]);
+
+        result_x_a[i] = x_a[i] / length;
+        result_y_a[i] = y_a[i] / length;
+    }
+}
+inline void dot(const float* left_x_a,
+                const float* left_y_a,
+                const float* right_x_a,
+                const float* right_y_a,
+                float* result_a,
+                std::size_t count_a)
+{
+    std::size_t i = 0u;
+
+    for (; i + Lanes::width <= count_a; i += Lanes::width)
+    {
+        const Lanes::type x = Lanes::mul(Lanes::load(left_x_a + i), Lanes::load(right_x_a + i));
+        Lanes::store(result_a + i, Lanes::multiply_add(Lanes::load(left_y_a + i), Lanes::load(right_y_a + i), x));
+    }
+    for (; i < count_a; i++)
+    {
+        result_a[i] = left_x_a[i] * right_x_a[i] + left_y_a[i] * right_y_a[i];
+    }
+}
+inline void length(const float* x_a, const float* y_a, float* result_a, std::size_t count_a)
+{
+    std::size_t i = 0u;
+
+    for (; i + Lanes::width <= count_a; i += Lanes::width)
+    {
+        const Lanes::type x = Lanes::load(x_a + i);
+        const Lanes::type y = Lanes::load(y_a + i);
+
+        Lanes::store(result_a + i, Lanes::sqrt(Lanes::multiply_add(y, y, Lanes::mul(x, x))));
+    }
+    for (; i < count_a; i++)
+    {
+        result_a[i] = std::sqrt(x_a[i] * x_a[i] + y_a[i] * y_a[i]);
+    }
+}
+
+// interleaved { x0, y0, x1, y1, ... }, count is the number of vectors: Lanes::width / 2 vectors per iteration
+
+inline void transform_interleaved(const float* affine_a, const float* vectors_a, float* result_a, std::size_t count_a)
+{
+    const Lanes::type xs = Lanes::pairs(affine_a[0], affine_a[1]);
+    const Lanes::type ys = Lanes::pairs(affine_a[2], affine_a[3]);
+    const Lanes::type translation = Lanes::pairs(affine_a[4], affine_a[5]);
+
+    constexpr std::size_t step = Lanes::width / 2u;
+    std::size_t i = 0u;
+
+    for (; i + step <= count_a; i += step)
+    {
+        const Lanes::type vectors = Lanes::load(vectors_a + i * 2u);
+        const Lanes::type result = Lanes::multiply_add(Lanes::duplicate_even(vectors), xs, translation);
+
+        Lanes::store(result_a + i * 2u, Lanes::multiply_add(Lanes::duplicate_odd(vectors), ys, result));
+    }
+    for (; i < count_a; i++)
+    {
+        const float x = vectors_a[i * 2u];
+        const float y = vectors_a[i * 2u + 1u];
+
+        result_a[i * 2u] = affine_a[0] * x + affine_a[2] * y + affine_a[4];
+        result_a[i * 2u + 1u] = affine_a[1] * x + affine_a[3] * y + affine_a[5];
+    }
+}
+inline void normalize_interleaved(const float* vectors_a, float* result_a, std::size_t count_a)
+{
+    constexpr std::size_t step = Lanes::width / 2u;
+    std::size_t i = 0u;
+
+    for (; i + step <= count_a; i += step)
+    {
+        const Lanes::type vectors = Lanes::load(vectors_a + i * 2u);
+        const Lanes::type squares = Lanes::mul(vectors, vectors);
+
+        // x * x + y * y in both lanes of a vector
+        const Lanes::type length = Lanes::sqrt(Lanes::add(squares, Lanes::swap_pairs(squares)));
+
+        Lanes::store(result_a + i * 2u, Lanes::div(vectors, length));
+    }
+    for (; i < count_a; i++)
+    {
+        const float x = vectors_a[i * 2u];
+        const float y = vectors_a[i * 2u + 1u];
+        const float length = std::sqrt(x * x + y * y);
+
+        result_a[i * 2u] = x / length;
+        result_a[i * 2u + 1u] = y / length;
+    }
+}
+inline void dot_interleaved(const float* left_a, const float* right_a, float* result_a, std::size_t count_a)
+{
+    constexpr std::size_t step = Lanes::width / 2u;
+    std::size_t i = 0u;
+
+    for (; i + step <= count_a; i += step)
+    {
+        const Lanes::type products = Lanes::mul(Lanes::load(left_a + i * 2u), Lanes::load(right_a + i * 2u));
+        Lanes::store_even(result_a + i, Lanes::add(products, Lanes::swap_pairs(products)));
+    }
+    for (; i < count_a; i++)
+    {
+        result_a[i] = left_a[i * 2u] * right_a[i * 2u] + left_a[i * 2u + 1u] * right_a[i * 2u + 1u];
+    }
+}
+inline void length_interleaved(const float* vectors_a, float* result_a, std::size_t count_a)
+{
+    constexpr std::size_t step = Lanes::width / 2u;
+    std::size_t i = 0u;
+
+    for (; i + step <= count_a; i += step)
+    {
+        const Lanes::type vectors = Lanes::load(vectors_a + i * 2u);
+        const Lanes::type squares = Lanes::mul(vectors, vectors);
+
+        Lanes::store_even(result_a + i, Lanes::sqrt(Lanes::add(squares, Lanes::swap_pairs(squares))));
+    }
+    for (; i < count_a; i++)
+    {
+        const float x = vectors_a[i * 2u];
+        const float y = vectors_a[i * 2u + 1u];
+
+        result_a[i] = std::sqrt(x * x + y * y);
+    }
+}
+
+inline constexpr Table table = {
+    .add = &add,
+    .scale = &scale,
+    .lerp = &lerp,
+    .transform = &transform,
+    .normalize = &normalize,
+    .dot = &dot,
+    .length = &length,
+    .transform_interleaved = &transform_interleaved,
+    .normalize_interleaved = &normalize_interleaved,
+    .dot_interleaved = &dot_interleaved,
+    .length_interleaved = &length_interleaved,
+};
@@ -0,0 +1,307 @@
+#pragma once
+
+/*
+ *   Name: fast.hpp
+ *   Copyright (c) Mateusz Semegen and contributors. All rights reserved.
+ */
+
+// lx
+#include <lx/common/non_constructible.hpp>
+#include <lx/common/out.hpp>
+#include <lx/math/simd.hpp>
+
+// std
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <numbers>
+
+namespace lx::math {
+
+/// @brief Polynomial approximations of the float functions that dominate 2D rotation and physics code. Every function takes
+/// the accuracy as a template argument, so each call site picks precise (the standard library) or one of the approximations
+/// at compile time. The approximations are branch free, loops over them vectorize.
+/// Measured maximum errors, relative unless noted:
+///
+///   function  | Accuracy::high | Accuracy::low
+///   rsqrt     | 5e-6           | 2e-3
+///   sin, cos  | 1e-7 absolute  | 4e-5 absolute  for |angle| <= 8192, precision degrades above
+///   atan2     | 2e-6 radians   | 4e-3 radians
+///   exp       | 1e-7           | 6e-5           for x in [-87, 88], clamped outside
+///   log       | 2e-7           | 7e-5           absolute where |log x| < 1, x positive and normal
+struct fast : private common::non_constructible
+{
+    enum class Accuracy : std::uint8_t
+    {
+        precise,
+        high,
+        low
+    };
+
+    template<Accuracy accuracy = Accuracy::high> [[nodiscard]] constexpr static float rsqrt(float value_a)
+    {
+        if constexpr (Accuracy::precise == accuracy)
+        {
+            return 1.0f / std::sqrt(value_a);
+        }
+        else
+        {
+            // the bit trick estimate instead of the hardware one: the same result on every CPU and loops over it vectorize
+            const float estimate = std::bit_cast<float>(0x5F375A86u - (std::bit_cast<std::uint32_t>(value_a) >> 1u));
+            const float refined = refine_rsqrt(value_a, estimate);
+
+            return Accuracy::low == accuracy ? refined : refine_rsqrt(value_a, refined);
+        }
+    }
+    /// @brief Four lanes at once from the hardware estimate, within the errors of the scalar version.
+    template<Accuracy accuracy = Accuracy::high> [[nodiscard]] static simd::float4 rsqrt(simd::float4 values_a)
+    {
+        if constexpr (Accuracy::precise == accuracy)
+        {
+            return simd::div(simd::splat(1.0f), simd::sqrt(values_a));
+        }
+        else
+        {
+            simd::float4 estimate = simd::rsqrt(values_a);
+
+            // NEON estimates only 8 bits, one more step to get to the precision of SSE
+#if defined(LX_MATH_SIMD_NEON)
+            estimate = refine_rsqrt(values_a, estimate);
+#endif
+            return Accuracy::low == accuracy ? estimate : refine_rsqrt(values_a, estimate);
+        }
+    }
+
+    template<Accuracy accuracy = Accuracy::high> [[nodiscard]] constexpr static float sin(float angle_a)
+    {
+        if constexpr (Accuracy::precise == accuracy)
+        {
+            return std::sin(angle_a);
+        }
+        else
+        {
+            return get_sine_cosine<accuracy>(angle_a).sine;
+        }
+    }
+    template<Accuracy accuracy = Accuracy::high> [[nodiscard]] constexpr static float cos(float angle_a)
+    {
+        if constexpr (Accuracy::precise == accuracy)
+        {
+            return std::cos(angle_a);
+        }
+        else
+        {
+            return get_sine_cosine<accuracy>(angle_a).cosine;
+        }
+    }
+    /// @brief Both from one range reduction, cheaper than sin and cos apart.
+    template<Accuracy accuracy = Accuracy::high> static void sincos(float angle_a, common::out<float> sine_a, common::out<float> cosine_a)
+    {
+        if constexpr (Accuracy::precise == accuracy)
+        {
+            *sine_a = std::sin(angle_a);
+            *cosine_a = std::cos(angle_a);
+        }
+        else
+        {
+            const Sine_cosine result = get_sine_cosine<accuracy>(angle_a);
+
+            *sine_a = result.sine;
+            *cosine_a = result.cosine;
+        }
+    }
+
+    /// @brief Angle of (x_a, y_a) in [-pi, pi], zero for (0, 0).
+    template<Accuracy accuracy = Accuracy::high> [[nodiscard]] constexpr static float atan2(float y_a, float x_a)
+    {
+        if constexpr (Accuracy::precise == accuracy)
+        {
+            return std::atan2(y_a, x_a);
+        }
+        else
+        {
+            const float x = select(x_a < 0.0f, -x_a, x_a);
+            const float y = select(y_a < 0.0f, -y_a, y_a);
+            const float maximum = select(x > y, x, y);
+            const float minimum = select(x > y, y, x);
+
+            // atan over [0, 1], then mirrored into the octant of (x_a, y_a)
+            const float ratio = minimum / select(0.0f == maximum, 1.0f, maximum);
+            const float squared = ratio * ratio;
+
+            float angle = 0.0f;
+
+            if constexpr (Accuracy::low == accuracy)
+            {
+                angle = ratio * (std::numbers::pi_v<float> / 4.0f + 0.273f * (1.0f - ratio));
+            }
+            else
+            {
+                angle = -0.01172120f;
+                angle = angle * squared + 0.05265332f;
+                angle = angle * squared - 0.11643287f;
+                angle = angle * squared + 0.19354346f;
+                angle = angle * squared - 0.33262347f;
+                angle = (angle * squared + 0.99997726f) * ratio;
+            }
+
+            angle = select(y > x, std::numbers::pi_v<float> / 2.0f - angle, angle);
+            angle = select(x_a < 0.0f, std::numbers::pi_v<float> - angle, angle);
+
+            return select(y_a < 0.0f, -angle, angle);
+        }
+    }
+
+    template<Accuracy accuracy = Accuracy::high> [[nodiscard]] constexpr static float exp(float value_a)
+    {
+        if constexpr (Accuracy::precise == accuracy)
+        {
+            return std::exp(value_a);
+        }
+        else
+        {
+            // e^x = 2^n * e^r, n = round(x / ln 2) and |r| <= ln 2 / 2, ln 2 split in two for an exact n * ln 2
+            const float above_minimum = select(value_a < -87.0f, -87.0f, value_a);
+            const float value = select(above_minimum > 88.0f, 88.0f, above_minimum);
+            const Rounded exponent = round(value * std::numbers::log2e_v<float>);
+            const float exponent_float = exponent.value;
+            const float reduced = value - exponent_float * 0.693359375f + exponent_float * 2.12194440e-4f;
+
+            float polynomial = 0.0f;
+
+            if constexpr (Accuracy::low == accuracy)
+            {
+                polynomial = 1.0f / 24.0f;
+                polynomial = polynomial * reduced + 1.0f / 6.0f;
+                polynomial = polynomial * reduced + 0.5f;
+            }
+            else
+            {
+                polynomial = 1.9875691500e-4f;
+                polynomial = polynomial * reduced + 1.3981999507e-3f;
+                polynomial = polynomial * reduced + 8.3334519073e-3f;
+                polynomial = polynomial * reduced + 4.1665795894e-2f;
+                polynomial = polynomial * reduced + 1.6666665459e-1f;
+                polynomial = polynomial * reduced + 5.0000001201e-1f;
+            }
+
+            const float power = std::bit_cast<float>(static_cast<std::uint32_t>(exponent.integer + 127) << 23u);
+            return (polynomial * reduced * reduced + reduced + 1.0f) * power;
+        }
+    }
+    /// @brief Natural logarithm, value_a has to be a positive normal float.
+    template<Accuracy accuracy = Accuracy::high> [[nodiscard]] constexpr static float log(float value_a)
+    {
+        if constexpr (Accuracy::precise == accuracy)
+        {
+            return std::log(value_a);
+        }
+        else
+        {
+            // x = 2^e * m with m in [sqrt(2) / 2, sqrt(2)), ln m = 2 * atanh(s) for s = (m - 1) / (m + 1), |s| <= 0.172
+            const std::uint32_t bits = std::bit_cast<std::uint32_t>(value_a);
+            const std::uint32_t mantissa_bits = (bits & 0x007FFFFFu) | 0x3F800000u;
+            const bool above = mantissa_bits > 0x3FB504F3u;
+
+            const float mantissa = std::bit_cast<float>(true == above ? mantissa_bits - 0x00800000u : mantissa_bits);
+            const float exponent = static_cast<float>(static_cast<std::int32_t>(bits >> 23u) - (true == above ? 126 : 127));
+
+            const float s = (mantissa - 1.0f) / (mantissa + 1.0f);
+            const float squared = s * s;
+
+            float series = 0.0f;
+
+            if constexpr (Accuracy::low == accuracy)
+            {
+                series = 1.0f + squared * (1.0f / 3.0f);
+            }
+            else
+            {
+                series = 1.0f / 7.0f;
+                series = series * squared + 1.0f / 5.0f;
+                series = series * squared + 1.0f / 3.0f;
+                series = series * squared + 1.0f;
+            }
+
+            // ln 2 split in two as in exp, so the large exponent term is exact and only the final sum rounds
+            return exponent * 0.693359375f + (2.0f * s * series - exponent * 2.12194440e-4f);
+        }
+    }
+
+private:
+    struct Sine_cosine
+    {
+        float sine;
+        float cosine;
+    };
+
+    struct Rounded
+    {
+        float value;
+        std::int32_t integer;
+    };
+
+    /// @brief condition_a ? if_true_a : if_false_a through bit masks. A conditional lets the compiler specialize or drop the
+    /// operands per branch, and then it refuses to vectorize the loop around.
+    constexpr static float select(bool condition_a, float if_true_a, float if_false_a)
+    {
+        const std::uint32_t mask = 0u - static_cast<std::uint32_t>(condition_a);
+
+        return std::bit_cast<float>((std::bit_cast<std::uint32_t>(if_true_a) & mask) |
+                                    (std::bit_cast<std::uint32_t>(if_false_a) & ~mask));
+    }
+    /// @brief Rounds to the nearest integer for |value_a| < 2^22 without a float to int conversion, which keeps the callers
+    /// branch free: adding 1.5 * 2^23 leaves the integer in the low mantissa bits.
+    constexpr static Rounded round(float value_a)
+    {
+        const float shifted = value_a + 12582912.0f;
+        return { .value = shifted - 12582912.0f, .integer = std::bit_cast<std::int32_t>(shifted) - 0x4B400000 };
+    }
+    constexpr static float refine_rsqrt(float value_a, float estimate_a)
+    {
+        return estimate_a * (1.5f - 0.5f * value_a * estimate_a * estimate_a);
+    }
+    static simd::float4 refine_rsqrt(simd::float4 values_a, simd::float4 estimate_a)
+    {
+        const simd::float4 half_values = simd::mul(simd::splat(0.5f), values_a);
+        const simd::float4 correction = simd::sub(simd::splat(1.5f), simd::mul(half_values, simd::mul(estimate_a, estimate_a)));
+
+        return simd::mul(estimate_a, correction);
+    }
+
+    template<Accuracy accuracy> constexpr static Sine_cosine get_sine_cosine(float angle_a)
+    {
+        // angle = quadrant * pi / 2 + r with |r| <= pi / 4, pi / 2 split in three for an exact quadrant * pi / 2
+        const Rounded rounded = round(angle_a * (2.0f / std::numbers::pi_v<float>));
+        const std::int32_t quadrant = rounded.integer;
+        const float quadrant_float = rounded.value;
+
+        const float r = ((angle_a - quadrant_float * 1.5703125f) - quadrant_float * 4.837512969970703125e-4f) -
+                        quadrant_float * 7.54978995489188216e-8f;
+        const float squared = r * r;
+
+        float sine = 0.0f;
+        float cosine = 0.0f;
+
+        if constexpr (Accuracy::low == accuracy)
+        {
+            sine = r + r * squared * (-1.0f / 6.0f + squared * (1.0f / 120.0f));
+            cosine = 1.0f + squared * (-0.5f + squared * (1.0f / 24.0f + squared * (-1.0f / 720.0f)));
+        }
+        else
+        {
+            sine = r + r * squared * (-1.6666654611e-1f + squared * (8.3321608736e-3f + squared * -1.9515295891e-4f));
+            cosine = 1.0f - 0.5f * squared +
+                     squared * squared * (4.166664568298827e-2f + squared * (-1.388731625493765e-3f + squared * 2.443315711809948e-5f));
+        }
+
+        // quadrants 1 and 3 swap sine with cosine, the sign of sine flips in 2 and 3, the sign of cosine in 1 and 2
+        const bool swap = 0 != (quadrant & 1);
+        const float quadrant_sine = select(swap, cosine, sine);
+        const float quadrant_cosine = select(swap, sine, cosine);
+
+        return { .sine = select(0 != (quadrant & 2), -quadrant_sine, quadrant_sine),
+                 .cosine = select(0 != ((quadrant + 1) & 2), -quadrant_cosine, quadrant_cosine) };
+    }
+};
+} // namespace lx::math
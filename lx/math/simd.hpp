@@ -0,0 +1,279 @@
+#pragma once
+
+/*
+ *   Name: simd.hpp
+ *   Copyright (c) Mateusz Semegen and contributors. All rights reserved.
+ */
+
+// backend of the float math, picked at compile time from the target:
+//   LX_MATH_SIMD_SSE  - x64, SSE2 baseline, plus LX_MATH_SIMD_AVX for 256 bit batches when built with AVX (/arch:AVX2, -mavx2)
+//   LX_MATH_SIMD_NEON - arm64
+//   LX_MATH_SIMD_NONE - plain scalar code, define it to force the fallback on any target
+#if !defined(LX_MATH_SIMD_NONE) && !defined(LX_MATH_SIMD_SSE) && !defined(LX_MATH_SIMD_NEON)
+#if defined(_M_X64) || defined(_M_AMD64) || defined(__SSE2__)
+#define LX_MATH_SIMD_SSE
+#elif defined(_M_ARM64) || defined(__aarch64__)
+#define LX_MATH_SIMD_NEON
+#else
+#define LX_MATH_SIMD_NONE
+#endif
+#endif
+
+#if defined(LX_MATH_SIMD_SSE) && defined(__AVX__) && !defined(LX_MATH_SIMD_AVX)
+#define LX_MATH_SIMD_AVX
+#endif
+
+// lx
+#include <lx/common/non_constructible.hpp>
+
+// std
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+
+// intrinsics
+#if defined(LX_MATH_SIMD_SSE)
+#include <immintrin.h>
+#elif defined(LX_MATH_SIMD_NEON)
+#include <arm_neon.h>
+#endif
+
+namespace lx::math {
+
+/// @brief Thin wrapper over four float lanes, shared by the Vector and Matrix implementations. Operations map one to one
+/// to SSE/NEON instructions, the scalar backend emulates them lane by lane.
+struct simd : private common::non_constructible
+{
+#if defined(LX_MATH_SIMD_SSE)
+    using float4 = __m128;
+#elif defined(LX_MATH_SIMD_NEON)
+    using float4 = float32x4_t;
+#else
+    struct float4
+    {
+        float lanes[4];
+    };
+#endif
+
+#if defined(LX_MATH_SIMD_NONE)
+    constexpr static bool is_enabled = false;
+#else
+    constexpr static bool is_enabled = true;
+#endif
+
+    /// @brief Tells whether math on Type goes through the vector backend. Only float is accelerated.
+    template<typename Type> constexpr static bool is_accelerated = std::same_as<Type, float> && is_enabled;
+
+    static float4 load(const float* data_a)
+    {
+#if defined(LX_MATH_SIMD_SSE)
+        return _mm_loadu_ps(data_a);
+#elif defined(LX_MATH_SIMD_NEON)
+        return vld1q_f32(data_a);
+#else
+        return { { data_a[0], data_a[1], data_a[2], data_a[3] } };
+#endif
+    }
+    /// @brief Loads three floats, the fourth lane is zero. Never reads past data_a[2].
+    static float4 load3(const float* data_a)
+    {
+#if defined(LX_MATH_SIMD_SSE)
+        return _mm_setr_ps(data_a[0], data_a[1], data_a[2], 0.0f);
+#elif defined(LX_MATH_SIMD_NEON)
+        return vcombine_f32(vld1_f32(data_a), vld1_lane_f32(data_a + 2u, vdup_n_f32(0.0f), 0));
+#else
+        return { { data_a[0], data_a[1], data_a[2], 0.0f } };
+#endif
+    }
+    static void store(float* data_a, float4 value_a)
+    {
+#if defined(LX_MATH_SIMD_SSE)
+        _mm_storeu_ps(data_a, value_a);
+#elif defined(LX_MATH_SIMD_NEON)
+        vst1q_f32(data_a, value_a);
+#else
+        for (std::size_t i = 0u; i < 4u; i++)
+        {
+            data_a[i] = value_a.lanes[i];
+        }
+#endif
+    }
+    /// @brief Stores the first three lanes. Never writes past data_a[2].
+    static void store3(float* data_a, float4 value_a)
+    {
+#if defined(LX_MATH_SIMD_SSE)
+        _mm_storel_pi(reinterpret_cast<__m64*>(data_a), value_a);
+        _mm_store_ss(data_a + 2u, _mm_movehl_ps(value_a, value_a));
+#elif defined(LX_MATH_SIMD_NEON)
+        vst1_f32(data_a, vget_low_f32(value_a));
+        vst1q_lane_f32(data_a + 2u, value_a, 2);
+#else
+        for (std::size_t i = 0u; i < 3u; i++)
+        {
+            data_a[i] = value_a.lanes[i];
+        }
+#endif
+    }
+
+    static float4 set(float x_a, float y_a, float z_a, float w_a)
+    {
+#if defined(LX_MATH_SIMD_SSE)
+        return _mm_setr_ps(x_a, y_a, z_a, w_a);
+#elif defined(LX_MATH_SIMD_NEON)
+        const float lanes[4] = { x_a, y_a, z_a, w_a };
+        return vld1q_f32(lanes);
+#else
+        return { { x_a, y_a, z_a, w_a } };
+#endif
+    }
+    static float4 splat(float value_a)
+    {
+#if defined(LX_MATH_SIMD_SSE)
+        return _mm_set1_ps(value_a);
+#elif defined(LX_MATH_SIMD_NEON)
+        return vdupq_n_f32(value_a);
+#else
+        return { { value_a, value_a, value_a, value_a } };
+#endif
+    }
+    /// @brief Broadcasts a single lane to all four.
+    template<std::size_t lane> static float4 splat(float4 value_a)
+    {
+        static_assert(lane < 4u);
+
+#if defined(LX_MATH_SIMD_NEON)
+        return vdupq_laneq_f32(value_a, lane);
+#else
+        return shuffle<lane, lane, lane, lane>(value_a, value_a);
+#endif
+    }
+
+    /// @brief Returns { xy_a[x], xy_a[y], zw_a[z], zw_a[w] }, the _mm_shuffle_ps selection.
+    template<std::size_t x, std::size_t y, std::size_t z, std::size_t w> static float4 shuffle(float4 xy_a, float4 zw_a)
+    {
+        static_assert(x < 4u && y < 4u && z < 4u && w < 4u);
+
+#if defined(LX_MATH_SIMD_SSE)
+        return _mm_shuffle_ps(xy_a, zw_a, _MM_SHUFFLE(w, z, y, x));
+#elif defined(LX_MATH_SIMD_NEON)
+        float4 result = vdupq_n_f32(vgetq_lane_f32(xy_a, x));
+        result = vsetq_lane_f32(vgetq_lane_f32(xy_a, y), result, 1);
+        result = vsetq_lane_f32(vgetq_lane_f32(zw_a, z), result, 2);
+        return vsetq_lane_f32(vgetq_lane_f32(zw_a, w), result, 3);
+#else
+        return { { xy_a.lanes[x], xy_a.lanes[y], zw_a.lanes[z], zw_a.lanes[w] } };
+#endif
+    }
+
+    static float4 add(float4 left_a, float4 right_a)
+    {
+#if defined(LX_MATH_SIMD_SSE)
+        return _mm_add_ps(left_a, right_a);
+#elif defined(LX_MATH_SIMD_NEON)
+        return vaddq_f32(left_a, right_a);
+#else
+        return { { left_a.lanes[0] + right_a.lanes[0],
+                   left_a.lanes[1] + right_a.lanes[1],
+                   left_a.lanes[2] + right_a.lanes[2],
+                   left_a.lanes[3] + right_a.lanes[3] } };
+#endif
+    }
+    static float4 sub(float4 left_a, float4 right_a)
+    {
+#if defined(LX_MATH_SIMD_SSE)
+        return _mm_sub_ps(left_a, right_a);
+#elif defined(LX_MATH_SIMD_NEON)
+        return vsubq_f32(left_a, right_a);
+#else
+        return { { left_a.lanes[0] - right_a.lanes[0],
+                   left_a.lanes[1] - right_a.lanes[1],
+                   left_a.lanes[2] - right_a.lanes[2],
+                   left_a.lanes[3] - right_a.lanes[3] } };
+#endif
+    }
+    static float4 mul(float4 left_a, float4 right_a)
+    {
+#if defined(LX_MATH_SIMD_SSE)
+        return _mm_mul_ps(left_a, right_a);
+#elif defined(LX_MATH_SIMD_NEON)
+        return vmulq_f32(left_a, right_a);
+#else
+        return { { left_a.lanes[0] * right_a.lanes[0],
+                   left_a.lanes[1] * right_a.lanes[1],
+                   left_a.lanes[2] * right_a.lanes[2],
+                   left_a.lanes[3] * right_a.lanes[3] } };
+#endif
+    }
+    static float4 div(float4 left_a, float4 right_a)
+    {
+#if defined(LX_MATH_SIMD_SSE)
+        return _mm_div_ps(left_a, right_a);
+#elif defined(LX_MATH_SIMD_NEON)
+        return vdivq_f32(left_a, right_a);
+#else
+        return { { left_a.lanes[0] / right_a.lanes[0],
+                   left_a.lanes[1] / right_a.lanes[1],
+                   left_a.lanes[2] / right_a.lanes[2],
+                   left_a.lanes[3] / right_a.lanes[3] } };
+#endif
+    }
+    /// @brief Returns left_a * right_a + add_a, fused when the target has FMA.
+    static float4 multiply_add(float4 left_a, float4 right_a, float4 add_a)
+    {
+#if defined(LX_MATH_SIMD_SSE) && (defined(__FMA__) || defined(__AVX2__))
+        return _mm_fmadd_ps(left_a, right_a, add_a);
+#elif defined(LX_MATH_SIMD_NEON)
+        return vfmaq_f32(add_a, left_a, right_a);
+#else
+        return add(mul(left_a, right_a), add_a);
+#endif
+    }
+    static float4 sqrt(float4 value_a)
+    {
+#if defined(LX_MATH_SIMD_SSE)
+        return _mm_sqrt_ps(value_a);
+#elif defined(LX_MATH_SIMD_NEON)
+        return vsqrtq_f32(value_a);
+#else
+        return { { std::sqrt(value_a.lanes[0]), std::sqrt(value_a.lanes[1]), std::sqrt(value_a.lanes[2]), std::sqrt(value_a.lanes[3]) } };
+#endif
+    }
+    /// @brief Estimate of 1 / sqrt: 12 bits on SSE, 8 bits on NEON, exact on the scalar backend.
+    static float4 rsqrt(float4 value_a)
+    {
+#if defined(LX_MATH_SIMD_SSE)
+        return _mm_rsqrt_ps(value_a);
+#elif defined(LX_MATH_SIMD_NEON)
+        return vrsqrteq_f32(value_a);
+#else
+        return div(splat(1.0f), sqrt(value_a));
+#endif
+    }
+
+    static float get_x(float4 value_a)
+    {
+#if defined(LX_MATH_SIMD_SSE)
+        return _mm_cvtss_f32(value_a);
+#elif defined(LX_MATH_SIMD_NEON)
+        return vgetq_lane_f32(value_a, 0);
+#else
+        return value_a.lanes[0];
+#endif
+    }
+
+    /// @brief Sum of all four lanes broadcast to every lane, so it can feed further vector math without a round trip.
+    static float4 sum(float4 value_a)
+    {
+#if defined(LX_MATH_SIMD_NEON)
+        return vdupq_n_f32(vaddvq_f32(value_a));
+#else
+        const float4 pairs = add(value_a, shuffle<2u, 3u, 0u, 1u>(value_a, value_a));
+        return add(pairs, shuffle<1u, 0u, 3u, 2u>(pairs, pairs));
+#endif
+    }
+    static float4 dot(float4 left_a, float4 right_a)
+    {
+        return sum(mul(left_a, right_a));
+    }
+};
+} // namespace lx::math
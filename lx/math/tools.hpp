@@ -1,16 +1,30 @@
+#pragma once
+
 // lx
 #include <lx/common/non_constructible.hpp>
 
 // std
 #include <algorithm>
+#include <cmath>
 #include <limits>
 
 namespace lx::math {
 struct tools : private common::non_constructible
 {
-    template<typename Type> static inline [[nodiscard]] bool is_equal(Type a, Type b)
+    /// @brief Exact for integers, relative within epsilon otherwise: for Fixed that is one step of its precision.
+    template<typename Type> [[nodiscard]] constexpr static bool is_equal(Type a, Type b)
     {
-        return std::abs(a - b) <= std::numeric_limits<Type>::epsilon() * std::max(static_cast<Type>(1), std::max(std::abs(a), std::abs(b)));
+        if constexpr (true == std::numeric_limits<Type>::is_integer)
+        {
+            return a == b;
+        }
+        else
+        {
+            // unqualified, so Fixed brings its own abs through argument dependent lookup
+            using std::abs;
+
+            return abs(a - b) <= std::numeric_limits<Type>::epsilon() * std::max(static_cast<Type>(1), std::max(abs(a), abs(b)));
+        }
     }
 };
 } // namespace lx::math
\ No newline at end of file
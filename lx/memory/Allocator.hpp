@@ -0,0 +1,58 @@
+#pragma once
+
+/*
+ *   Name: Allocator.hpp
+ *   Copyright (c) Mateusz Semegen and contributors. All rights reserved.
+ */
+
+// lx
+#include <lx/memory/Resource.hpp>
+
+// std
+#include <cstddef>
+
+namespace lx::memory {
+
+/// @brief A typed allocator that forwards to a memory::Resource. Plugs a resource into containers::Vector and containers::String.
+/// @tparam Type of the allocated objects.
+template<typename Type> class Allocator
+{
+public:
+    using value_type = Type;
+
+    Allocator()
+        : resource(&Heap::get_default())
+    {
+    }
+    Allocator(Resource& resource_a)
+        : resource(&resource_a)
+    {
+    }
+    template<typename Other> Allocator(const Allocator<Other>& other_a)
+        : resource(other_a.get_resource())
+    {
+    }
+
+    [[nodiscard]] Type* allocate(std::size_t count_a)
+    {
+        return static_cast<Type*>(this->resource->allocate(count_a * sizeof(Type), alignof(Type)));
+    }
+    void deallocate(Type* pointer_a, std::size_t count_a)
+    {
+        this->resource->deallocate(pointer_a, count_a * sizeof(Type), alignof(Type));
+    }
+
+    Resource* get_resource() const
+    {
+        return this->resource;
+    }
+
+private:
+    Resource* resource;
+};
+
+template<typename Left, typename Right> bool operator==(const Allocator<Left>& left_a, const Allocator<Right>& right_a)
+{
+    return left_a.get_resource() == right_a.get_resource();
+}
+} // namespace lx::memory
@@ -0,0 +1,178 @@
+#pragma once
+
+/*
+ *   Name: Arena.hpp
+ *   Copyright (c) Mateusz Semegen and contributors. All rights reserved.
+ */
+
+// lx
+#include <lx/memory/Resource.hpp>
+
+// std
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace lx::memory {
+
+/// @brief A linear (bump) resource. Allocation is a pointer bump and memory is given back all at once by reset().
+/// Requests that do not fit into the block are served by the upstream resource and released on the next reset().
+/// Not thread safe.
+class Arena : public Resource
+{
+public:
+    Arena(std::size_t capacity_a, Resource& upstream_a = Heap::get_default())
+        : upstream(&upstream_a)
+        , capacity(capacity_a)
+        , block(static_cast<std::byte*>(upstream_a.allocate(capacity_a, alignof(std::max_align_t))))
+    {
+    }
+    ~Arena()
+    {
+        this->reset();
+        this->upstream->deallocate(this->block, this->capacity, alignof(std::max_align_t));
+    }
+
+    [[nodiscard]] void* allocate(std::size_t size_a, std::size_t alignment_a) override
+    {
+        assert(0u != alignment_a && 0u == (alignment_a & (alignment_a - 1u)));
+
+        const std::uintptr_t top = reinterpret_cast<std::uintptr_t>(this->block) + this->size;
+        const std::size_t padding = static_cast<std::size_t>((alignment_a - (top & (alignment_a - 1u))) & (alignment_a - 1u));
+
+        if (this->size + padding + size_a <= this->capacity)
+        {
+            std::byte* pointer = this->block + this->size + padding;
+
+            this->size += padding + size_a;
+            this->peak_size = std::max(this->peak_size, this->size);
+
+            return pointer;
+        }
+
+        return this->allocate_overflow(size_a, alignment_a);
+    }
+    void deallocate(void* pointer_a, std::size_t size_a, std::size_t) override
+    {
+        // only the most recent allocation can be given back, everything else waits for reset()
+        if (static_cast<std::byte*>(pointer_a) + size_a == this->block + this->size)
+        {
+            this->size -= size_a;
+        }
+    }
+
+    void reset()
+    {
+        while (nullptr != this->overflow)
+        {
+            Overflow* next = this->overflow->next;
+            this->upstream->deallocate(this->overflow, this->overflow->size, this->overflow->alignment);
+            this->overflow = next;
+        }
+
+        this->size = 0u;
+    }
+
+    std::size_t get_capacity() const
+    {
+        return this->capacity;
+    }
+    std::size_t get_size() const
+    {
+        return this->size;
+    }
+    std::size_t get_peak_size() const
+    {
+        return this->peak_size;
+    }
+    std::size_t get_overflows_count() const
+    {
+        return this->overflows_count;
+    }
+
+private:
+    struct Overflow
+    {
+        Overflow* next;
+        std::size_t size;
+        std::size_t alignment;
+    };
+
+    void* allocate_overflow(std::size_t size_a, std::size_t alignment_a)
+    {
+        const std::size_t alignment = std::max(alignment_a, alignof(Overflow));
+        const std::size_t header_size = (sizeof(Overflow) + alignment - 1u) & ~(alignment - 1u);
+
+        auto* overflow = static_cast<Overflow*>(this->upstream->allocate(header_size + size_a, alignment));
+        *overflow = { .next = this->overflow, .size = header_size + size_a, .alignment = alignment };
+
+        this->overflow = overflow;
+        this->overflows_count++;
+
+        return reinterpret_cast<std::byte*>(overflow) + header_size;
+    }
+
+    Resource* upstream;
+
+    std::size_t capacity;
+    std::size_t size = 0u;
+    std::size_t peak_size = 0u;
+
+    std::byte* block;
+
+    Overflow* overflow = nullptr;
+    std::size_t overflows_count = 0u;
+};
+
+/// @brief A ring of arenas, one per frame in flight. Memory allocated during a frame stays valid for the next
+/// frames_count - 1 frames, which covers data still read by the GPU.
+/// @tparam frames_count number of frames the allocations survive.
+template<std::size_t frames_count = 2u> class FrameArena : public Resource
+{
+    static_assert(frames_count > 0u);
+
+public:
+    FrameArena(std::size_t capacity_a, Resource& upstream_a = Heap::get_default())
+        : FrameArena(capacity_a, upstream_a, std::make_index_sequence<frames_count> {})
+    {
+    }
+
+    [[nodiscard]] void* allocate(std::size_t size_a, std::size_t alignment_a) override
+    {
+        return this->arenas[this->index].allocate(size_a, alignment_a);
+    }
+    void deallocate(void* pointer_a, std::size_t size_a, std::size_t alignment_a) override
+    {
+        this->arenas[this->index].deallocate(pointer_a, size_a, alignment_a);
+    }
+
+    /// @brief Switches to the next arena and resets it: everything allocated frames_count frames ago is released.
+    void next_frame()
+    {
+        this->index = (this->index + 1u) % frames_count;
+        this->arenas[this->index].reset();
+    }
+
+    Arena& get_current()
+    {
+        return this->arenas[this->index];
+    }
+    const Arena& get_current() const
+    {
+        return this->arenas[this->index];
+    }
+
+private:
+    template<std::size_t... indices>
+    FrameArena(std::size_t capacity_a, Resource& upstream_a, std::index_sequence<indices...>)
+        : arenas { ((void)indices, Arena(capacity_a, upstream_a))... }
+    {
+    }
+
+    std::array<Arena, frames_count> arenas;
+    std::size_t index = 0u;
+};
+} // namespace lx::memory
@@ -0,0 +1,251 @@
+#pragma once
+
+/*
+ *   Name: Pool.hpp
+ *   Copyright (c) Mateusz Semegen and contributors. All rights reserved.
+ */
+
+// lx
+#include <lx/common/Handle.hpp>
+#include <lx/common/non_copyable.hpp>
+#include <lx/containers/Vector.hpp>
+#include <lx/memory/Allocator.hpp>
+#include <lx/memory/Resource.hpp>
+
+// std
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <utility>
+
+namespace lx::memory {
+
+/// @brief A fixed capacity pool of objects addressed by generational handles.
+/// Objects never move, so pointers returned by get() stay valid until the object is destroyed. A handle packs the slot index
+/// with the slot generation, which is bumped on every destroy: handles to destroyed objects are detected instead of aliasing
+/// a new object. A slot whose generation would wrap is retired, so the pool loses capacity rather than that guarantee.
+/// Live objects can be iterated densely.
+/// @tparam Type of the pooled objects.
+/// @tparam Value underlying handle type, std::uint32_t (20 bit index, 12 bit generation) or std::uint64_t (32/32 bit).
+template<typename Type, typename Value = std::uint32_t> class Pool : private lx::common::non_copyable
+{
+    static_assert(std::same_as<Value, std::uint32_t> || std::same_as<Value, std::uint64_t>);
+
+public:
+    using Handle = lx::common::Handle<Value, Pool>;
+
+    Pool(std::size_t capacity_a, Resource& resource_a = Heap::get_default())
+        : capacity(capacity_a)
+        , resource(&resource_a)
+        , objects(static_cast<Type*>(resource_a.allocate(capacity_a * sizeof(Type), alignof(Type))))
+        , slots(capacity_a, resource_a)
+        , free_indices(capacity_a, resource_a)
+        , live_indices(capacity_a, resource_a)
+    {
+        assert(capacity_a <= Handle::index_mask);
+
+        for (std::size_t i = 0u; i < capacity_a; i++)
+        {
+            this->slots.push_back({ .generation = 0u, .live_index = npos });
+            this->free_indices.push_back(static_cast<Value>(capacity_a - 1u - i));
+        }
+    }
+    Pool(Pool&& other_a) noexcept
+        : capacity(std::exchange(other_a.capacity, 0u))
+        , resource(other_a.resource)
+        , objects(std::exchange(other_a.objects, nullptr))
+        , slots(std::move(other_a.slots))
+        , free_indices(std::move(other_a.free_indices))
+        , live_indices(std::move(other_a.live_indices))
+    {
+    }
+    ~Pool()
+    {
+        this->clear();
+
+        if (nullptr != this->objects)
+        {
+            this->resource->deallocate(this->objects, this->capacity * sizeof(Type), alignof(Type));
+        }
+    }
+
+    /// @brief Constructs a new object in a free slot. Returns a null handle when the pool is full.
+    template<typename... Arg> Handle create(Arg&&... args_a)
+    {
+        if (true == this->free_indices.is_empty())
+        {
+            return {};
+        }
+
+        const Value index = this->free_indices.get_back();
+        this->free_indices.pop_back();
+
+        // placement new and explicit destructor call (not std::construct_at) so a friend Pool can hold types with private constructors
+        ::new (static_cast<void*>(this->objects + index)) Type(std::forward<Arg>(args_a)...);
+
+        Slot& slot = this->slots[index];
+        slot.live_index = this->live_indices.get_length();
+        this->live_indices.push_back(index);
+
+        return { .value = static_cast<Value>((slot.generation << Handle::index_bits) | index) };
+    }
+    bool destroy(Handle handle_a)
+    {
+        if (false == this->is_valid(handle_a))
+        {
+            return false;
+        }
+
+        const std::size_t index = handle_a.get_index();
+        Slot& slot = this->slots[index];
+
+        this->objects[index].~Type();
+
+        // swap-and-pop keeps live_indices dense
+        const Value last = this->live_indices.get_back();
+        this->live_indices[slot.live_index] = last;
+        this->slots[last].live_index = slot.live_index;
+        this->live_indices.pop_back();
+
+        // a wrapped generation would make the oldest stale handles valid again, such slots are retired instead of reused
+        slot.live_index = npos;
+        slot.generation = (slot.generation + 1u) & Handle::generation_mask;
+
+        if (Handle::generation_mask != slot.generation)
+        {
+            this->free_indices.push_back(static_cast<Value>(index));
+        }
+
+        return true;
+    }
+    void clear()
+    {
+        for (std::size_t i = this->live_indices.get_length(); i > 0u; i--)
+        {
+            const Value index = this->live_indices[i - 1u];
+            this->destroy({ .value = static_cast<Value>((this->slots[index].generation << Handle::index_bits) | index) });
+        }
+    }
+
+    bool is_valid(Handle handle_a) const
+    {
+        const std::size_t index = handle_a.get_index();
+
+        return false == handle_a.is_null() && index < this->capacity && npos != this->slots[index].live_index &&
+               this->slots[index].generation == handle_a.get_generation();
+    }
+
+    /// @brief Returns the object or nullptr when the handle is stale.
+    Type* get(Handle handle_a)
+    {
+        return true == this->is_valid(handle_a) ? this->objects + handle_a.get_index() : nullptr;
+    }
+    const Type* get(Handle handle_a) const
+    {
+        return true == this->is_valid(handle_a) ? this->objects + handle_a.get_index() : nullptr;
+    }
+
+    /// @brief Returns the handle of an object owned by the pool or a null handle for any other pointer.
+    Handle get_handle(const Type* object_a) const
+    {
+        if (object_a >= this->objects && object_a < this->objects + this->capacity)
+        {
+            const std::size_t index = static_cast<std::size_t>(object_a - this->objects);
+
+            if (npos != this->slots[index].live_index)
+            {
+                return { .value = static_cast<Value>((this->slots[index].generation << Handle::index_bits) | index) };
+            }
+        }
+
+        return {};
+    }
+
+    std::size_t get_length() const
+    {
+        return this->live_indices.get_length();
+    }
+    std::size_t get_capacity() const
+    {
+        return this->capacity;
+    }
+    bool is_empty() const
+    {
+        return this->live_indices.is_empty();
+    }
+    bool is_full() const
+    {
+        return this->free_indices.is_empty();
+    }
+
+    template<typename Pool_type, typename Object_type> class Iterator
+    {
+    public:
+        Iterator(Pool_type* pool_a, std::size_t live_index_a)
+            : pool(pool_a)
+            , live_index(live_index_a)
+        {
+        }
+
+        Object_type& operator*() const
+        {
+            return this->pool->objects[this->pool->live_indices[this->live_index]];
+        }
+        Object_type* operator->() const
+        {
+            return &(**this);
+        }
+        Iterator& operator++()
+        {
+            this->live_index++;
+            return *this;
+        }
+        bool operator==(const Iterator& other_a) const
+        {
+            return this->live_index == other_a.live_index;
+        }
+
+    private:
+        Pool_type* pool;
+        std::size_t live_index;
+    };
+
+    Iterator<Pool, Type> begin()
+    {
+        return { this, 0u };
+    }
+    Iterator<Pool, Type> end()
+    {
+        return { this, this->live_indices.get_length() };
+    }
+    Iterator<const Pool, const Type> begin() const
+    {
+        return { this, 0u };
+    }
+    Iterator<const Pool, const Type> end() const
+    {
+        return { this, this->live_indices.get_length() };
+    }
+
+private:
+    constexpr static std::size_t npos = std::numeric_limits<std::size_t>::max();
+
+    struct Slot
+    {
+        Value generation;
+        std::size_t live_index;
+    };
+
+    std::size_t capacity;
+    Resource* resource;
+
+    Type* objects;
+
+    containers::Vector<Slot, 0u, Allocator<Slot>> slots;
+    containers::Vector<Value, 0u, Allocator<Value>> free_indices;
+    containers::Vector<Value, 0u, Allocator<Value>> live_indices;
+};
+} // namespace lx::memory
@@ -0,0 +1,89 @@
+#pragma once
+
+/*
+ *   Name: Resource.hpp
+ *   Copyright (c) Mateusz Semegen and contributors. All rights reserved.
+ */
+
+// lx
+#include <lx/common/non_copyable.hpp>
+
+// std
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <string_view>
+
+namespace lx::memory {
+
+/// @brief A source of raw memory that containers can draw from (heap, arena, pool...).
+class Resource : private lx::common::non_copyable
+{
+public:
+    virtual ~Resource() = default;
+
+    [[nodiscard]] virtual void* allocate(std::size_t size_a, std::size_t alignment_a) = 0;
+    virtual void deallocate(void* pointer_a, std::size_t size_a, std::size_t alignment_a) = 0;
+};
+
+/// @brief A general purpose heap resource that counts what was allocated through it.
+/// Give each engine subsystem its own instance to attribute memory use.
+class Heap : public Resource
+{
+public:
+    Heap(std::string_view name_a)
+        : name(name_a)
+    {
+    }
+
+    [[nodiscard]] void* allocate(std::size_t size_a, std::size_t alignment_a) override
+    {
+        void* pointer = ::operator new(size_a, std::align_val_t { alignment_a });
+
+        const std::size_t size = this->size.fetch_add(size_a, std::memory_order_relaxed) + size_a;
+        std::size_t peak = this->peak_size.load(std::memory_order_relaxed);
+
+        while (size > peak && false == this->peak_size.compare_exchange_weak(peak, size, std::memory_order_relaxed));
+
+        this->allocations_count.fetch_add(1u, std::memory_order_relaxed);
+
+        return pointer;
+    }
+    void deallocate(void* pointer_a, std::size_t size_a, std::size_t alignment_a) override
+    {
+        ::operator delete(pointer_a, size_a, std::align_val_t { alignment_a });
+
+        this->size.fetch_sub(size_a, std::memory_order_relaxed);
+    }
+
+    std::string_view get_name() const
+    {
+        return this->name;
+    }
+    std::size_t get_size() const
+    {
+        return this->size.load(std::memory_order_relaxed);
+    }
+    std::size_t get_peak_size() const
+    {
+        return this->peak_size.load(std::memory_order_relaxed);
+    }
+    std::size_t get_allocations_count() const
+    {
+        return this->allocations_count.load(std::memory_order_relaxed);
+    }
+
+    static Heap& get_default()
+    {
+        static Heap heap("default");
+        return heap;
+    }
+
+private:
+    std::string_view name;
+
+    std::atomic<std::size_t> size = 0u;
+    std::atomic<std::size_t> peak_size = 0u;
+    std::atomic<std::size_t> allocations_count = 0u;
+};
+} // namespace lx::memory
@@ -0,0 +1,61 @@
+#pragma once
+
+/*
+ *   Name: Aabb.hpp
+ *   Copyright (c) Mateusz Semegen and contributors. All rights reserved.
+ */
+
+// lx
+#include <lx/math/Vector.hpp>
+
+// std
+#include <algorithm>
+
+namespace lx::physics {
+
+/// @brief 2D axis aligned bounding box.
+struct Aabb
+{
+    lx::math::Vector<float, 2u> min;
+    lx::math::Vector<float, 2u> max;
+
+    static Aabb merge(const Aabb& left_a, const Aabb& right_a)
+    {
+        return { .min = { .x = std::min(left_a.min.x, right_a.min.x), .y = std::min(left_a.min.y, right_a.min.y) },
+                 .max = { .x = std::max(left_a.max.x, right_a.max.x), .y = std::max(left_a.max.y, right_a.max.y) } };
+    }
+
+    bool contains(const Aabb& other_a) const
+    {
+        return this->min.x <= other_a.min.x && this->min.y <= other_a.min.y && other_a.max.x <= this->max.x &&
+               other_a.max.y <= this->max.y;
+    }
+    bool overlaps(const Aabb& other_a) const
+    {
+        return this->min.x <= other_a.max.x && other_a.min.x <= this->max.x && this->min.y <= other_a.max.y &&
+               other_a.min.y <= this->max.y;
+    }
+
+    /// @brief The box grown by margin_a on every side.
+    Aabb get_expanded(float margin_a) const
+    {
+        return { .min = { .x = this->min.x - margin_a, .y = this->min.y - margin_a },
+                 .max = { .x = this->max.x + margin_a, .y = this->max.y + margin_a } };
+    }
+    /// @brief The box stretched in the direction of displacement_a.
+    Aabb get_swept(lx::math::Vector<float, 2u> displacement_a) const
+    {
+        Aabb swept = *this;
+
+        (displacement_a.x < 0.0f ? swept.min.x : swept.max.x) += displacement_a.x;
+        (displacement_a.y < 0.0f ? swept.min.y : swept.max.y) += displacement_a.y;
+
+        return swept;
+    }
+    /// @brief The cost of a box in the tree heuristics, in 2D the perimeter takes the role of the surface area.
+    float get_perimeter() const
+    {
+        return 2.0f * ((this->max.x - this->min.x) + (this->max.y - this->min.y));
+    }
+};
+} // namespace lx::physics
@@ -0,0 +1,439 @@
+#pragma once
+
+/*
+ *   Name: DynamicTree.hpp
+ *   Copyright (c) Mateusz Semegen and contributors. All rights reserved.
+ */
+
+// lx
+#include <lx/containers/SmallVector.hpp>
+#include <lx/containers/Vector.hpp>
+#include <lx/math/Vector.hpp>
+#include <lx/memory/Allocator.hpp>
+#include <lx/memory/Resource.hpp>
+#include <lx/physics/Aabb.hpp>
+
+// std
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <limits>
+
+namespace lx::physics {
+
+/// @brief Broadphase over a bounding volume hierarchy of fat boxes: every proxy is a leaf holding its box grown by a margin and
+/// by the predicted motion, so small moves do not touch the tree at all. A leaf which leaves its fat box gets a new one, kept in
+/// place when the parent still bounds it and reinserted otherwise. Inserting searches the sibling by the perimeter heuristic
+/// with a branch and bound descent and the refit rotates nodes wherever that shrinks the boxes, so queries stay fast while the
+/// bodies move.
+class DynamicTree
+{
+public:
+    constexpr static std::uint32_t npos = std::numeric_limits<std::uint32_t>::max();
+
+    /// @param margin_a by which the fat boxes exceed the tight ones.
+    explicit DynamicTree(float margin_a = 0.1f, lx::memory::Resource& resource_a = lx::memory::Heap::get_default())
+        : margin(margin_a)
+        , nodes(lx::memory::Allocator<Node>(resource_a))
+    {
+    }
+
+    std::uint32_t create(const Aabb& aabb_a)
+    {
+        const std::uint32_t proxy = this->allocate_node();
+
+        Node& node = this->nodes[proxy];
+        node.aabb = aabb_a.get_expanded(this->margin);
+        node.height = 0;
+
+        this->insert_leaf(proxy);
+        this->proxies_count++;
+
+        return proxy;
+    }
+    void destroy(std::uint32_t proxy_a)
+    {
+        assert(false == this->nodes[proxy_a].is_free() && true == this->nodes[proxy_a].is_leaf());
+
+        this->remove_leaf(proxy_a);
+        this->free_node(proxy_a);
+        this->proxies_count--;
+    }
+    /// @brief Updates the box of the proxy, predicting the next move by displacement_a. Returns true when the fat box changed.
+    bool move(std::uint32_t proxy_a, const Aabb& aabb_a, lx::math::Vector<float, 2u> displacement_a = {})
+    {
+        assert(false == this->nodes[proxy_a].is_free() && true == this->nodes[proxy_a].is_leaf());
+
+        Node& leaf = this->nodes[proxy_a];
+        const Aabb fat = aabb_a.get_expanded(this->margin).get_swept(displacement_a * displacement_multiplier);
+
+        // a fat box much bigger than needed (the body slowed down) is shrunk, as it would produce false pairs
+        if (true == leaf.aabb.contains(aabb_a) && true == fat.get_expanded(4.0f * this->margin).contains(leaf.aabb))
+        {
+            return false;
+        }
+
+        if (npos != leaf.parent && true == this->nodes[leaf.parent].aabb.contains(fat))
+        {
+            leaf.aabb = fat;
+            return true;
+        }
+
+        this->remove_leaf(proxy_a);
+        this->nodes[proxy_a].aabb = fat;
+        this->insert_leaf(proxy_a);
+
+        return true;
+    }
+
+    /// @brief Calls function_a(proxy) for every proxy whose fat box overlaps aabb_a.
+    template<typename Function> void query(const Aabb& aabb_a, Function&& function_a) const
+    {
+        if (npos == this->root)
+        {
+            return;
+        }
+
+        lx::containers::SmallVector<std::uint32_t, 64u> stack;
+        stack.push_back(this->root);
+
+        while (false == stack.is_empty())
+        {
+            const std::uint32_t index = stack.get_back();
+            const Node& node = this->nodes[index];
+
+            stack.pop_back();
+
+            if (true == node.aabb.overlaps(aabb_a))
+            {
+                if (true == node.is_leaf())
+                {
+                    function_a(index);
+                }
+                else
+                {
+                    stack.push_back(node.left);
+                    stack.push_back(node.right);
+                }
+            }
+        }
+    }
+
+    const Aabb& get_fat_aabb(std::uint32_t proxy_a) const
+    {
+        return this->nodes[proxy_a].aabb;
+    }
+    std::size_t get_height() const
+    {
+        return npos != this->root ? static_cast<std::size_t>(this->nodes[this->root].height) : 0u;
+    }
+    std::size_t get_length() const
+    {
+        return this->proxies_count;
+    }
+
+private:
+    constexpr static float displacement_multiplier = 2.0f;
+
+    // parent is the next free node of a free one, the height of a free node is -1: free nodes have no children, like leaves,
+    // and the mark keeps a node in 32 bytes
+    struct Node
+    {
+        Aabb aabb;
+        std::uint32_t parent = npos;
+        std::uint32_t left = npos;
+        std::uint32_t right = npos;
+        std::int32_t height = 0;
+
+        bool is_leaf() const
+        {
+            return npos == this->left;
+        }
+        bool is_free() const
+        {
+            return -1 == this->height;
+        }
+    };
+
+    std::uint32_t allocate_node()
+    {
+        std::uint32_t index = this->free_head;
+
+        if (npos == index)
+        {
+            index = static_cast<std::uint32_t>(this->nodes.get_length());
+            this->nodes.emplace_back();
+        }
+        else
+        {
+            this->free_head = this->nodes[index].parent;
+        }
+
+        this->nodes[index] = Node {};
+        return index;
+    }
+    void free_node(std::uint32_t index_a)
+    {
+        this->nodes[index_a] = Node { .aabb = {}, .parent = this->free_head, .left = npos, .right = npos, .height = -1 };
+        this->free_head = index_a;
+    }
+
+    void insert_leaf(std::uint32_t leaf_a)
+    {
+        if (npos == this->root)
+        {
+            this->root = leaf_a;
+            this->nodes[leaf_a].parent = npos;
+
+            return;
+        }
+
+        const Aabb aabb = this->nodes[leaf_a].aabb;
+        const std::uint32_t sibling = this->find_sibling(aabb);
+        const std::uint32_t old_parent = this->nodes[sibling].parent;
+        const std::uint32_t new_parent = this->allocate_node();
+
+        Node& parent = this->nodes[new_parent];
+        parent.parent = old_parent;
+        parent.aabb = Aabb::merge(aabb, this->nodes[sibling].aabb);
+        parent.height = this->nodes[sibling].height + 1;
+        parent.left = sibling;
+        parent.right = leaf_a;
+
+        if (npos != old_parent)
+        {
+            Node& grand_parent = this->nodes[old_parent];
+            (sibling == grand_parent.left ? grand_parent.left : grand_parent.right) = new_parent;
+        }
+        else
+        {
+            this->root = new_parent;
+        }
+
+        this->nodes[sibling].parent = new_parent;
+        this->nodes[leaf_a].parent = new_parent;
+
+        this->refit(new_parent);
+    }
+    void remove_leaf(std::uint32_t leaf_a)
+    {
+        if (leaf_a == this->root)
+        {
+            this->root = npos;
+            return;
+        }
+
+        const std::uint32_t parent = this->nodes[leaf_a].parent;
+        const std::uint32_t grand_parent = this->nodes[parent].parent;
+        const std::uint32_t sibling = leaf_a == this->nodes[parent].left ? this->nodes[parent].right : this->nodes[parent].left;
+
+        this->nodes[sibling].parent = grand_parent;
+        this->free_node(parent);
+
+        if (npos != grand_parent)
+        {
+            Node& node = this->nodes[grand_parent];
+            (parent == node.left ? node.left : node.right) = sibling;
+
+            this->refit(grand_parent);
+        }
+        else
+        {
+            this->root = sibling;
+        }
+    }
+
+    // the cost of pairing with a node is the perimeter of the new parent plus the growth of every ancestor (inherited); the search
+    // follows the child with the lower bound of that cost and stops when neither child can beat the best node found so far. When
+    // both children contain the box the bounds tie and the child with the closer center is taken.
+    std::uint32_t find_sibling(const Aabb& aabb_a) const
+    {
+        const float perimeter = aabb_a.get_perimeter();
+        const lx::math::Vector<float, 2u> center = aabb_a.min + aabb_a.max;
+
+        std::uint32_t index = this->root;
+        float base = this->nodes[index].aabb.get_perimeter();
+        float direct = Aabb::merge(this->nodes[index].aabb, aabb_a).get_perimeter();
+        float inherited = 0.0f;
+
+        std::uint32_t best = index;
+        float best_cost = direct;
+
+        while (false == this->nodes[index].is_leaf())
+        {
+            const Node& node = this->nodes[index];
+
+            if (direct + inherited < best_cost)
+            {
+                best = index;
+                best_cost = direct + inherited;
+            }
+
+            inherited += direct - base;
+
+            const Candidate left = this->get_candidate(node.left, aabb_a, perimeter, inherited, best, best_cost);
+            const Candidate right = this->get_candidate(node.right, aabb_a, perimeter, inherited, best, best_cost);
+
+            if ((true == left.is_leaf && true == right.is_leaf) || (best_cost <= left.lower_cost && best_cost <= right.lower_cost))
+            {
+                break;
+            }
+
+            bool is_left = left.lower_cost < right.lower_cost;
+
+            if (left.lower_cost == right.lower_cost)
+            {
+                const Aabb& left_aabb = this->nodes[node.left].aabb;
+                const Aabb& right_aabb = this->nodes[node.right].aabb;
+
+                is_left = lx::math::length_squared(left_aabb.min + left_aabb.max - center) <
+                          lx::math::length_squared(right_aabb.min + right_aabb.max - center);
+            }
+
+            const Candidate& next = true == is_left && false == left.is_leaf ? left : right;
+
+            index = true == is_left && false == left.is_leaf ? node.left : node.right;
+            base = next.perimeter;
+            direct = next.direct;
+        }
+
+        return best;
+    }
+
+    struct Candidate
+    {
+        bool is_leaf;
+        float perimeter;
+        float direct;
+        float lower_cost;
+    };
+
+    // a leaf is a final candidate, a branch gives the lower bound of the cost of any node below it
+    Candidate get_candidate(std::uint32_t index_a,
+                            const Aabb& aabb_a,
+                            float perimeter_a,
+                            float inherited_a,
+                            std::uint32_t& best_a,
+                            float& best_cost_a) const
+    {
+        const Node& node = this->nodes[index_a];
+        const float direct = Aabb::merge(node.aabb, aabb_a).get_perimeter();
+
+        if (true == node.is_leaf())
+        {
+            if (direct + inherited_a < best_cost_a)
+            {
+                best_a = index_a;
+                best_cost_a = direct + inherited_a;
+            }
+
+            return { .is_leaf = true, .perimeter = 0.0f, .direct = direct, .lower_cost = std::numeric_limits<float>::max() };
+        }
+
+        const float perimeter = node.aabb.get_perimeter();
+        return { .is_leaf = false,
+                 .perimeter = perimeter,
+                 .direct = direct,
+                 .lower_cost = inherited_a + direct + std::min(perimeter_a - perimeter, 0.0f) };
+    }
+
+    // walks from index_a to the root, rotating and recomputing the boxes and heights on the way
+    void refit(std::uint32_t index_a)
+    {
+        while (npos != index_a)
+        {
+            this->rotate(index_a);
+
+            Node& node = this->nodes[index_a];
+            const Node& left = this->nodes[node.left];
+            const Node& right = this->nodes[node.right];
+
+            node.height = 1 + std::max(left.height, right.height);
+            node.aabb = Aabb::merge(left.aabb, right.aabb);
+
+            index_a = node.parent;
+        }
+    }
+
+    // swaps a child of index_a with a grandchild on the other side when it shrinks the sum of the perimeters of the branches,
+    // which keeps the tree good for queries as the leaves move; balancing by height alone makes branches of distant leaves
+    void rotate(std::uint32_t index_a)
+    {
+        const Node& a = this->nodes[index_a];
+
+        if (a.height < 2)
+        {
+            return;
+        }
+
+        const std::uint32_t b = a.left;
+        const std::uint32_t c = a.right;
+
+        Rotation best;
+
+        if (false == this->nodes[c].is_leaf())
+        {
+            this->consider(b, c, best);
+        }
+        if (false == this->nodes[b].is_leaf())
+        {
+            this->consider(c, b, best);
+        }
+
+        if (npos == best.child)
+        {
+            return;
+        }
+
+        // the child goes under the branch in place of the grandchild, which takes the place of the child under index_a
+        Node& parent = this->nodes[index_a];
+        Node& branch = this->nodes[best.branch];
+        const std::uint32_t kept = best.grandchild == branch.left ? branch.right : branch.left;
+
+        (best.child == parent.left ? parent.left : parent.right) = best.grandchild;
+        (best.grandchild == branch.left ? branch.left : branch.right) = best.child;
+
+        this->nodes[best.child].parent = best.branch;
+        this->nodes[best.grandchild].parent = index_a;
+
+        branch.aabb = Aabb::merge(this->nodes[best.child].aabb, this->nodes[kept].aabb);
+        branch.height = 1 + std::max(this->nodes[best.child].height, this->nodes[kept].height);
+    }
+
+    struct Rotation
+    {
+        std::uint32_t child = npos;
+        std::uint32_t branch = npos;
+        std::uint32_t grandchild = npos;
+        float gain = 0.0f;
+    };
+
+    // the gain of swapping child_a with either child of its sibling branch_a: only the box of branch_a changes
+    void consider(std::uint32_t child_a, std::uint32_t branch_a, Rotation& best_a) const
+    {
+        const Node& child = this->nodes[child_a];
+        const Node& branch = this->nodes[branch_a];
+        const float perimeter = branch.aabb.get_perimeter();
+
+        for (const std::uint32_t grandchild : { branch.left, branch.right })
+        {
+            const std::uint32_t kept = grandchild == branch.left ? branch.right : branch.left;
+            const float gain = perimeter - Aabb::merge(child.aabb, this->nodes[kept].aabb).get_perimeter();
+
+            if (gain > best_a.gain)
+            {
+                best_a = { .child = child_a, .branch = branch_a, .grandchild = grandchild, .gain = gain };
+            }
+        }
+    }
+
+    float margin;
+
+    lx::containers::Vector<Node, 0u, lx::memory::Allocator<Node>> nodes;
+    std::uint32_t root = npos;
+    std::uint32_t free_head = npos;
+    std::size_t proxies_count = 0u;
+};
+} // namespace lx::physics
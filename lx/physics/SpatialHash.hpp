@@ -0,0 +1,295 @@
+#pragma once
+
+/*
+ *   Name: SpatialHash.hpp
+ *   Copyright (c) Mateusz Semegen and contributors. All rights reserved.
+ */
+
+// lx
+#include <lx/containers/FlatMap.hpp>
+#include <lx/containers/Vector.hpp>
+#include <lx/math/Vector.hpp>
+#include <lx/memory/Allocator.hpp>
+#include <lx/memory/Resource.hpp>
+#include <lx/physics/Aabb.hpp>
+
+// std
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace lx::physics {
+
+/// @brief Broadphase over a uniform grid of cells hashed by their coordinates, for many bodies of similar size: with cells about
+/// the size of a body every proxy is in at most four cells and a query reads a handful of short lists. As in DynamicTree the
+/// proxies keep fat boxes, a proxy changes its cells only when its fat box is replaced and covers other cells than before.
+/// Bodies much bigger than a cell are slow to move and to query, those belong to a DynamicTree.
+class SpatialHash
+{
+public:
+    constexpr static std::uint32_t npos = std::numeric_limits<std::uint32_t>::max();
+
+    /// @param cell_size_a edge of a cell, a bit bigger than a typical body.
+    /// @param margin_a by which the fat boxes exceed the tight ones.
+    explicit SpatialHash(float cell_size_a = 1.0f,
+                         float margin_a = 0.1f,
+                         lx::memory::Resource& resource_a = lx::memory::Heap::get_default())
+        : resource(&resource_a)
+        , inverse_cell_size(1.0f / cell_size_a)
+        , margin(margin_a)
+        , proxies(lx::memory::Allocator<Proxy>(resource_a))
+        , cells(lx::memory::Allocator<Cell>(resource_a))
+        , cells_by_key(lx::memory::Allocator<std::byte>(resource_a))
+    {
+        assert(cell_size_a > 0.0f);
+    }
+
+    std::uint32_t create(const Aabb& aabb_a)
+    {
+        std::uint32_t proxy = this->free_head;
+
+        if (npos == proxy)
+        {
+            proxy = static_cast<std::uint32_t>(this->proxies.get_length());
+            this->proxies.emplace_back();
+        }
+        else
+        {
+            this->free_head = this->proxies[proxy].next_free;
+        }
+
+        Proxy& created = this->proxies[proxy];
+        created.aabb = aabb_a.get_expanded(this->margin);
+        created.range = this->get_range(created.aabb);
+        created.stamp = 0u;
+        created.next_free = npos;
+        created.is_alive = true;
+
+        this->insert(proxy, created.range, Range::empty());
+        this->proxies_count++;
+
+        return proxy;
+    }
+    void destroy(std::uint32_t proxy_a)
+    {
+        Proxy& proxy = this->proxies[proxy_a];
+        assert(true == proxy.is_alive);
+
+        this->erase(proxy_a, proxy.range, Range::empty());
+
+        proxy.is_alive = false;
+        proxy.next_free = this->free_head;
+        this->free_head = proxy_a;
+        this->proxies_count--;
+    }
+    /// @brief Updates the box of the proxy, predicting the next move by displacement_a. Returns true when the fat box changed.
+    bool move(std::uint32_t proxy_a, const Aabb& aabb_a, lx::math::Vector<float, 2u> displacement_a = {})
+    {
+        Proxy& proxy = this->proxies[proxy_a];
+        assert(true == proxy.is_alive);
+
+        const Aabb fat = aabb_a.get_expanded(this->margin).get_swept(displacement_a * displacement_multiplier);
+
+        if (true == proxy.aabb.contains(aabb_a) && true == fat.get_expanded(4.0f * this->margin).contains(proxy.aabb))
+        {
+            return false;
+        }
+
+        const Range range = this->get_range(fat);
+
+        if (range != proxy.range)
+        {
+            this->erase(proxy_a, proxy.range, range);
+            this->insert(proxy_a, range, proxy.range);
+        }
+
+        proxy.aabb = fat;
+        proxy.range = range;
+
+        return true;
+    }
+
+    /// @brief Calls function_a(proxy) once for every proxy whose fat box overlaps aabb_a.
+    template<typename Function> void query(const Aabb& aabb_a, Function&& function_a)
+    {
+        const Range range = this->get_range(aabb_a);
+
+        // a proxy in several cells is reported in the first one only, the stamps of all proxies restart when the counter wraps
+        if (0u == ++this->stamp)
+        {
+            for (Proxy& proxy : this->proxies)
+            {
+                proxy.stamp = 0u;
+            }
+
+            this->stamp = 1u;
+        }
+
+        for (std::int32_t y = range.min_y; y <= range.max_y; y++)
+        {
+            for (std::int32_t x = range.min_x; x <= range.max_x; x++)
+            {
+                const std::uint32_t* cell = this->cells_by_key.find(get_key(x, y));
+
+                if (nullptr == cell)
+                {
+                    continue;
+                }
+
+                for (const std::uint32_t index : this->cells[*cell].proxies)
+                {
+                    Proxy& proxy = this->proxies[index];
+
+                    if (this->stamp != proxy.stamp && true == proxy.aabb.overlaps(aabb_a))
+                    {
+                        proxy.stamp = this->stamp;
+                        function_a(index);
+                    }
+                }
+            }
+        }
+    }
+
+    const Aabb& get_fat_aabb(std::uint32_t proxy_a) const
+    {
+        return this->proxies[proxy_a].aabb;
+    }
+    std::size_t get_length() const
+    {
+        return this->proxies_count;
+    }
+    std::size_t get_cells_count() const
+    {
+        return this->cells.get_length();
+    }
+
+private:
+    constexpr static float displacement_multiplier = 2.0f;
+
+    // inclusive range of cell coordinates
+    struct Range
+    {
+        std::int32_t min_x = 0;
+        std::int32_t min_y = 0;
+        std::int32_t max_x = -1;
+        std::int32_t max_y = -1;
+
+        static Range empty()
+        {
+            return {};
+        }
+        bool contains(std::int32_t x_a, std::int32_t y_a) const
+        {
+            return this->min_x <= x_a && x_a <= this->max_x && this->min_y <= y_a && y_a <= this->max_y;
+        }
+
+        bool operator==(const Range&) const = default;
+    };
+
+    struct Proxy
+    {
+        Aabb aabb;
+        Range range;
+        std::uint32_t stamp = 0u;
+        std::uint32_t next_free = npos;
+        bool is_alive = false;
+    };
+
+    // cells are never released, a body moving back and forth between two cells does not allocate
+    struct Cell
+    {
+        explicit Cell(const lx::memory::Allocator<std::uint32_t>& allocator_a)
+            : proxies(allocator_a)
+        {
+        }
+
+        lx::containers::Vector<std::uint32_t, 0u, lx::memory::Allocator<std::uint32_t>> proxies;
+    };
+
+    static std::uint64_t get_key(std::int32_t x_a, std::int32_t y_a)
+    {
+        return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(x_a)) << 32u) | static_cast<std::uint32_t>(y_a);
+    }
+    std::int32_t get_coordinate(float value_a) const
+    {
+        constexpr float limit = static_cast<float>(std::numeric_limits<std::int32_t>::max() / 2);
+        return static_cast<std::int32_t>(std::floor(std::clamp(value_a * this->inverse_cell_size, -limit, limit)));
+    }
+    Range get_range(const Aabb& aabb_a) const
+    {
+        return { .min_x = this->get_coordinate(aabb_a.min.x),
+                 .min_y = this->get_coordinate(aabb_a.min.y),
+                 .max_x = this->get_coordinate(aabb_a.max.x),
+                 .max_y = this->get_coordinate(aabb_a.max.y) };
+    }
+
+    // adds the proxy to the cells of range_a which are not in skip_a
+    void insert(std::uint32_t proxy_a, const Range& range_a, const Range& skip_a)
+    {
+        for (std::int32_t y = range_a.min_y; y <= range_a.max_y; y++)
+        {
+            for (std::int32_t x = range_a.min_x; x <= range_a.max_x; x++)
+            {
+                if (true == skip_a.contains(x, y))
+                {
+                    continue;
+                }
+
+                const std::uint64_t key = get_key(x, y);
+                std::uint32_t* cell = this->cells_by_key.find(key);
+
+                if (nullptr == cell)
+                {
+                    this->cells_by_key[key] = static_cast<std::uint32_t>(this->cells.get_length());
+                    this->cells.emplace_back(lx::memory::Allocator<std::uint32_t>(*this->resource));
+                    cell = this->cells_by_key.find(key);
+                }
+
+                this->cells[*cell].proxies.push_back(proxy_a);
+            }
+        }
+    }
+    // removes the proxy from the cells of range_a which are not in skip_a
+    void erase(std::uint32_t proxy_a, const Range& range_a, const Range& skip_a)
+    {
+        for (std::int32_t y = range_a.min_y; y <= range_a.max_y; y++)
+        {
+            for (std::int32_t x = range_a.min_x; x <= range_a.max_x; x++)
+            {
+                if (true == skip_a.contains(x, y))
+                {
+                    continue;
+                }
+
+                auto& proxies = this->cells[*this->cells_by_key.find(get_key(x, y))].proxies;
+                std::uint32_t* found = std::find(proxies.get_buffer(), proxies.get_buffer() + proxies.get_length(), proxy_a);
+
+                assert(found != proxies.get_buffer() + proxies.get_length());
+
+                *found = proxies.get_back();
+                proxies.pop_back();
+            }
+        }
+    }
+
+    lx::memory::Resource* resource;
+    float inverse_cell_size;
+    float margin;
+
+    lx::containers::Vector<Proxy, 0u, lx::memory::Allocator<Proxy>> proxies;
+    std::uint32_t free_head = npos;
+    std::size_t proxies_count = 0u;
+    std::uint32_t stamp = 0u;
+
+    lx::containers::Vector<Cell, 0u, lx::memory::Allocator<Cell>> cells;
+    lx::containers::FlatMap<std::uint64_t,
+                            std::uint32_t,
+                            lx::containers::Hash<std::uint64_t>,
+                            lx::containers::Equal<std::uint64_t>,
+                            lx::memory::Allocator<std::byte>>
+        cells_by_key;
+};
+} // namespace lx::physics
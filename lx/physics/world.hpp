@@ -1,23 +1,272 @@
 #pragma once
 
 // lx
-#include <lx/common/non_constructible.hpp>
+#include <lx/common/non_copyable.hpp>
+#include <lx/containers/FlatMap.hpp>
+#include <lx/containers/Vector.hpp>
+#include <lx/math/Vector.hpp>
+#include <lx/memory/Allocator.hpp>
+#include <lx/memory/Resource.hpp>
+#include <lx/physics/Aabb.hpp>
+#include <lx/physics/DynamicTree.hpp>
+#include <lx/physics/SpatialHash.hpp>
 
 // std
+#include <algorithm>
+#include <cassert>
 #include <cstddef>
+#include <cstdint>
+#include <span>
+#include <utility>
+#include <variant>
 
 namespace lx::physics {
-struct world : private lx::common::non_constructible
+
+/// @brief Bodies and the pairs of them whose fat boxes overlap, found by the broadphase chosen in Properties.
+/// The pairs are kept from step to step: update() queries only the bodies whose fat box changed since the last update and drops
+/// the pairs which stopped overlapping, so a step costs in proportion to the moving bodies instead of the square of all of them.
+/// Ids of destroyed bodies are reused only after the next update(), which first drops their pairs.
+class world : private lx::common::non_copyable
 {
-    using Id = std::size_t;
+public:
+    using Id = std::uint32_t;
+
+    enum class Broadphase : std::uint8_t
+    {
+        tree, // DynamicTree, for bodies of any size
+        grid  // SpatialHash, for many bodies of similar size
+    };
 
     struct Properties
     {
+        Broadphase broadphase = Broadphase::tree;
+
+        // by which the fat boxes exceed the bodies, bigger margins mean fewer broadphase updates and more false pairs
+        float margin = 0.1f;
+        // edge of a grid cell
+        float cell_size = 1.0f;
     };
 
-    Id create(const Properties&)
+    struct Pair
+    {
+        Id first;
+        Id second;
+    };
+
+    world()
+        : world(Properties {})
+    {
+    }
+    explicit world(const Properties& properties_a, lx::memory::Resource& resource_a = lx::memory::Heap::get_default())
+        : broadphase(create_broadphase(properties_a, resource_a))
+        , flags(lx::memory::Allocator<std::uint8_t>(resource_a))
+        , moved(lx::memory::Allocator<Id>(resource_a))
+        , destroyed(lx::memory::Allocator<Id>(resource_a))
+        , pairs(lx::memory::Allocator<Pair>(resource_a))
+        , pairs_by_key(lx::memory::Allocator<std::byte>(resource_a))
+    {
+    }
+
+    Id create(const Aabb& bounds_a)
+    {
+        const Id id = std::visit([&](auto& broadphase_a) { return broadphase_a.create(bounds_a); }, this->broadphase);
+
+        while (this->flags.get_length() <= id)
+        {
+            this->flags.push_back(0u);
+        }
+
+        this->flags[id] = 0u;
+        this->mark_moved(id);
+        this->bodies_count++;
+
+        return id;
+    }
+    void destroy(Id id_a)
+    {
+        assert(0u == (this->flags[id_a] & flag_destroyed));
+
+        this->flags[id_a] |= flag_destroyed;
+        this->destroyed.push_back(id_a);
+        this->bodies_count--;
+    }
+    /// @brief Sets new bounds of the body, displacement_a is the expected move in the next step and stretches its fat box.
+    void move(Id id_a, const Aabb& bounds_a, lx::math::Vector<float, 2u> displacement_a = {})
+    {
+        assert(0u == (this->flags[id_a] & flag_destroyed));
+
+        if (true == std::visit([&](auto& broadphase_a) { return broadphase_a.move(id_a, bounds_a, displacement_a); }, this->broadphase))
+        {
+            this->mark_moved(id_a);
+        }
+    }
+
+    /// @brief Finds the pairs of the bodies moved or created since the last update and drops the pairs which no longer overlap.
+    void update()
+    {
+        std::visit([&](auto& broadphase_a) { this->update(broadphase_a); }, this->broadphase);
+    }
+
+    /// @brief Calls function_a(id) for every body whose fat box overlaps bounds_a.
+    template<typename Function> void query(const Aabb& bounds_a, Function&& function_a)
     {
-        return {};
+        std::visit(
+            [&](auto& broadphase_a) {
+                broadphase_a.query(bounds_a, [&](std::uint32_t id_a) {
+                    if (0u == (this->flags[id_a] & flag_destroyed))
+                    {
+                        function_a(static_cast<Id>(id_a));
+                    }
+                });
+            },
+            this->broadphase);
     }
+
+    /// @brief Pairs of bodies whose fat boxes overlap as of the last update, the lower id first, in no particular order.
+    std::span<const Pair> get_pairs() const
+    {
+        return this->pairs;
+    }
+    const Aabb& get_fat_bounds(Id id_a) const
+    {
+        return std::visit([&](const auto& broadphase_a) -> const Aabb& { return broadphase_a.get_fat_aabb(id_a); }, this->broadphase);
+    }
+    std::size_t get_bodies_count() const
+    {
+        return this->bodies_count;
+    }
+    Broadphase get_broadphase() const
+    {
+        return true == std::holds_alternative<DynamicTree>(this->broadphase) ? Broadphase::tree : Broadphase::grid;
+    }
+
+private:
+    constexpr static std::uint8_t flag_moved = 0x1u;
+    constexpr static std::uint8_t flag_destroyed = 0x2u;
+
+    using Broadphases = std::variant<DynamicTree, SpatialHash>;
+
+    static Broadphases create_broadphase(const Properties& properties_a, lx::memory::Resource& resource_a)
+    {
+        if (Broadphase::tree == properties_a.broadphase)
+        {
+            return Broadphases(std::in_place_type<DynamicTree>, properties_a.margin, resource_a);
+        }
+
+        return Broadphases(std::in_place_type<SpatialHash>, properties_a.cell_size, properties_a.margin, resource_a);
+    }
+
+    // a step for the broadphase held, which is resolved once instead of for every body and pair
+    template<typename Broadphase_type> void update(Broadphase_type& broadphase_a)
+    {
+        // pairs of destroyed bodies go first, so their ids can be reused
+        if (false == this->destroyed.is_empty())
+        {
+            this->drop_pairs([&](const Pair& pair_a) {
+                return 0u != ((this->flags[pair_a.first] | this->flags[pair_a.second]) & flag_destroyed);
+            });
+
+            // the flag stays until the id is reused, a body created and destroyed since the last update is still in moved
+            for (const Id id : this->destroyed)
+            {
+                broadphase_a.destroy(id);
+            }
+
+            this->destroyed.clear();
+        }
+
+        // only the pairs of a body whose fat box changed can stop overlapping
+        this->drop_pairs([&](const Pair& pair_a) {
+            return 0u != ((this->flags[pair_a.first] | this->flags[pair_a.second]) & flag_moved) &&
+                   false == broadphase_a.get_fat_aabb(pair_a.first).overlaps(broadphase_a.get_fat_aabb(pair_a.second));
+        });
+
+        for (const Id id : this->moved)
+        {
+            if (0u != (this->flags[id] & flag_destroyed))
+            {
+                continue;
+            }
+
+            broadphase_a.query(broadphase_a.get_fat_aabb(id), [&](std::uint32_t other_a) {
+                // two moved bodies find each other twice, the pair is added by the query of the lower id
+                if (other_a == id || 0u != (this->flags[other_a] & flag_destroyed) ||
+                    (0u != (this->flags[other_a] & flag_moved) && other_a < id))
+                {
+                    return;
+                }
+
+                this->add_pair(std::min(id, other_a), std::max(id, other_a));
+            });
+        }
+
+        for (const Id id : this->moved)
+        {
+            this->flags[id] &= static_cast<std::uint8_t>(~flag_moved);
+        }
+
+        this->moved.clear();
+    }
+
+    static std::uint64_t get_key(Id first_a, Id second_a)
+    {
+        return (static_cast<std::uint64_t>(first_a) << 32u) | second_a;
+    }
+
+    void mark_moved(Id id_a)
+    {
+        if (0u == (this->flags[id_a] & flag_moved))
+        {
+            this->flags[id_a] |= flag_moved;
+            this->moved.push_back(id_a);
+        }
+    }
+    void add_pair(Id first_a, Id second_a)
+    {
+        if (true == this->pairs_by_key.try_emplace(get_key(first_a, second_a), static_cast<std::uint32_t>(this->pairs.get_length())))
+        {
+            this->pairs.push_back({ .first = first_a, .second = second_a });
+        }
+    }
+    // removes the pairs matching predicate_a, the last pair takes the place of a removed one
+    template<typename Predicate> void drop_pairs(Predicate&& predicate_a)
+    {
+        for (std::size_t i = 0u; i < this->pairs.get_length();)
+        {
+            const Pair pair = this->pairs[i];
+
+            if (false == predicate_a(pair))
+            {
+                i++;
+                continue;
+            }
+
+            this->pairs_by_key.erase(get_key(pair.first, pair.second));
+
+            const Pair last = this->pairs.get_back();
+            this->pairs.pop_back();
+
+            if (i < this->pairs.get_length())
+            {
+                this->pairs[i] = last;
+                *this->pairs_by_key.find(get_key(last.first, last.second)) = static_cast<std::uint32_t>(i);
+            }
+        }
+    }
+
+    Broadphases broadphase;
+
+    lx::containers::Vector<std::uint8_t, 0u, lx::memory::Allocator<std::uint8_t>> flags;
+    lx::containers::Vector<Id, 0u, lx::memory::Allocator<Id>> moved;
+    lx::containers::Vector<Id, 0u, lx::memory::Allocator<Id>> destroyed;
+    std::size_t bodies_count = 0u;
+
+    lx::containers::Vector<Pair, 0u, lx::memory::Allocator<Pair>> pairs;
+    lx::containers::FlatMap<std::uint64_t,
+                            std::uint32_t,
+                            lx::containers::Hash<std::uint64_t>,
+                            lx::containers::Equal<std::uint64_t>,
+                            lx::memory::Allocator<std::byte>>
+        pairs_by_key;
 };
-} // namespace lx::physics
\ No newline at end of file
+} // namespace lx::physics
@@ -0,0 +1,434 @@
+#pragma once
+
+/*
+ *   Name: log_record.hpp
+ *   Copyright (c) Mateusz Semegen and contributors. All rights reserved.
+ */
+
+// lx
+#include <lx/common/non_constructible.hpp>
+#include <lx/common/out.hpp>
+
+// std
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <format>
+#include <source_location>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <variant>
+
+namespace lx::utils {
+
+/// @brief Binary encoding of deferred log lines.
+/// A call site (kind, format string, source location) is a constant object, so a line is just the address of its site, a
+/// timestamp and the raw bytes of the arguments. Formatting happens later on the logger thread or offline from a binary log
+/// file, which starts with a header and holds site, record and text entries.
+class log_record : private lx::common::non_constructible
+{
+public:
+    enum class Arg : std::uint8_t
+    {
+        i64,
+        u64,
+        f64,
+        boolean,
+        character,
+        pointer,
+        string,
+        // appended, so the tags already stored in binary log files keep their values
+        f32
+    };
+
+    enum class Entry : std::uint8_t
+    {
+        site = 1u,
+        record = 2u,
+        text = 3u
+    };
+
+    struct Site
+    {
+        constexpr Site(std::uint64_t kind_a,
+                       std::string_view format_a,
+                       const std::source_location& location_a = std::source_location::current())
+            : kind(kind_a)
+            , format(format_a)
+            , file(location_a.file_name())
+            , line(location_a.line())
+            , column(location_a.column())
+        {
+        }
+
+        std::uint64_t kind;
+        std::string_view format;
+        std::string_view file;
+        std::uint32_t line;
+        std::uint32_t column;
+    };
+
+    constexpr static std::array<char, 6u> magic = { 'L', 'X', 'L', 'O', 'G', '\1' };
+    constexpr static std::size_t max_args_count = 16u;
+
+    template<typename Type> constexpr static bool is_encodable_v =
+        std::integral<std::remove_cvref_t<Type>> || std::floating_point<std::remove_cvref_t<Type>> ||
+        std::convertible_to<const Type&, std::string_view> || std::is_pointer_v<std::remove_cvref_t<Type>> ||
+        std::is_null_pointer_v<std::remove_cvref_t<Type>>;
+
+    template<typename... Args> static std::size_t get_encoded_size(const Args&... args_a)
+    {
+        return (get_arg_size(args_a) + ... + 0u);
+    }
+
+    /// @brief Writes tag and value of every argument to buffer_a, which must hold get_encoded_size(args_a...) bytes.
+    template<typename... Args> static std::byte* encode(std::byte* buffer_a, const Args&... args_a)
+    {
+        static_assert(sizeof...(Args) <= max_args_count);
+
+        ((buffer_a = encode_arg(buffer_a, args_a)), ...);
+        return buffer_a;
+    }
+
+    /// @brief Formats the encoded arguments with format_a. Only automatic or manual indexing and static format specs are
+    /// supported, as for a std::format call. Returns false when the payload or the format string is malformed.
+    template<typename Output_iterator>
+    static bool format_to(lx::common::out<Output_iterator> output_a, std::string_view format_a, std::span<const std::byte> payload_a)
+    {
+        std::array<Value, max_args_count> values;
+        std::size_t values_count = 0u;
+
+        while (false == payload_a.empty())
+        {
+            if (values_count == max_args_count || false == decode_arg(lx::common::out(payload_a), lx::common::out(values[values_count])))
+            {
+                return false;
+            }
+
+            values_count++;
+        }
+
+        std::size_t next_index = 0u;
+
+        for (std::size_t i = 0u; i < format_a.size(); i++)
+        {
+            const char c = format_a[i];
+
+            if (('{' == c || '}' == c) && i + 1u < format_a.size() && c == format_a[i + 1u])
+            {
+                *(*output_a)++ = c;
+                i++;
+                continue;
+            }
+
+            if ('{' != c)
+            {
+                *(*output_a)++ = c;
+                continue;
+            }
+
+            const std::size_t field_end = format_a.find('}', i);
+
+            if (std::string_view::npos == field_end)
+            {
+                return false;
+            }
+
+            std::string_view field = format_a.substr(i + 1u, field_end - i - 1u);
+            const std::size_t colon = field.find(':');
+            const std::string_view index = field.substr(0u, colon);
+
+            std::size_t value_index = next_index++;
+
+            if (false == index.empty())
+            {
+                value_index = 0u;
+
+                for (char digit : index)
+                {
+                    if (digit < '0' || digit > '9')
+                    {
+                        return false;
+                    }
+
+                    value_index = value_index * 10u + static_cast<std::size_t>(digit - '0');
+                }
+            }
+
+            if (value_index >= values_count)
+            {
+                return false;
+            }
+
+            // re-format a single replacement field: "{:spec}" with the decoded value as the only argument
+            std::array<char, 64u> single;
+            const std::string_view spec = std::string_view::npos != colon ? field.substr(colon) : std::string_view {};
+
+            if (spec.size() + 2u > single.size())
+            {
+                return false;
+            }
+
+            single[0] = '{';
+            std::ranges::copy(spec, single.data() + 1u);
+            single[spec.size() + 1u] = '}';
+
+            const std::string_view single_format { single.data(), spec.size() + 2u };
+
+            try
+            {
+                std::visit(
+                    [&](const auto& value_a) { *output_a = std::vformat_to(*output_a, single_format, std::make_format_args(value_a)); },
+                    values[value_index]);
+            }
+            catch (const std::format_error&)
+            {
+                return false;
+            }
+
+            i = field_end;
+        }
+
+        return true;
+    }
+
+    static std::int64_t to_nanoseconds(std::chrono::system_clock::time_point time_a)
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(time_a.time_since_epoch()).count();
+    }
+    static std::chrono::system_clock::time_point from_nanoseconds(std::int64_t nanoseconds_a)
+    {
+        return std::chrono::system_clock::time_point {
+            std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::nanoseconds { nanoseconds_a })
+        };
+    }
+
+    static void write_header(FILE* file_a)
+    {
+        std::fwrite(magic.data(), 1u, magic.size(), file_a);
+    }
+    static void write_site(FILE* file_a, const Site* site_a)
+    {
+        write_value(file_a, Entry::site);
+        write_value(file_a, reinterpret_cast<std::uint64_t>(site_a));
+        write_value(file_a, site_a->kind);
+        write_value(file_a, site_a->line);
+        write_value(file_a, site_a->column);
+        write_bytes(file_a, std::as_bytes(std::span { site_a->file }));
+        write_bytes(file_a, std::as_bytes(std::span { site_a->format }));
+    }
+    static void write_record(FILE* file_a,
+                             const Site* site_a,
+                             std::chrono::system_clock::time_point time_a,
+                             std::span<const std::byte> payload_a)
+    {
+        write_value(file_a, Entry::record);
+        write_value(file_a, reinterpret_cast<std::uint64_t>(site_a));
+        write_value(file_a, to_nanoseconds(time_a));
+        write_bytes(file_a, payload_a);
+    }
+    static void write_text(FILE* file_a, std::uint64_t kind_a, std::chrono::system_clock::time_point time_a, std::string_view text_a)
+    {
+        write_value(file_a, Entry::text);
+        write_value(file_a, kind_a);
+        write_value(file_a, to_nanoseconds(time_a));
+        write_bytes(file_a, std::as_bytes(std::span { text_a }));
+    }
+
+    static bool read_header(FILE* file_a)
+    {
+        std::array<char, magic.size()> header;
+        return header.size() == std::fread(header.data(), 1u, header.size(), file_a) && magic == header;
+    }
+    template<typename Type> static bool read_value(FILE* file_a, lx::common::out<Type> value_a)
+    {
+        return 1u == std::fread(&(*value_a), sizeof(Type), 1u, file_a);
+    }
+    static bool read_bytes(FILE* file_a, lx::common::out<std::string> bytes_a)
+    {
+        std::uint32_t size = 0u;
+
+        if (false == read_value(file_a, lx::common::out(size)))
+        {
+            return false;
+        }
+
+        bytes_a->resize(size);
+        return size == std::fread(bytes_a->data(), 1u, size, file_a);
+    }
+
+private:
+    using Value = std::variant<std::int64_t, std::uint64_t, float, double, bool, char, const void*, std::string_view>;
+
+    template<typename Type> static std::size_t get_arg_size(const Type& arg_a)
+    {
+        static_assert(is_encodable_v<Type>, "log argument type cannot be deferred");
+
+        if constexpr (std::same_as<Type, bool> || std::same_as<Type, char>)
+        {
+            return 1u + 1u;
+        }
+        else if constexpr (std::same_as<Type, float>)
+        {
+            return 1u + sizeof(float);
+        }
+        else if constexpr (std::integral<Type> || std::floating_point<Type>)
+        {
+            return 1u + sizeof(std::uint64_t);
+        }
+        else if constexpr (std::convertible_to<const Type&, std::string_view>)
+        {
+            return 1u + sizeof(std::uint32_t) + std::string_view { arg_a }.size();
+        }
+        else
+        {
+            return 1u + sizeof(std::uint64_t);
+        }
+    }
+
+    template<typename Type> static std::byte* encode_arg(std::byte* buffer_a, const Type& arg_a)
+    {
+        if constexpr (std::same_as<Type, bool>)
+        {
+            return encode_value(encode_value(buffer_a, Arg::boolean), static_cast<std::uint8_t>(arg_a));
+        }
+        else if constexpr (std::same_as<Type, char>)
+        {
+            return encode_value(encode_value(buffer_a, Arg::character), arg_a);
+        }
+        else if constexpr (std::signed_integral<Type>)
+        {
+            return encode_value(encode_value(buffer_a, Arg::i64), static_cast<std::int64_t>(arg_a));
+        }
+        else if constexpr (std::unsigned_integral<Type>)
+        {
+            return encode_value(encode_value(buffer_a, Arg::u64), static_cast<std::uint64_t>(arg_a));
+        }
+        else if constexpr (std::same_as<Type, float>)
+        {
+            return encode_value(encode_value(buffer_a, Arg::f32), arg_a);
+        }
+        else if constexpr (std::floating_point<Type>)
+        {
+            return encode_value(encode_value(buffer_a, Arg::f64), static_cast<double>(arg_a));
+        }
+        else if constexpr (std::convertible_to<const Type&, std::string_view>)
+        {
+            // the characters are copied, the argument may be gone by the time the line is formatted
+            const std::string_view string { arg_a };
+
+            buffer_a = encode_value(encode_value(buffer_a, Arg::string), static_cast<std::uint32_t>(string.size()));
+            std::memcpy(buffer_a, string.data(), string.size());
+
+            return buffer_a + string.size();
+        }
+        else
+        {
+            return encode_value(encode_value(buffer_a, Arg::pointer), reinterpret_cast<std::uint64_t>(static_cast<const void*>(arg_a)));
+        }
+    }
+
+    static bool decode_arg(lx::common::out<std::span<const std::byte>> payload_a, lx::common::out<Value> value_a)
+    {
+        Arg arg;
+
+        if (false == decode_value(payload_a, lx::common::out(arg)))
+        {
+            return false;
+        }
+
+        switch (arg)
+        {
+            case Arg::i64:
+                return decode_as<std::int64_t, std::int64_t>(payload_a, value_a);
+            case Arg::u64:
+                return decode_as<std::uint64_t, std::uint64_t>(payload_a, value_a);
+            case Arg::f32:
+                return decode_as<float, float>(payload_a, value_a);
+            case Arg::f64:
+                return decode_as<double, double>(payload_a, value_a);
+            case Arg::boolean:
+                return decode_as<std::uint8_t, bool>(payload_a, value_a);
+            case Arg::character:
+                return decode_as<char, char>(payload_a, value_a);
+            case Arg::pointer:
+            {
+                std::uint64_t pointer = 0u;
+
+                if (false == decode_value(payload_a, lx::common::out(pointer)))
+                {
+                    return false;
+                }
+
+                (*value_a) = reinterpret_cast<const void*>(static_cast<std::uintptr_t>(pointer));
+                return true;
+            }
+            case Arg::string:
+            {
+                std::uint32_t size = 0u;
+
+                if (false == decode_value(payload_a, lx::common::out(size)) || payload_a->size() < size)
+                {
+                    return false;
+                }
+
+                (*value_a) = std::string_view { reinterpret_cast<const char*>(payload_a->data()), size };
+                (*payload_a) = payload_a->subspan(size);
+
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    template<typename Encoded, typename Decoded>
+    static bool decode_as(lx::common::out<std::span<const std::byte>> payload_a, lx::common::out<Value> value_a)
+    {
+        Encoded encoded {};
+
+        if (false == decode_value(payload_a, lx::common::out(encoded)))
+        {
+            return false;
+        }
+
+        (*value_a) = static_cast<Decoded>(encoded);
+        return true;
+    }
+
+    template<typename Type> static std::byte* encode_value(std::byte* buffer_a, const Type& value_a)
+    {
+        std::memcpy(buffer_a, &value_a, sizeof(Type));
+        return buffer_a + sizeof(Type);
+    }
+    template<typename Type> static bool decode_value(lx::common::out<std::span<const std::byte>> payload_a, lx::common::out<Type> value_a)
+    {
+        if (payload_a->size() < sizeof(Type))
+        {
+            return false;
+        }
+
+        std::memcpy(&(*value_a), payload_a->data(), sizeof(Type));
+        (*payload_a) = payload_a->subspan(sizeof(Type));
+
+        return true;
+    }
+
+    template<typename Type> static void write_value(FILE* file_a, const Type& value_a)
+    {
+        std::fwrite(&value_a, sizeof(Type), 1u, file_a);
+    }
+    static void write_bytes(FILE* file_a, std::span<const std::byte> bytes_a)
+    {
+        write_value(file_a, static_cast<std::uint32_t>(bytes_a.size()));
+        std::fwrite(bytes_a.data(), 1u, bytes_a.size(), file_a);
+    }
+};
+} // namespace lx::utils
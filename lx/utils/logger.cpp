@@ -0,0 +1,380 @@
+/*
+ *   Name: logger.cpp
+ *   Copyright (c) Mateusz Semegen and contributors. All rights reserved.
+ */
+
+// this
+#include <lx/utils/logger.hpp>
+
+// lx
+#include <lx/common/out.hpp>
+#include <lx/containers/MpscRing.hpp>
+#include <lx/containers/String.hpp>
+#include <lx/containers/Vector.hpp>
+
+// std
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <print>
+#include <shared_mutex>
+#include <stop_token>
+#include <thread>
+#include <unordered_set>
+
+namespace lx::utils {
+using namespace lx::common;
+using namespace lx::containers;
+
+struct logger::Writer
+{
+    // a single line handed over to the writer thread: a formatted text or, when site is set, the encoded arguments of a
+    // deferred line. Data longer than the inline buffer is moved to the heap
+    struct Record
+    {
+        constexpr static std::size_t inline_data_capacity = 200u;
+
+        std::span<const std::byte> get_data() const
+        {
+            return { nullptr != this->heap_data ? this->heap_data : this->data, this->length };
+        }
+        std::string_view get_text() const
+        {
+            return { reinterpret_cast<const char*>(this->get_data().data()), this->length };
+        }
+
+        std::chrono::system_clock::time_point time;
+        const log_record::Site* site = nullptr;
+        Kind kind = Kind { 0x20u };
+        std::uint32_t length = 0u;
+        std::byte* heap_data = nullptr;
+        std::byte data[inline_data_capacity];
+    };
+
+    constexpr static std::size_t ring_capacity = 1024u;
+    constexpr static std::chrono::milliseconds flush_interval { 100 };
+
+    // "[file][line,column] message" of a deferred line into line_a
+    static void format(out<Vector<char>> line_a, const log_record::Site* site_a, std::span<const std::byte> data_a);
+
+    void run(std::stop_token stop_token_a);
+    void write(const Record& record_a);
+    void wake_up()
+    {
+        this->urgent.store(true, std::memory_order_relaxed);
+        this->wake.notify_one();
+    }
+
+    MpscRing<Record, ring_capacity> ring;
+
+    // writer thread only: sites already described in the binary log and scratch space for deferred lines
+    std::unordered_set<const log_record::Site*> written_sites;
+    Vector<char> line;
+
+    // tickets are taken before a record is pushed, so flushed >= ticket means the record is on disk
+    std::atomic<std::uint64_t> tickets = 0u;
+    std::atomic<std::uint64_t> flushed = 0u;
+    std::atomic<bool> urgent = false;
+
+    // held shared by the threads committing lines and exclusively while switching the mode, so no line is pushed after the
+    // writer thread was asked to stop and no line is written directly while the writer thread still drains the ring
+    std::shared_mutex mode_mutex;
+    std::atomic<Mode> mode = Mode::sync;
+    std::mutex mutex;
+    std::condition_variable_any wake;
+    std::jthread thread;
+};
+
+logger::Writer logger::writer;
+
+void logger::Writer::run(std::stop_token stop_token_a)
+{
+    auto last_flush = std::chrono::steady_clock::now();
+    std::uint64_t written = this->flushed.load(std::memory_order_relaxed);
+
+    while (true)
+    {
+        // read before draining: everything pushed before the stop request is still written
+        const bool stopping = stop_token_a.stop_requested();
+        bool flush_now = true == stopping || true == this->urgent.exchange(false, std::memory_order_relaxed);
+
+        Record record;
+        while (true == this->ring.try_pop(out(record)))
+        {
+            this->write(record);
+            delete[] record.heap_data;
+
+            flush_now = flush_now || Kind::err == record.kind || Kind::omg == record.kind;
+            written++;
+        }
+
+        const auto now = std::chrono::steady_clock::now();
+
+        if (written != this->flushed.load(std::memory_order_relaxed) && (true == flush_now || now - last_flush >= flush_interval))
+        {
+            fflush(logger::file);
+            if (true == logger::console)
+            {
+                fflush(stdout);
+            }
+
+            this->flushed.store(written, std::memory_order_release);
+            last_flush = now;
+        }
+
+        if (true == stopping)
+        {
+            break;
+        }
+
+        std::unique_lock lock(this->mutex);
+        this->wake.wait_for(lock, stop_token_a, flush_interval, [this]() {
+            return true == this->urgent.load(std::memory_order_relaxed) || this->ring.get_length() >= ring_capacity / 2u;
+        });
+    }
+}
+
+void logger::Writer::write(const Record& record_a)
+{
+    const bool binary = Mode::binary == this->mode.load(std::memory_order_relaxed);
+
+    if (nullptr == record_a.site)
+    {
+        if (true == binary)
+        {
+            log_record::write_text(logger::file, static_cast<std::uint64_t>(record_a.kind), record_a.time, record_a.get_text());
+        }
+        else
+        {
+            logger::write(record_a.kind, record_a.time, record_a.get_text());
+        }
+    }
+    else if (true == binary)
+    {
+        if (true == this->written_sites.insert(record_a.site).second)
+        {
+            log_record::write_site(logger::file, record_a.site);
+        }
+
+        log_record::write_record(logger::file, record_a.site, record_a.time, record_a.get_data());
+    }
+    else
+    {
+        format(out(this->line), record_a.site, record_a.get_data());
+        logger::write(record_a.kind, record_a.time, { this->line.get_buffer(), this->line.get_length() });
+    }
+}
+
+void logger::Writer::format(out<Vector<char>> line_a, const log_record::Site* site_a, std::span<const std::byte> data_a)
+{
+    line_a->clear();
+
+    auto output = std::back_inserter(*line_a);
+    std::format_to(output, "[{}][{},{}] ", site_a->file, site_a->line, site_a->column);
+
+    if (false == log_record::format_to(out(output), site_a->format, data_a))
+    {
+        std::format_to(output, "<malformed: \"{}\">", site_a->format);
+    }
+}
+
+void logger::set_mode(Mode mode_a)
+{
+    std::unique_lock lock(writer.mode_mutex);
+
+    if (mode_a == writer.mode.load(std::memory_order_relaxed))
+    {
+        return;
+    }
+
+    if (Mode::sync != writer.mode.load(std::memory_order_relaxed))
+    {
+        // every line was pushed before the lock was taken, the writer thread drains them all before it exits. The mode is
+        // switched only afterwards: the writer thread reads it for every line it drains
+        writer.thread.request_stop();
+        writer.thread.join();
+
+        writer.mode.store(Mode::sync, std::memory_order_release);
+    }
+
+    if (Mode::sync != mode_a)
+    {
+        if (Mode::binary == mode_a)
+        {
+            log_record::write_header(logger::file);
+            writer.written_sites.clear();
+        }
+
+        writer.mode.store(mode_a, std::memory_order_release);
+        writer.thread = std::jthread([](std::stop_token stop_token_a) { writer.run(stop_token_a); });
+    }
+}
+logger::Mode logger::get_mode()
+{
+    return writer.mode.load(std::memory_order_relaxed);
+}
+
+void logger::flush()
+{
+    if (Mode::sync != writer.mode.load(std::memory_order_acquire))
+    {
+        const std::uint64_t tickets = writer.tickets.load(std::memory_order_relaxed);
+
+        while (writer.flushed.load(std::memory_order_acquire) < tickets)
+        {
+            writer.wake_up();
+            std::this_thread::yield();
+        }
+    }
+    else
+    {
+        fflush(logger::file);
+        if (true == logger::console)
+        {
+            fflush(stdout);
+        }
+    }
+}
+
+void logger::Composer::begin(Kind kind_a, std::string_view file_a, std::uint32_t line_a, std::uint32_t column_a)
+{
+    if (static_cast<std::uint64_t>(kind_a) == (static_cast<std::uint64_t>(logger::kind) & static_cast<std::uint64_t>(kind_a)))
+    {
+        this->kind = kind_a;
+        this->time = std::chrono::system_clock::now();
+
+        this->line.resize(256u);
+        std::format_to(std::back_inserter(this->line), "[{}][{},{}] ", file_a, line_a, column_a);
+    }
+}
+void logger::Composer::end()
+{
+    if (static_cast<std::uint64_t>(this->kind) == (static_cast<std::uint64_t>(logger::kind) & static_cast<std::uint64_t>(this->kind)))
+    {
+        logger::commit(this->kind, this->time, nullptr, std::as_bytes(std::span { this->line.get_buffer(), this->line.get_length() }));
+
+        this->line.clear();
+        logger::format_arena.reset();
+    }
+}
+
+void logger::commit(Kind kind_a,
+                    std::chrono::system_clock::time_point time_a,
+                    const log_record::Site* site_a,
+                    std::span<const std::byte> data_a)
+{
+    std::shared_lock lock(writer.mode_mutex);
+
+    if (Mode::sync != writer.mode.load(std::memory_order_acquire))
+    {
+        Writer::Record record;
+        record.time = time_a;
+        record.site = site_a;
+        record.kind = kind_a;
+        record.length = static_cast<std::uint32_t>(data_a.size());
+
+        if (data_a.size() > Writer::Record::inline_data_capacity)
+        {
+            record.heap_data = new std::byte[data_a.size()];
+            std::memcpy(record.heap_data, data_a.data(), data_a.size());
+        }
+        else
+        {
+            std::memcpy(record.data, data_a.data(), data_a.size());
+        }
+
+        writer.tickets.fetch_add(1u, std::memory_order_relaxed);
+
+        while (false == writer.ring.try_push(record))
+        {
+            // never drop a line: let the writer catch up
+            writer.wake_up();
+            std::this_thread::yield();
+        }
+
+        if (Kind::err == kind_a)
+        {
+            writer.wake_up();
+        }
+        else if (Kind::omg == kind_a)
+        {
+            // the process is likely about to go down, make sure the line reaches the file
+            logger::flush();
+        }
+    }
+    else if (nullptr != site_a)
+    {
+        // the line was encoded before another thread left async mode
+        thread_local Vector<char> line;
+
+        Writer::format(out(line), site_a, data_a);
+        logger::write(kind_a, time_a, { line.get_buffer(), line.get_length() });
+        logger::flush();
+    }
+    else
+    {
+        logger::write(kind_a, time_a, { reinterpret_cast<const char*>(data_a.data()), data_a.size() });
+        logger::flush();
+    }
+}
+
+void logger::write(Kind kind_a, std::chrono::system_clock::time_point time_a, std::string_view line_a)
+{
+    // formatting the local time is expensive, it changes once per second
+    thread_local std::chrono::sys_seconds timestamp_seconds {};
+    thread_local String<char, 34u> timestamp;
+
+    const auto seconds = std::chrono::floor<std::chrono::seconds>(time_a);
+
+    if (seconds != timestamp_seconds)
+    {
+        auto local_time = std::chrono::zoned_time { std::chrono::current_zone(), seconds };
+
+        timestamp.reserve(21u);
+        std::format_to(timestamp.get_buffer(), "[{:%H:%M:%S %d.%m.%Y}]", local_time);
+        timestamp_seconds = seconds;
+    }
+
+    logger::log(timestamp);
+
+    switch (kind_a)
+    {
+        case Kind::inf:
+            logger::log("[inf]");
+            break;
+        case Kind::wrn:
+            logger::log("[wrn]");
+            break;
+        case Kind::err:
+            logger::log("[err]");
+            break;
+        case Kind::omg:
+            logger::log("[omg]");
+            break;
+        case Kind::dbg:
+            logger::log("[dbg]");
+            break;
+    }
+
+    logger::log(line_a);
+    logger::log("\n");
+}
+
+void logger::set_output(FILE* file_a, bool console_a)
+{
+    logger::file = file_a;
+    logger::console = console_a;
+}
+
+void logger::log(std::string_view log_a)
+{
+    std::print(logger::file, "{}", log_a);
+
+    if (true == logger::console)
+    {
+        std::print(stdout, "{}", log_a);
+    }
+}
+} // namespace lx::utils
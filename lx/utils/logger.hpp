@@ -3,16 +3,38 @@
 // lx
 #include <lx/common/non_constructible.hpp>
 #include <lx/containers/String.hpp>
+#include <lx/containers/Vector.hpp>
+#include <lx/memory/Allocator.hpp>
+#include <lx/memory/Arena.hpp>
+#include <lx/utils/log_record.hpp>
 
 // std
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <cstdio>
+#include <format>
+#include <iterator>
 #include <print>
 #include <source_location>
 #include <string_view>
 
+// lines of a kind below LX_LOG_LEVEL are compiled out: neither the arguments nor the call site are evaluated
+#define LX_LOG_LEVEL_DBG 0
+#define LX_LOG_LEVEL_INF 1
+#define LX_LOG_LEVEL_WRN 2
+#define LX_LOG_LEVEL_ERR 3
+#define LX_LOG_LEVEL_OMG 4
+#define LX_LOG_LEVEL_NONE 5
+
+#if !defined(LX_LOG_LEVEL)
+#if defined(NDEBUG)
+#define LX_LOG_LEVEL LX_LOG_LEVEL_INF
+#else
+#define LX_LOG_LEVEL LX_LOG_LEVEL_DBG
+#endif
+#endif
+
 namespace lx::utils {
 class logger : private lx::common::non_constructible
 {
@@ -28,10 +50,22 @@ public:
 
     using enum Kind;
 
+    /// @brief In sync mode lines are written and flushed by the calling thread. In async mode lines are pushed to a lock-free
+    /// ring and a background thread writes them in batches, flushing on a timer or right after an err/omg line. Lines logged
+    /// through the log_* macros are not formatted by the caller in async mode: only the arguments are copied and the writer
+    /// formats them. Binary mode works as async, but the writer stores the lines unformatted (see log_record), the log file
+    /// has to be opened in binary mode and turned into text with the log_decoder tool.
+    enum class Mode : std::uint8_t
+    {
+        sync,
+        async,
+        binary
+    };
+
 private:
     struct Composer
     {
-        void begin(Kind kind_a, const std::source_location& source_location_a);
+        void begin(Kind kind_a, std::string_view file_a, std::uint32_t line_a, std::uint32_t column_a);
         void end();
 
         template<typename... Args> void message(std::string_view format_a, Args... args_a)
@@ -39,13 +73,17 @@ private:
             if (static_cast<std::uint64_t>(this->kind) ==
                 (static_cast<std::uint64_t>(logger::kind) & static_cast<std::uint64_t>(this->kind)))
             {
-                const std::string message = std::vformat(std::locale {}, format_a.data(), std::make_format_args(args_a...));
-                logger::log(message);
+                this->line.resize(this->line.get_length() + format_a.size() * 2u);
+                std::vformat_to(std::back_inserter(this->line), std::locale {}, format_a, std::make_format_args(args_a...));
             }
         }
 
     private:
         Kind kind = Kind { 0x20u };
+        std::chrono::system_clock::time_point time;
+
+        // "[file][line,column] message" without the header, allocated from format_arena
+        containers::Vector<char, 0u, memory::Allocator<char>> line { logger::format_arena };
     };
 
 public:
@@ -62,22 +100,87 @@ public:
         return static_cast<std::uint64_t>(kind_a) == (static_cast<std::uint64_t>(kind) & static_cast<std::uint64_t>(kind_a));
     }
 
+    /// @brief Tells whether lines of kind_a are compiled in at all, see LX_LOG_LEVEL.
+    constexpr static bool is_compiled(Kind kind_a)
+    {
+        return static_cast<std::uint64_t>(kind_a) == (static_cast<std::uint64_t>(compiled_kinds) & static_cast<std::uint64_t>(kind_a));
+    }
+
+    /// @brief Sets the file lines are written to, optionally echoed to stdout. Has to be called before the first line.
+    static void set_output(FILE* file_a, bool console_a);
+
+    /// @brief Switches the logging mode, waiting for the lines being committed by other threads. Leaving async or binary mode
+    /// drains the ring and joins the writer thread, the lines committed afterwards are written in the new mode. Binary mode
+    /// writes the log file header, so it has to be set before the first line and kept until the file is closed.
+    static void set_mode(Mode mode_a);
+    static Mode get_mode();
+
+    /// @brief Blocks until every line logged so far is written and flushed.
+    static void flush();
+
     template<typename... Args>
     static void write_line(Kind kind_a, const std::source_location& source_location_a, std::string_view message_a, Args... args_a)
     {
         Composer c;
 
-        c.begin(kind_a, source_location_a);
+        c.begin(kind_a, source_location_a.file_name(), source_location_a.line(), source_location_a.column());
         c.message(message_a, args_a...);
         c.end();
     }
 
-    inline static Composer composer;
+    /// @brief Logs a line from a constant call site, used by the log_* macros. Outside of sync mode the arguments are only
+    /// encoded and formatting is left to the writer thread.
+    template<typename... Args> static void write_line(const log_record::Site& site_a, Args... args_a)
+    {
+        const Kind site_kind = static_cast<Kind>(site_a.kind);
+
+        if constexpr (((true == log_record::is_encodable_v<Args>) && ...))
+        {
+            if (Mode::sync != get_mode() && true == is_filter(site_kind))
+            {
+                std::byte* payload = static_cast<std::byte*>(format_arena.allocate(log_record::get_encoded_size(args_a...), 1u));
+                std::byte* payload_end = log_record::encode(payload, args_a...);
+
+                commit(site_kind, std::chrono::system_clock::now(), &site_a, { payload, payload_end });
+                format_arena.reset();
+
+                return;
+            }
+        }
+
+        Composer c;
+
+        c.begin(site_kind, site_a.file, site_a.line, site_a.column);
+        c.message(site_a.format, args_a...);
+        c.end();
+    }
 
 private:
     static void log(std::string_view log_a);
+    static void commit(Kind kind_a,
+                       std::chrono::system_clock::time_point time_a,
+                       const log_record::Site* site_a,
+                       std::span<const std::byte> data_a);
+    static void write(Kind kind_a, std::chrono::system_clock::time_point time_a, std::string_view line_a);
 
     inline static Kind kind = Kind { 0x1Fu };
+
+    inline static FILE* file = nullptr;
+    inline static bool console = false;
+
+    // kinds at or above LX_LOG_LEVEL, ordered dbg < inf < wrn < err < omg
+    constexpr static Kind compiled_kinds = Kind { (LX_LOG_LEVEL <= LX_LOG_LEVEL_DBG ? 0x10u : 0x0u) |
+                                                  (LX_LOG_LEVEL <= LX_LOG_LEVEL_INF ? 0x1u : 0x0u) |
+                                                  (LX_LOG_LEVEL <= LX_LOG_LEVEL_WRN ? 0x2u : 0x0u) |
+                                                  (LX_LOG_LEVEL <= LX_LOG_LEVEL_ERR ? 0x4u : 0x0u) |
+                                                  (LX_LOG_LEVEL <= LX_LOG_LEVEL_OMG ? 0x8u : 0x0u) };
+
+    // scratch memory for formatting a single line, reset by Composer::end
+    inline static thread_local memory::Arena format_arena { 4096u };
+
+    // ring and background thread of the async mode, defined next to the logger implementation
+    struct Writer;
+    static Writer writer;
 };
 
 constexpr logger::Kind operator|(logger::Kind left_a, logger::Kind right_a)
@@ -100,14 +203,29 @@ constexpr logger::Kind operator&=(logger::Kind& left_a, logger::Kind right_a)
 }
 } // namespace lx::utils
 
+// a constant call site: kind, format string and source location are captured once, at compile time
+#define lx_log_site(kind_a, message_a)                                                                                        \
+    []() -> const lx::utils::log_record::Site& {                                                                              \
+        static constexpr lx::utils::log_record::Site site { static_cast<std::uint64_t>(kind_a), message_a };                  \
+        return site;                                                                                                          \
+    }()
+
+// the compile time level and the runtime filter are both checked before any argument is evaluated
+#define lx_log_write(kind_a, message_a, ...)                                                                                  \
+    do                                                                                                                        \
+    {                                                                                                                         \
+        if constexpr (true == lx::utils::logger::is_compiled(kind_a))                                                         \
+        {                                                                                                                     \
+            if (true == lx::utils::logger::is_filter(kind_a))                                                                 \
+            {                                                                                                                 \
+                lx::utils::logger::write_line(lx_log_site(kind_a, message_a), __VA_ARGS__);                                   \
+            }                                                                                                                 \
+        }                                                                                                                     \
+    } while (false)
+
 #define log_set_filter(kind_a) lx::utils::logger::set_filter(kind_a);
-#define log_inf(message_a, ...) \
-    lx::utils::logger::write_line(lx::utils::logger::inf, std::source_location::current(), message_a, __VA_ARGS__)
-#define log_wrn(message_a, ...) \
-    lx::utils::logger::write_line(lx::utils::logger::wrn, std::source_location::current(), message_a, __VA_ARGS__)
-#define log_err(message_a, ...) \
-    lx::utils::logger::write_line(lx::utils::logger::err, std::source_location::current(), message_a, __VA_ARGS__)
-#define log_omg(message_a, ...) \
-    lx::utils::logger::write_line(lx::utils::logger::omg, std::source_location::current(), message_a, __VA_ARGS__)
-#define log_dbg(message_a, ...) \
-    lx::utils::logger::write_line(lx::utils::logger::dbg, std::source_location::current(), message_a, __VA_ARGS__)
\ No newline at end of file
+#define log_inf(message_a, ...) lx_log_write(lx::utils::logger::inf, message_a, __VA_ARGS__)
+#define log_wrn(message_a, ...) lx_log_write(lx::utils::logger::wrn, message_a, __VA_ARGS__)
+#define log_err(message_a, ...) lx_log_write(lx::utils::logger::err, message_a, __VA_ARGS__)
+#define log_omg(message_a, ...) lx_log_write(lx::utils::logger::omg, message_a, __VA_ARGS__)
+#define log_dbg(message_a, ...) lx_log_write(lx::utils::logger::dbg, message_a, __VA_ARGS__)
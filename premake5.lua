@@ -100,4 +100,67 @@ project "tests"
       defines { "NDEBUG", "LX_AMD64", "VK_USE_PLATFORM_WIN32_KHR", "VK_NO_PROTOTYPES", "CATCH_AMALGAMATED_CUSTOM_MAIN" }
       optimize "On"
       targetname "tests"
-      buildoptions { "/W4" }
\ No newline at end of file
+      buildoptions { "/W4" }
+
+project "benchmarks"
+   kind "ConsoleApp"
+   architecture "x64"
+   language "C++"
+   cppdialect "C++23"
+   location "benchmarks"
+   targetdir "output/benchmarks"
+   objdir "output/benchmarks"
+   dependson { "lx" }
+   warnings "Extra"
+   characterset "MBCS"
+
+   includedirs { ".", "tests/externals/Catch2/src/" }
+   libdirs { "output/lx/" }
+   files { "benchmarks/**.hpp", "benchmarks/**.cpp", "tests/externals/**" }
+   vpaths {
+       ["**"] = { "benchmarks/**.hpp", "benchmarks/**.cpp", "tests/externals/**.cpp", "tests/externals/**.hpp" }
+   }
+
+   -- only Release numbers are meaningful, run with "[!benchmark]" --reporter JSON::out=benchmarks.json
+   filter "configurations:Debug Windows"
+      defines { "DEBUG", "LX_AMD64", "LX_ASSERTION", "VK_USE_PLATFORM_WIN32_KHR", "VK_NO_PROTOTYPES", "CATCH_AMALGAMATED_CUSTOM_MAIN" }
+      symbols "On"
+      links { "lx_d.lib" }
+      targetname "benchmarks_d"
+      buildoptions { "/W4" }
+
+   filter "configurations:Release Windows"
+      defines { "NDEBUG", "LX_AMD64", "VK_USE_PLATFORM_WIN32_KHR", "VK_NO_PROTOTYPES", "CATCH_AMALGAMATED_CUSTOM_MAIN" }
+      optimize "On"
+      links { "lx.lib" }
+      targetname "benchmarks"
+      buildoptions { "/W4" }
+
+project "log_decoder"
+   kind "ConsoleApp"
+   architecture "x64"
+   language "C++"
+   cppdialect "C++23"
+   location "tools/log_decoder"
+   targetdir "output/tools"
+   objdir "output/tools/log_decoder"
+   warnings "Extra"
+   characterset "MBCS"
+
+   includedirs { "." }
+   files { "tools/log_decoder/**.hpp", "tools/log_decoder/**.cpp" }
+   vpaths {
+       ["**"] = { "tools/log_decoder/**.hpp", "tools/log_decoder/**.cpp" }
+   }
+
+   filter "configurations:Debug Windows"
+      defines { "DEBUG", "LX_AMD64", "LX_ASSERTION" }
+      symbols "On"
+      targetname "log_decoder_d"
+      buildoptions { "/W4" }
+
+   filter "configurations:Release Windows"
+      defines { "NDEBUG", "LX_AMD64" }
+      optimize "On"
+      targetname "log_decoder"
+      buildoptions { "/W4" }
@@ -31,7 +31,9 @@
 #    error Cannot force ANDROID_LOGWRITE to both ON and OFF
 #endif
 
+#if defined( _WIN32 )
 #define CATCH_CONFIG_COLOUR_WIN32
+#endif
 
 #if defined( CATCH_CONFIG_COLOUR_WIN32 ) && \
     defined( CATCH_CONFIG_NO_COLOUR_WIN32 )
@@ -146,7 +148,9 @@
 
 
 
+#if defined( _WIN32 )
 #define CATCH_CONFIG_WINDOWS_SEH
+#endif
 
 #if defined( CATCH_CONFIG_WINDOWS_SEH ) && \
     defined( CATCH_CONFIG_NO_WINDOWS_SEH )
@@ -191,7 +195,9 @@
 //#cmakedefine CATCH_CONFIG_NOSTDOUT
 //#cmakedefine CATCH_CONFIG_PREFIX_ALL
 //#cmakedefine CATCH_CONFIG_PREFIX_MESSAGES
+#if defined( _WIN32 )
 #define CATCH_CONFIG_WINDOWS_CRTDBG
+#endif
 
 //#cmakedefine CATCH_CONFIG_SHARED_LIBRARY
 
@@ -0,0 +1,223 @@
+// external
+#include <catch2/catch_test_macros.hpp>
+
+// lx
+#include <lx/containers/FlatMap.hpp>
+#include <lx/containers/String.hpp>
+#include <lx/containers/StringId.hpp>
+#include <lx/memory/Allocator.hpp>
+#include <lx/memory/Resource.hpp>
+
+// std
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
+TEST_CASE("FlatMap: insertion and lookup", "[lx][containers][FlatMap]")
+{
+    using namespace lx::containers;
+
+    SECTION("Empty map finds nothing")
+    {
+        FlatMap<std::uint32_t, std::uint32_t> map;
+
+        REQUIRE(true == map.is_empty());
+        REQUIRE(0u == map.get_capacity());
+        REQUIRE(nullptr == map.find(1u));
+        REQUIRE(false == map.erase(1u));
+        REQUIRE(map.begin() == map.end());
+    }
+
+    SECTION("try_emplace adds only missing keys")
+    {
+        FlatMap<std::uint32_t, std::uint32_t> map;
+
+        REQUIRE(true == map.try_emplace(1u, 10u));
+        REQUIRE(false == map.try_emplace(1u, 20u));
+        REQUIRE(1u == map.get_length());
+        REQUIRE(10u == *map.find(1u));
+
+        map[2u] = 30u;
+        map[2u] += 1u;
+
+        REQUIRE(31u == *map.find(2u));
+        REQUIRE(0u == map[3u]);
+        REQUIRE(3u == map.get_length());
+    }
+
+    SECTION("Growth keeps every entry")
+    {
+        FlatMap<std::uint32_t, std::uint32_t> map;
+
+        // multiples of a large power of two collide in the low bits of an identity hash
+        for (std::uint32_t i = 0u; i < 10000u; i++)
+        {
+            map.try_emplace(i << 16u, i);
+        }
+
+        REQUIRE(10000u == map.get_length());
+        REQUIRE(map.get_length() <= map.get_capacity() - map.get_capacity() / 8u);
+
+        for (std::uint32_t i = 0u; i < 10000u; i++)
+        {
+            REQUIRE(nullptr != map.find(i << 16u));
+            REQUIRE(i == *map.find(i << 16u));
+        }
+
+        REQUIRE(nullptr == map.find(1u));
+    }
+
+    SECTION("reserve allocates once")
+    {
+        FlatMap<std::uint32_t, std::uint32_t> map;
+        map.reserve(1000u);
+
+        const std::size_t capacity = map.get_capacity();
+
+        for (std::uint32_t i = 0u; i < 1000u; i++)
+        {
+            map[i] = i;
+        }
+
+        REQUIRE(capacity == map.get_capacity());
+    }
+}
+TEST_CASE("FlatMap: erase", "[lx][containers][FlatMap]")
+{
+    using namespace lx::containers;
+
+    FlatMap<std::uint32_t, std::string> map;
+    std::unordered_map<std::uint32_t, std::string> reference;
+
+    // churn against std::unordered_map: tombstones pile up and get dropped by rehashes
+    std::uint32_t state = 12345u;
+
+    for (std::size_t i = 0u; i < 50000u; i++)
+    {
+        state = state * 1664525u + 1013904223u;
+        const std::uint32_t key = (state >> 8u) % 512u;
+
+        if (0u != (state & 0x80000000u))
+        {
+            REQUIRE(reference.try_emplace(key, std::to_string(key)).second == map.try_emplace(key, std::to_string(key)));
+        }
+        else
+        {
+            REQUIRE((1u == reference.erase(key)) == map.erase(key));
+        }
+    }
+
+    REQUIRE(reference.size() == map.get_length());
+    REQUIRE(map.get_capacity() <= 1024u);
+
+    std::size_t visited = 0u;
+
+    for (const auto& entry : map)
+    {
+        REQUIRE(reference.at(entry.key) == entry.value);
+        visited++;
+    }
+
+    REQUIRE(reference.size() == visited);
+
+    map.clear();
+
+    REQUIRE(true == map.is_empty());
+    REQUIRE(map.begin() == map.end());
+}
+TEST_CASE("FlatMap: heterogeneous lookup", "[lx][containers][FlatMap]")
+{
+    using namespace lx::containers;
+    using namespace lx::containers::literals;
+
+    SECTION("String keys looked up by string_view")
+    {
+        FlatMap<std::string, int> map;
+
+        map["textures/grass.png"] = 1;
+        map.try_emplace(std::string_view { "textures/stone.png" }, 2);
+
+        REQUIRE(1 == *map.find(std::string_view { "textures/grass.png" }));
+        REQUIRE(2 == *map.find("textures/stone.png"));
+        REQUIRE(false == map.contains("textures/water.png"));
+        REQUIRE(true == map.erase(std::string_view { "textures/grass.png" }));
+        REQUIRE(1u == map.get_length());
+    }
+
+    SECTION("lx String keys")
+    {
+        FlatMap<String<char>, int> map;
+
+        map[std::string_view { "a name longer than the local buffer of String" }] = 1;
+        map[std::string_view { "short" }] = 2;
+
+        REQUIRE(1 == *map.find(std::string_view { "a name longer than the local buffer of String" }));
+        REQUIRE(2 == *map.find(std::string_view { "short" }));
+    }
+
+    SECTION("StringId keys looked up by name")
+    {
+        FlatMap<StringId, int> map;
+
+        map["position"_id] = 1;
+        map.try_emplace("velocity"_id, 2);
+
+        REQUIRE(1 == *map.find("position"_id));
+        REQUIRE(1 == *map.find(std::string_view { "position" }));
+        REQUIRE(2 == *map.find(std::string_view { "velocity" }));
+        REQUIRE(nullptr == map.find(std::string_view { "mass" }));
+    }
+}
+TEST_CASE("FlatMap: copies, moves and allocators", "[lx][containers][FlatMap]")
+{
+    using namespace lx::containers;
+    using namespace lx::memory;
+
+    SECTION("Copies and moves keep the entries")
+    {
+        FlatMap<std::uint32_t, std::string> map;
+
+        for (std::uint32_t i = 0u; i < 100u; i++)
+        {
+            map[i] = std::to_string(i);
+        }
+
+        FlatMap<std::uint32_t, std::string> copy(map);
+        FlatMap<std::uint32_t, std::string> moved(std::move(map));
+
+        REQUIRE(true == map.is_empty());
+        REQUIRE(100u == copy.get_length());
+        REQUIRE("42" == *copy.find(42u));
+        REQUIRE("42" == *moved.find(42u));
+
+        map = copy;
+        REQUIRE("99" == *map.find(99u));
+
+        copy = std::move(moved);
+        REQUIRE("7" == *copy.find(7u));
+        REQUIRE(true == moved.is_empty());
+    }
+
+    SECTION("Allocates from the given resource")
+    {
+        Heap heap("test");
+
+        {
+            FlatMap<std::uint32_t, std::uint32_t, Hash<std::uint32_t>, Equal<std::uint32_t>, Allocator<std::byte>> map(heap);
+
+            for (std::uint32_t i = 0u; i < 100u; i++)
+            {
+                map[i] = i;
+            }
+
+            REQUIRE(heap.get_size() > 0u);
+            REQUIRE(99u == *map.find(99u));
+        }
+
+        REQUIRE(0u == heap.get_size());
+    }
+}
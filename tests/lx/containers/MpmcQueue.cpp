@@ -0,0 +1,223 @@
+// external
+#include <catch2/catch_test_macros.hpp>
+
+// lx
+#include <lx/common/out.hpp>
+#include <lx/containers/MpmcQueue.hpp>
+#include <lx/memory/Allocator.hpp>
+#include <lx/memory/Resource.hpp>
+
+// std
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST_CASE("MpmcQueue<T>: push/pop", "[lx][containers][MpmcQueue<T>]")
+{
+    using namespace lx::common;
+    using namespace lx::containers;
+
+    SECTION("Empty queue pops nothing")
+    {
+        MpmcQueue<std::uint32_t> queue(4u);
+        std::uint32_t value = 0u;
+
+        REQUIRE(true == queue.is_empty());
+        REQUIRE(4u == queue.get_capacity());
+        REQUIRE(false == queue.try_pop(out(value)));
+    }
+
+    SECTION("Values are popped in push order")
+    {
+        MpmcQueue<std::string> queue(4u);
+
+        REQUIRE(true == queue.try_push("a"));
+        REQUIRE(true == queue.try_push("b"));
+        REQUIRE(true == queue.try_emplace(3u, 'c'));
+        REQUIRE(3u == queue.get_length());
+
+        std::string value;
+
+        REQUIRE(true == queue.try_pop(out(value)));
+        REQUIRE("a" == value);
+        REQUIRE(true == queue.try_pop(out(value)));
+        REQUIRE("b" == value);
+        REQUIRE(true == queue.try_pop(out(value)));
+        REQUIRE("ccc" == value);
+        REQUIRE(false == queue.try_pop(out(value)));
+    }
+
+    SECTION("Push fails when the queue is full and succeeds again after a pop")
+    {
+        MpmcQueue<std::uint32_t> queue(2u);
+        std::uint32_t value = 0u;
+
+        REQUIRE(true == queue.try_push(1u));
+        REQUIRE(true == queue.try_push(2u));
+        REQUIRE(false == queue.try_push(3u));
+
+        REQUIRE(true == queue.try_pop(out(value)));
+        REQUIRE(1u == value);
+        REQUIRE(true == queue.try_push(3u));
+
+        REQUIRE(true == queue.try_pop(out(value)));
+        REQUIRE(2u == value);
+        REQUIRE(true == queue.try_pop(out(value)));
+        REQUIRE(3u == value);
+    }
+
+    SECTION("Batches are cut to the free and the ready cells")
+    {
+        MpmcQueue<std::uint32_t> queue(4u);
+        const std::array<std::uint32_t, 3u> values { 1u, 2u, 3u };
+        std::array<std::uint32_t, 4u> popped {};
+
+        REQUIRE(3u == queue.try_push(std::span<const std::uint32_t> { values }));
+        REQUIRE(1u == queue.try_push(std::span<const std::uint32_t> { values }));
+        REQUIRE(0u == queue.try_push(std::span<const std::uint32_t> { values }));
+
+        REQUIRE(2u == queue.try_pop(std::span<std::uint32_t> { popped.data(), 2u }));
+        REQUIRE(2u == queue.try_push(std::span<const std::uint32_t> { values }));
+        REQUIRE(4u == queue.try_pop(std::span<std::uint32_t> { popped }));
+        REQUIRE(std::array<std::uint32_t, 4u> { 3u, 1u, 1u, 2u } == popped);
+        REQUIRE(0u == queue.try_pop(std::span<std::uint32_t> { popped }));
+    }
+
+    SECTION("Values left in the queue are destroyed with it")
+    {
+        auto counter = std::make_shared<int>(0);
+
+        {
+            MpmcQueue<std::shared_ptr<int>> queue(4u);
+
+            queue.try_push(counter);
+            queue.try_push(counter);
+            REQUIRE(3 == counter.use_count());
+        }
+
+        REQUIRE(1 == counter.use_count());
+    }
+
+    SECTION("Allocates from the given resource")
+    {
+        lx::memory::Heap heap("test");
+
+        {
+            MpmcQueue<std::uint64_t, lx::memory::Allocator<std::uint64_t>> queue(64u, heap);
+
+            REQUIRE(heap.get_size() > 0u);
+            REQUIRE(true == queue.try_push(1u));
+        }
+
+        REQUIRE(0u == heap.get_size());
+    }
+}
+
+TEST_CASE("MpmcQueue<T>: concurrency", "[lx][containers][MpmcQueue<T>]")
+{
+    using namespace lx::common;
+    using namespace lx::containers;
+
+    SECTION("Every value pushed by concurrent producers is popped exactly once by concurrent consumers")
+    {
+        constexpr std::uint32_t producers_count = 4u;
+        constexpr std::uint32_t consumers_count = 4u;
+        constexpr std::uint32_t values_count = 20000u;
+
+        MpmcQueue<std::uint32_t> queue(64u);
+        std::atomic<std::uint32_t> popped_count = 0u;
+        std::vector<std::thread> threads;
+        std::vector<std::vector<std::uint32_t>> popped(consumers_count);
+
+        for (std::uint32_t producer = 0u; producer < producers_count; producer++)
+        {
+            threads.emplace_back([&queue, producer]() {
+                std::array<std::uint32_t, 4u> batch {};
+
+                for (std::uint32_t i = 0u; i < values_count;)
+                {
+                    std::uint32_t pushed = 0u;
+
+                    if (0u == producer % 2u)
+                    {
+                        pushed = true == queue.try_push((producer << 24u) | i) ? 1u : 0u;
+                    }
+                    else
+                    {
+                        std::uint32_t count = 0u;
+
+                        for (; count < batch.size() && i + count < values_count; count++)
+                        {
+                            batch[count] = (producer << 24u) | (i + count);
+                        }
+
+                        pushed = static_cast<std::uint32_t>(queue.try_push(std::span<const std::uint32_t> { batch.data(), count }));
+                    }
+
+                    if (0u == pushed)
+                    {
+                        std::this_thread::yield();
+                    }
+
+                    i += pushed;
+                }
+            });
+        }
+
+        for (std::uint32_t consumer = 0u; consumer < consumers_count; consumer++)
+        {
+            threads.emplace_back([&queue, &popped_count, &popped, consumer]() {
+                std::array<std::uint32_t, 3u> batch {};
+
+                while (popped_count.load(std::memory_order_relaxed) < producers_count * values_count)
+                {
+                    const std::size_t count = queue.try_pop(std::span<std::uint32_t> { batch.data(), 1u + consumer % batch.size() });
+
+                    if (0u == count)
+                    {
+                        std::this_thread::yield();
+                    }
+
+                    popped[consumer].insert(popped[consumer].end(), batch.begin(), batch.begin() + count);
+                    popped_count.fetch_add(static_cast<std::uint32_t>(count), std::memory_order_relaxed);
+                }
+            });
+        }
+
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        // each consumer sees the values of one producer in push order
+        std::vector<std::uint32_t> counts(producers_count, 0u);
+        bool ordered = true;
+
+        for (const std::vector<std::uint32_t>& values : popped)
+        {
+            std::vector<std::int64_t> last(producers_count, -1);
+
+            for (const std::uint32_t value : values)
+            {
+                const std::uint32_t producer = value >> 24u;
+
+                ordered = ordered && static_cast<std::int64_t>(value & 0xFFFFFFu) > last[producer];
+                last[producer] = value & 0xFFFFFFu;
+                counts[producer]++;
+            }
+        }
+
+        REQUIRE(true == ordered);
+        REQUIRE(true == queue.is_empty());
+
+        for (const std::uint32_t count : counts)
+        {
+            REQUIRE(values_count == count);
+        }
+    }
+}
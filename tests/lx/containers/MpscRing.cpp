@@ -0,0 +1,142 @@
+// external
+#include <catch2/catch_test_macros.hpp>
+
+// lx
+#include <lx/common/out.hpp>
+#include <lx/containers/MpscRing.hpp>
+
+// std
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST_CASE("MpscRing<T, N>: push/pop", "[lx][containers][MpscRing<T, N>]")
+{
+    using namespace lx::common;
+    using namespace lx::containers;
+
+    SECTION("Empty ring pops nothing")
+    {
+        MpscRing<std::uint32_t, 4u> ring;
+        std::uint32_t value = 0u;
+
+        REQUIRE(true == ring.is_empty());
+        REQUIRE(4u == ring.get_capacity());
+        REQUIRE(false == ring.try_pop(out(value)));
+    }
+
+    SECTION("Values are popped in push order")
+    {
+        MpscRing<std::string, 4u> ring;
+
+        REQUIRE(true == ring.try_push("a"));
+        REQUIRE(true == ring.try_push("b"));
+        REQUIRE(true == ring.try_emplace(3u, 'c'));
+        REQUIRE(3u == ring.get_length());
+
+        std::string value;
+
+        REQUIRE(true == ring.try_pop(out(value)));
+        REQUIRE("a" == value);
+        REQUIRE(true == ring.try_pop(out(value)));
+        REQUIRE("b" == value);
+        REQUIRE(true == ring.try_pop(out(value)));
+        REQUIRE("ccc" == value);
+        REQUIRE(false == ring.try_pop(out(value)));
+    }
+
+    SECTION("Push fails when the ring is full and succeeds again after a pop")
+    {
+        MpscRing<std::uint32_t, 2u> ring;
+        std::uint32_t value = 0u;
+
+        REQUIRE(true == ring.try_push(1u));
+        REQUIRE(true == ring.try_push(2u));
+        REQUIRE(false == ring.try_push(3u));
+
+        REQUIRE(true == ring.try_pop(out(value)));
+        REQUIRE(1u == value);
+        REQUIRE(true == ring.try_push(3u));
+
+        REQUIRE(true == ring.try_pop(out(value)));
+        REQUIRE(2u == value);
+        REQUIRE(true == ring.try_pop(out(value)));
+        REQUIRE(3u == value);
+    }
+
+    SECTION("Values left in the ring are destroyed with it")
+    {
+        auto counter = std::make_shared<int>(0);
+
+        {
+            MpscRing<std::shared_ptr<int>, 4u> ring;
+
+            ring.try_push(counter);
+            ring.try_push(counter);
+            REQUIRE(3 == counter.use_count());
+        }
+
+        REQUIRE(1 == counter.use_count());
+    }
+}
+
+TEST_CASE("MpscRing<T, N>: concurrency", "[lx][containers][MpscRing<T, N>]")
+{
+    using namespace lx::common;
+    using namespace lx::containers;
+
+    SECTION("Every value pushed by concurrent producers is popped exactly once and in per producer order")
+    {
+        constexpr std::uint32_t producers_count = 4u;
+        constexpr std::uint32_t values_count = 20000u;
+
+        MpscRing<std::uint32_t, 64u> ring;
+        std::vector<std::thread> producers;
+
+        for (std::uint32_t producer = 0u; producer < producers_count; producer++)
+        {
+            producers.emplace_back([&ring, producer]() {
+                for (std::uint32_t i = 0u; i < values_count; i++)
+                {
+                    while (false == ring.try_push((producer << 24u) | i))
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+
+        std::vector<std::uint32_t> next(producers_count, 0u);
+        std::uint32_t popped = 0u;
+        bool ordered = true;
+
+        while (popped < producers_count * values_count)
+        {
+            std::uint32_t value = 0u;
+
+            if (true == ring.try_pop(out(value)))
+            {
+                const std::uint32_t producer = value >> 24u;
+
+                ordered = ordered && (value & 0xFFFFFFu) == next[producer];
+                next[producer]++;
+                popped++;
+            }
+        }
+
+        for (std::thread& producer : producers)
+        {
+            producer.join();
+        }
+
+        REQUIRE(true == ordered);
+        REQUIRE(true == ring.is_empty());
+
+        for (std::uint32_t count : next)
+        {
+            REQUIRE(values_count == count);
+        }
+    }
+}
@@ -0,0 +1,202 @@
+// external
+#include <catch2/catch_test_macros.hpp>
+
+// lx
+#include <lx/containers/SlotMap.hpp>
+#include <lx/memory/Allocator.hpp>
+#include <lx/memory/Resource.hpp>
+
+// std
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+TEST_CASE("SlotMap: insertion, lookup and erase", "[lx][containers][SlotMap]")
+{
+    using namespace lx::containers;
+
+    SECTION("Null handles resolve to nothing")
+    {
+        SlotMap<std::uint32_t> map;
+        const SlotMap<std::uint32_t>::Handle handle;
+
+        REQUIRE(true == handle.is_null());
+        REQUIRE(true == map.is_empty());
+        REQUIRE(nullptr == map.get(handle));
+        REQUIRE(false == map.erase(handle));
+    }
+
+    SECTION("Handles address their values")
+    {
+        SlotMap<std::string> map;
+
+        const auto first = map.emplace("first");
+        const auto second = map.emplace(3u, 'x');
+
+        REQUIRE(2u == map.get_length());
+        REQUIRE("first" == *map.get(first));
+        REQUIRE("xxx" == *map.get(second));
+        REQUIRE(first != second);
+        REQUIRE(second == map.get_handle(1u));
+    }
+
+    SECTION("Stale handles are detected after the slot is reused")
+    {
+        SlotMap<std::uint32_t> map;
+
+        const auto stale = map.emplace(1u);
+        REQUIRE(true == map.erase(stale));
+        REQUIRE(false == map.erase(stale));
+
+        const auto fresh = map.emplace(2u);
+
+        REQUIRE(stale.get_index() == fresh.get_index());
+        REQUIRE(stale.get_generation() + 1u == fresh.get_generation());
+        REQUIRE(false == map.is_valid(stale));
+        REQUIRE(nullptr == map.get(stale));
+        REQUIRE(2u == *map.get(fresh));
+    }
+
+    SECTION("Erase keeps the values packed and the handles valid")
+    {
+        SlotMap<std::uint32_t> map;
+        std::vector<SlotMap<std::uint32_t>::Handle> handles;
+
+        for (std::uint32_t i = 0u; i < 4u; i++)
+        {
+            handles.push_back(map.emplace(i));
+        }
+
+        REQUIRE(true == map.erase(handles[1]));
+        REQUIRE(3u == map.get_length());
+        REQUIRE(3u == map.get_values()[1]);
+        REQUIRE(handles[3] == map.get_handle(1u));
+        REQUIRE(0u == *map.get(handles[0]));
+        REQUIRE(2u == *map.get(handles[2]));
+        REQUIRE(3u == *map.get(handles[3]));
+
+        map.clear();
+
+        REQUIRE(true == map.is_empty());
+        REQUIRE(nullptr == map.get(handles[0]));
+        REQUIRE(nullptr == map.get(handles[3]));
+    }
+
+    SECTION("Slots are retired before their generation wraps")
+    {
+        using Map = SlotMap<std::uint32_t>;
+
+        Map map;
+        const Map::Handle first = map.emplace(0u);
+        Map::Handle handle = first;
+
+        for (std::uint32_t i = 0u; i < Map::Handle::generation_mask; i++)
+        {
+            REQUIRE(true == map.erase(handle));
+            handle = map.emplace(i);
+        }
+
+        REQUIRE(first.get_index() != handle.get_index());
+        REQUIRE(false == map.is_valid(first));
+    }
+
+    SECTION("Random churn matches std::unordered_map")
+    {
+        using Map = SlotMap<std::uint64_t, std::uint64_t>;
+
+        Map map;
+        std::unordered_map<std::uint64_t, std::uint64_t> reference;
+        std::vector<Map::Handle> handles;
+        std::uint32_t state = 0x9E3779B9u;
+
+        for (std::size_t i = 0u; i < 100000u; i++)
+        {
+            state ^= state << 13u;
+            state ^= state >> 17u;
+            state ^= state << 5u;
+
+            if (false == handles.empty() && 0u == (state & 0x100u))
+            {
+                const std::size_t index = state % handles.size();
+                const Map::Handle handle = handles[index];
+
+                REQUIRE((1u == reference.erase(handle.value)) == map.erase(handle));
+                handles[index] = handles.back();
+                handles.pop_back();
+            }
+            else
+            {
+                const Map::Handle handle = map.emplace(i);
+
+                REQUIRE(0u == reference.count(handle.value));
+                reference[handle.value] = i;
+                handles.push_back(handle);
+            }
+        }
+
+        REQUIRE(reference.size() == map.get_length());
+
+        for (std::size_t i = 0u; i < map.get_length(); i++)
+        {
+            REQUIRE(reference.at(map.get_handle(i).value) == map.get_values()[i]);
+        }
+    }
+}
+
+TEST_CASE("SlotMap: copies, moves and allocators", "[lx][containers][SlotMap]")
+{
+    using namespace lx::containers;
+    using namespace lx::memory;
+
+    SECTION("Copies and moves keep the values")
+    {
+        SlotMap<std::string> map;
+        std::vector<SlotMap<std::string>::Handle> handles;
+
+        for (std::uint32_t i = 0u; i < 100u; i++)
+        {
+            handles.push_back(map.emplace(std::to_string(i)));
+        }
+
+        // leaves a free slot behind, which must not follow the values out of the moved from map
+        map.erase(map.emplace("erased"));
+
+        SlotMap<std::string> copy(map);
+        SlotMap<std::string> moved(std::move(map));
+
+        REQUIRE("42" == *copy.get(handles[42]));
+        REQUIRE("42" == *moved.get(handles[42]));
+        REQUIRE(true == map.is_empty());
+        REQUIRE("again" == *map.get(map.emplace("again")));
+
+        map = copy;
+        REQUIRE("99" == *map.get(handles[99]));
+
+        copy = std::move(moved);
+        REQUIRE("7" == *copy.get(handles[7]));
+        REQUIRE(true == moved.is_empty());
+    }
+
+    SECTION("Allocates from the given resource")
+    {
+        Heap heap("test");
+
+        {
+            SlotMap<std::uint32_t, std::uint32_t, Allocator<std::uint32_t>> map(heap);
+            SlotMap<std::uint32_t, std::uint32_t, Allocator<std::uint32_t>>::Handle handle;
+
+            for (std::uint32_t i = 0u; i < 100u; i++)
+            {
+                handle = map.emplace(i);
+            }
+
+            REQUIRE(heap.get_size() > 0u);
+            REQUIRE(99u == *map.get(handle));
+        }
+
+        REQUIRE(0u == heap.get_size());
+    }
+}
@@ -0,0 +1,140 @@
+// external
+#include <catch2/catch_test_macros.hpp>
+
+// lx
+#include <lx/containers/SmallVector.hpp>
+
+// std
+#include <cstdint>
+#include <span>
+#include <string>
+
+TEST_CASE("SmallVector<T, N>: construction", "[lx][containers][SmallVector<T, N>]")
+{
+    using namespace lx::containers;
+
+    SECTION("Default constructor creates empty vector with inline capacity")
+    {
+        SmallVector<std::uint32_t, 4u> vector;
+
+        REQUIRE(0u == vector.get_length());
+        REQUIRE(4u == vector.get_capacity());
+        REQUIRE(true == vector.is_empty());
+        REQUIRE(true == vector.is_inline());
+    }
+
+    SECTION("Constructor with capacity above inline capacity spills to heap")
+    {
+        SmallVector<std::uint32_t, 4u> vector(8u);
+
+        REQUIRE(0u == vector.get_length());
+        REQUIRE(8u == vector.get_capacity());
+        REQUIRE(false == vector.is_inline());
+    }
+
+    SECTION("Initializer list constructor fills vector with values")
+    {
+        SmallVector<float, 4u> vector { 1.0f, 0.5f };
+
+        REQUIRE(2u == vector.get_length());
+        REQUIRE(true == vector.is_inline());
+        REQUIRE(1.0f == vector[0]);
+        REQUIRE(0.5f == vector[1]);
+    }
+
+    SECTION("Copy constructor creates identical vector")
+    {
+        SmallVector<std::string, 2u> vector_1 { "a", "b", "c" };
+        SmallVector<std::string, 2u> vector_2(vector_1);
+
+        REQUIRE(3u == vector_2.get_length());
+        REQUIRE("a" == vector_2[0]);
+        REQUIRE("c" == vector_2[2]);
+        REQUIRE(3u == vector_1.get_length());
+    }
+
+    SECTION("Move constructor transfers inline elements and leaves source empty")
+    {
+        SmallVector<std::string, 4u> source { "a", "b" };
+        SmallVector<std::string, 4u> moved(std::move(source));
+
+        REQUIRE(2u == moved.get_length());
+        REQUIRE(true == moved.is_inline());
+        REQUIRE("b" == moved[1]);
+        REQUIRE(0u == source.get_length());
+    }
+
+    SECTION("Move constructor takes over heap buffer")
+    {
+        SmallVector<std::uint32_t, 2u> source { 1u, 2u, 3u };
+        const std::uint32_t* buffer = source.get_buffer();
+
+        SmallVector<std::uint32_t, 2u> moved(std::move(source));
+
+        REQUIRE(buffer == moved.get_buffer());
+        REQUIRE(3u == moved.get_length());
+        REQUIRE(true == source.is_inline());
+        REQUIRE(0u == source.get_length());
+    }
+}
+TEST_CASE("SmallVector<T, N>: spilling", "[lx][containers][SmallVector<T, N>]")
+{
+    using namespace lx::containers;
+
+    SECTION("push_back stays inline up to inline capacity")
+    {
+        SmallVector<std::uint32_t, 4u> vector;
+
+        for (std::uint32_t i = 0u; i < 4u; i++)
+        {
+            vector.push_back(i);
+        }
+
+        REQUIRE(4u == vector.get_length());
+        REQUIRE(true == vector.is_inline());
+    }
+
+    SECTION("push_back past inline capacity moves elements to heap")
+    {
+        SmallVector<std::string, 4u> vector;
+
+        for (std::uint32_t i = 0u; i < 64u; i++)
+        {
+            vector.emplace_back(std::to_string(i));
+        }
+
+        REQUIRE(64u == vector.get_length());
+        REQUIRE(false == vector.is_inline());
+
+        for (std::uint32_t i = 0u; i < 64u; i++)
+        {
+            REQUIRE(std::to_string(i) == vector[i]);
+        }
+    }
+
+    SECTION("push_back(span) appends all elements")
+    {
+        const std::uint32_t arr[] = { 1u, 2u, 3u };
+        SmallVector<std::uint32_t, 2u> vector;
+
+        vector.push_back(std::span { arr });
+
+        REQUIRE(3u == vector.get_length());
+        REQUIRE(3u == vector.get_back());
+    }
+
+    SECTION("shrink_to_fit returns to inline storage when elements fit")
+    {
+        SmallVector<std::uint32_t, 4u> vector { 1u, 2u, 3u, 4u, 5u };
+
+        REQUIRE(false == vector.is_inline());
+
+        vector.pop_back();
+        vector.pop_back();
+        vector.shrink_to_fit();
+
+        REQUIRE(true == vector.is_inline());
+        REQUIRE(3u == vector.get_length());
+        REQUIRE(3u == vector[2]);
+    }
+}
@@ -0,0 +1,170 @@
+// external
+#include <catch2/catch_test_macros.hpp>
+
+// lx
+#include <lx/containers/SparseSet.hpp>
+#include <lx/memory/Allocator.hpp>
+#include <lx/memory/Resource.hpp>
+
+// std
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+TEST_CASE("SparseSet: insertion, lookup and erase", "[lx][containers][SparseSet]")
+{
+    using namespace lx::containers;
+
+    SECTION("Empty set finds nothing")
+    {
+        SparseSet<std::uint32_t> set;
+
+        REQUIRE(true == set.is_empty());
+        REQUIRE(false == set.contains(0u));
+        REQUIRE(nullptr == set.get(123456u));
+        REQUIRE(false == set.erase(7u));
+        REQUIRE(set.begin() == set.end());
+    }
+
+    SECTION("Values are packed whatever the keys")
+    {
+        SparseSet<std::uint32_t> set;
+
+        set.emplace(5u, 50u);
+        set.emplace(100000u, 1u);
+        set.emplace(0u, 0u);
+
+        REQUIRE(3u == set.get_length());
+        REQUIRE(50u == *set.get(5u));
+        REQUIRE(1u == *set.get(100000u));
+        REQUIRE(true == set.contains(0u));
+        REQUIRE(false == set.contains(99999u));
+        REQUIRE(3u == static_cast<std::size_t>(set.end() - set.begin()));
+        REQUIRE(5u == set.get_keys()[0]);
+        REQUIRE(100000u == set.get_keys()[1]);
+    }
+
+    SECTION("Erase moves the last value into the gap")
+    {
+        SparseSet<std::uint32_t> set;
+
+        for (std::uint32_t i = 0u; i < 4u; i++)
+        {
+            set.emplace(i * 10u, i);
+        }
+
+        REQUIRE(true == set.erase(10u));
+        REQUIRE(false == set.erase(10u));
+        REQUIRE(false == set.contains(10u));
+        REQUIRE(3u == set.get_length());
+        REQUIRE(30u == set.get_keys()[1]);
+        REQUIRE(3u == set.get_values()[1]);
+        REQUIRE(3u == *set.get(30u));
+
+        REQUIRE(true == set.erase(30u));
+        REQUIRE(true == set.erase(20u));
+        REQUIRE(true == set.erase(0u));
+        REQUIRE(true == set.is_empty());
+    }
+
+    SECTION("clear empties the set")
+    {
+        SparseSet<std::uint32_t> set;
+
+        set.emplace(1u, 1u);
+        set.emplace(70000u, 2u);
+        set.clear();
+
+        REQUIRE(true == set.is_empty());
+        REQUIRE(false == set.contains(1u));
+        REQUIRE(false == set.contains(70000u));
+
+        set.emplace(70000u, 3u);
+        REQUIRE(3u == *set.get(70000u));
+    }
+
+    SECTION("Random churn matches std::unordered_map")
+    {
+        SparseSet<std::uint64_t> set;
+        std::unordered_map<std::uint32_t, std::uint64_t> reference;
+        std::uint32_t state = 0x9E3779B9u;
+
+        for (std::size_t i = 0u; i < 100000u; i++)
+        {
+            state ^= state << 13u;
+            state ^= state >> 17u;
+            state ^= state << 5u;
+
+            const std::uint32_t key = state % 20000u;
+
+            if (0u == (state & 0x100u))
+            {
+                REQUIRE((1u == reference.erase(key)) == set.erase(key));
+            }
+            else if (false == set.contains(key))
+            {
+                set.emplace(key, i);
+                reference[key] = i;
+            }
+        }
+
+        REQUIRE(reference.size() == set.get_length());
+
+        for (std::size_t i = 0u; i < set.get_length(); i++)
+        {
+            REQUIRE(reference.at(set.get_keys()[i]) == set.get_values()[i]);
+        }
+    }
+}
+
+TEST_CASE("SparseSet: copies, moves and allocators", "[lx][containers][SparseSet]")
+{
+    using namespace lx::containers;
+    using namespace lx::memory;
+
+    SECTION("Copies and moves keep the values")
+    {
+        SparseSet<std::string> set;
+
+        for (std::uint32_t i = 0u; i < 100u; i++)
+        {
+            set.emplace(i * 1000u, std::to_string(i));
+        }
+
+        SparseSet<std::string> copy(set);
+        SparseSet<std::string> moved(std::move(set));
+
+        REQUIRE(true == set.is_empty());
+        REQUIRE(false == set.contains(42000u));
+        REQUIRE("42" == *copy.get(42000u));
+        REQUIRE("42" == *moved.get(42000u));
+
+        set = copy;
+        REQUIRE("99" == *set.get(99000u));
+
+        copy = std::move(moved);
+        REQUIRE("7" == *copy.get(7000u));
+        REQUIRE(true == moved.is_empty());
+    }
+
+    SECTION("Allocates from the given resource")
+    {
+        Heap heap("test");
+
+        {
+            SparseSet<std::uint32_t, Allocator<std::uint32_t>> set(heap);
+
+            for (std::uint32_t i = 0u; i < 100u; i++)
+            {
+                set.emplace(i * 100u, i);
+            }
+
+            REQUIRE(heap.get_size() > 0u);
+            REQUIRE(99u == *set.get(9900u));
+        }
+
+        REQUIRE(0u == heap.get_size());
+    }
+}
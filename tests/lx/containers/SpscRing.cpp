@@ -0,0 +1,175 @@
+// external
+#include <catch2/catch_test_macros.hpp>
+
+// lx
+#include <lx/common/out.hpp>
+#include <lx/containers/SpscRing.hpp>
+
+// std
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST_CASE("SpscRing<T, N>: push/pop", "[lx][containers][SpscRing<T, N>]")
+{
+    using namespace lx::common;
+    using namespace lx::containers;
+
+    SECTION("Empty ring pops nothing")
+    {
+        SpscRing<std::uint32_t, 4u> ring;
+        std::uint32_t value = 0u;
+
+        REQUIRE(true == ring.is_empty());
+        REQUIRE(4u == ring.get_capacity());
+        REQUIRE(false == ring.try_pop(out(value)));
+    }
+
+    SECTION("Values are popped in push order")
+    {
+        SpscRing<std::string, 4u> ring;
+
+        REQUIRE(true == ring.try_push("a"));
+        REQUIRE(true == ring.try_push("b"));
+        REQUIRE(true == ring.try_emplace(3u, 'c'));
+        REQUIRE(3u == ring.get_length());
+
+        std::string value;
+
+        REQUIRE(true == ring.try_pop(out(value)));
+        REQUIRE("a" == value);
+        REQUIRE(true == ring.try_pop(out(value)));
+        REQUIRE("b" == value);
+        REQUIRE(true == ring.try_pop(out(value)));
+        REQUIRE("ccc" == value);
+        REQUIRE(false == ring.try_pop(out(value)));
+    }
+
+    SECTION("Push fails when the ring is full and succeeds again after a pop")
+    {
+        SpscRing<std::uint32_t, 2u> ring;
+        std::uint32_t value = 0u;
+
+        REQUIRE(true == ring.try_push(1u));
+        REQUIRE(true == ring.try_push(2u));
+        REQUIRE(false == ring.try_push(3u));
+
+        REQUIRE(true == ring.try_pop(out(value)));
+        REQUIRE(1u == value);
+        REQUIRE(true == ring.try_push(3u));
+
+        REQUIRE(true == ring.try_pop(out(value)));
+        REQUIRE(2u == value);
+        REQUIRE(true == ring.try_pop(out(value)));
+        REQUIRE(3u == value);
+    }
+
+    SECTION("Batches are cut to the free and the ready cells")
+    {
+        SpscRing<std::uint32_t, 4u> ring;
+        const std::array<std::uint32_t, 3u> values { 1u, 2u, 3u };
+        std::array<std::uint32_t, 4u> popped {};
+
+        REQUIRE(3u == ring.try_push(std::span<const std::uint32_t> { values }));
+        REQUIRE(1u == ring.try_push(std::span<const std::uint32_t> { values }));
+        REQUIRE(0u == ring.try_push(std::span<const std::uint32_t> { values }));
+
+        REQUIRE(2u == ring.try_pop(std::span<std::uint32_t> { popped.data(), 2u }));
+        REQUIRE(2u == ring.try_push(std::span<const std::uint32_t> { values }));
+        REQUIRE(4u == ring.try_pop(std::span<std::uint32_t> { popped }));
+        REQUIRE(std::array<std::uint32_t, 4u> { 3u, 1u, 1u, 2u } == popped);
+        REQUIRE(0u == ring.try_pop(std::span<std::uint32_t> { popped }));
+    }
+
+    SECTION("Values left in the ring are destroyed with it")
+    {
+        auto counter = std::make_shared<int>(0);
+
+        {
+            SpscRing<std::shared_ptr<int>, 4u> ring;
+
+            ring.try_push(counter);
+            ring.try_push(counter);
+            REQUIRE(3 == counter.use_count());
+        }
+
+        REQUIRE(1 == counter.use_count());
+    }
+}
+
+TEST_CASE("SpscRing<T, N>: concurrency", "[lx][containers][SpscRing<T, N>]")
+{
+    using namespace lx::common;
+    using namespace lx::containers;
+
+    SECTION("Every value pushed by the producer is popped exactly once and in order")
+    {
+        constexpr std::uint32_t values_count = 100000u;
+
+        SpscRing<std::uint32_t, 64u> ring;
+
+        std::thread producer([&ring]() {
+            std::array<std::uint32_t, 8u> batch {};
+
+            for (std::uint32_t i = 0u; i < values_count;)
+            {
+                // single values and batches interleaved
+                std::uint32_t pushed = 0u;
+
+                if (0u == i % 3u)
+                {
+                    pushed = true == ring.try_push(i) ? 1u : 0u;
+                }
+                else
+                {
+                    std::uint32_t count = 0u;
+
+                    for (; count < batch.size() && i + count < values_count; count++)
+                    {
+                        batch[count] = i + count;
+                    }
+
+                    pushed = static_cast<std::uint32_t>(ring.try_push(std::span<const std::uint32_t> { batch.data(), count }));
+                }
+
+                if (0u == pushed)
+                {
+                    std::this_thread::yield();
+                }
+
+                i += pushed;
+            }
+        });
+
+        std::vector<std::uint32_t> popped;
+        std::array<std::uint32_t, 5u> batch {};
+
+        while (popped.size() < values_count)
+        {
+            const std::size_t count = ring.try_pop(std::span<std::uint32_t> { batch });
+
+            if (0u == count)
+            {
+                std::this_thread::yield();
+            }
+
+            popped.insert(popped.end(), batch.begin(), batch.begin() + count);
+        }
+
+        producer.join();
+
+        bool ordered = true;
+
+        for (std::uint32_t i = 0u; i < values_count; i++)
+        {
+            ordered = ordered && i == popped[i];
+        }
+
+        REQUIRE(true == ordered);
+        REQUIRE(true == ring.is_empty());
+    }
+}
@@ -5,28 +5,66 @@
 #include <lx/containers/String.hpp>
 
 // std
+#include <cstddef>
 #include <cstring>
+#include <string_view>
+#include <utility>
 
 TEST_CASE("String<char>: constructors", "[lx][containers][String<char>]")
 {
     using namespace lx::containers;
 
-    SECTION("Default constructor creates an empty string")
+    SECTION("Default constructor creates an empty local string")
     {
         String<char> string;
 
         REQUIRE(0u == string.get_length());
-        REQUIRE(1u == string.get_capacity());
+        REQUIRE(String<char>::local_capacity == string.get_capacity());
+        REQUIRE(true == string.is_local());
         REQUIRE(0 == std::strncmp("", string.get_cstring(), 1u));
     }
 
-    SECTION("Constructor from const char* initializes correctly")
+    SECTION("Constructor from const char* keeps a short string local")
     {
         String<char> string("test");
 
         REQUIRE(4u == string.get_length());
-        REQUIRE(6u == string.get_capacity());
-        REQUIRE(0 == std::strncmp("test", string.get_cstring(), string.get_length()));
+        REQUIRE(true == string.is_local());
+        REQUIRE(0 == std::strncmp("test", string.get_cstring(), string.get_length() + 1u));
+    }
+
+    SECTION("Constructor from const char* allocates for a long string")
+    {
+        constexpr std::string_view text = "assets/textures/characters/hero/idle.png";
+        String<char> string(text);
+
+        REQUIRE(text.size() == string.get_length());
+        REQUIRE(false == string.is_local());
+        REQUIRE(text.size() < string.get_capacity());
+        REQUIRE(text == std::string_view { string });
+    }
+
+    SECTION("Copies and moves keep the characters")
+    {
+        for (const std::string_view text : { std::string_view { "short" }, std::string_view { "a string too long for the object" } })
+        {
+            String<char> string(text);
+            String<char> copy(string);
+            String<char> moved(std::move(string));
+
+            REQUIRE(text == std::string_view { copy });
+            REQUIRE(text == std::string_view { moved });
+            REQUIRE(true == string.is_empty());
+            REQUIRE(0 == std::strncmp("", string.get_cstring(), 1u));
+
+            String<char> assigned;
+            assigned = copy;
+            REQUIRE(text == std::string_view { assigned });
+
+            assigned = std::move(moved);
+            REQUIRE(text == std::string_view { assigned });
+            REQUIRE(true == moved.is_empty());
+        }
     }
 }
 TEST_CASE("String<char>: push_back operations", "[lx][containers][String<char>]")
@@ -40,51 +78,48 @@ TEST_CASE("String<char>: push_back operations", "[lx][containers][String<char>]"
         string.push_back('X');
 
         REQUIRE(1u == string.get_length());
-        REQUIRE(2u == string.get_capacity());
-        REQUIRE(0 == std::strncmp("X", string.get_cstring(), string.get_length()));
+        REQUIRE(true == string.is_local());
+        REQUIRE(0 == std::strncmp("X", string.get_cstring(), string.get_length() + 1u));
     }
 
-    SECTION("push_back(char) multiple times on empty string")
+    SECTION("push_back(char) fills the local buffer before allocating")
     {
         String<char> string;
 
-        string.push_back('X');
-        string.push_back('Y');
-        string.push_back('Z');
-        string.push_back('0');
-        string.push_back('1');
-        string.push_back('2');
+        for (std::size_t i = 0u; i + 1u < String<char>::local_capacity; i++)
+        {
+            string.push_back('X');
+        }
 
-        REQUIRE(6u == string.get_length());
-        REQUIRE(7u == string.get_capacity());
-        REQUIRE(0 == std::strncmp("XYZ012", string.get_cstring(), string.get_length()));
-    }
+        REQUIRE(String<char>::local_capacity - 1u == string.get_length());
+        REQUIRE(true == string.is_local());
 
-    SECTION("push_back(char) on pre-filled string appends character")
-    {
-        String<char> string("test");
-
-        string.push_back('X');
+        string.push_back('Y');
 
-        REQUIRE(5u == string.get_length());
-        REQUIRE(6u == string.get_capacity());
-        REQUIRE(0 == std::strncmp("testX", string.get_cstring(), string.get_length()));
+        REQUIRE(String<char>::local_capacity == string.get_length());
+        REQUIRE(false == string.is_local());
+        REQUIRE('Y' == string.get_cstring()[string.get_length() - 1u]);
+        REQUIRE('\0' == string.get_cstring()[string.get_length()]);
     }
 
-    SECTION("push_back(char) multiple times on pre-filled string")
+    SECTION("push_back(char) grows the capacity geometrically")
     {
-        String<char> string("test");
+        String<char> string;
+        std::size_t reallocations_count = 0u;
 
-        string.push_back('X');
-        string.push_back('Y');
-        string.push_back('Z');
-        string.push_back('0');
-        string.push_back('1');
-        string.push_back('2');
+        for (std::size_t i = 0u; i < 10000u; i++)
+        {
+            const std::size_t capacity = string.get_capacity();
+            string.push_back(static_cast<char>('a' + i % 26u));
 
-        REQUIRE(10u == string.get_length());
-        REQUIRE(11u == string.get_capacity());
-        REQUIRE(0 == std::strncmp("testXYZ012", string.get_cstring(), string.get_length()));
+            reallocations_count += capacity != string.get_capacity() ? 1u : 0u;
+        }
+
+        REQUIRE(10000u == string.get_length());
+        REQUIRE(reallocations_count <= 10u);
+        REQUIRE('a' == string.get_cstring()[0]);
+        REQUIRE('p' == string.get_cstring()[9999u]);
+        REQUIRE('\0' == string.get_cstring()[10000u]);
     }
 
     SECTION("push_back(const char*) on empty string adds entire literal")
@@ -94,8 +129,7 @@ TEST_CASE("String<char>: push_back operations", "[lx][containers][String<char>]"
         string.push_back("test");
 
         REQUIRE(4u == string.get_length());
-        REQUIRE(5u == string.get_capacity());
-        REQUIRE(0 == std::strncmp("test", string.get_cstring(), string.get_length()));
+        REQUIRE(0 == std::strncmp("test", string.get_cstring(), string.get_length() + 1u));
     }
 
     SECTION("push_back(const char*) on pre-filled string appends literal")
@@ -105,10 +139,95 @@ TEST_CASE("String<char>: push_back operations", "[lx][containers][String<char>]"
         string.push_back("XYZ012");
 
         REQUIRE(10u == string.get_length());
-        REQUIRE(11u == string.get_capacity());
-        REQUIRE(0 == std::strncmp("testXYZ012", string.get_cstring(), string.get_length()));
+        REQUIRE(0 == std::strncmp("testXYZ012", string.get_cstring(), string.get_length() + 1u));
+    }
+
+    SECTION("append of the string itself")
+    {
+        String<char> string("0123456789");
+
+        string.append(std::string_view { string });
+        string.append(std::string_view { string });
+
+        REQUIRE("0123456789012345678901234567890123456789" == std::string_view { string });
+    }
+
+    SECTION("append(count, char)")
+    {
+        String<char> string("x");
+
+        string.append(3u, '-');
+        string.append(30u, '=');
+
+        REQUIRE(34u == string.get_length());
+        REQUIRE("x---=" == std::string_view { string }.substr(0u, 5u));
+        REQUIRE('=' == string.get_cstring()[33u]);
+    }
+}
+TEST_CASE("String<char>: capacity", "[lx][containers][String<char>]")
+{
+    using namespace lx::containers;
+
+    SECTION("resize keeps the length and the characters")
+    {
+        String<char> string("test");
+
+        string.resize(100u);
+
+        REQUIRE(4u == string.get_length());
+        REQUIRE(101u <= string.get_capacity());
+        REQUIRE("test" == std::string_view { string });
+
+        const char* buffer = string.get_cstring();
+
+        for (std::size_t i = 0u; i < 96u; i++)
+        {
+            string.push_back('x');
+        }
+
+        REQUIRE(buffer == string.get_cstring());
     }
+
+    SECTION("reserve and clear")
+    {
+        String<char> string("test");
+
+        string.reserve(6u, '!');
+        REQUIRE("test!!" == std::string_view { string });
+
+        string.reserve(2u);
+        REQUIRE("te" == std::string_view { string });
+
+        string.clear();
+        REQUIRE(true == string.is_empty());
+        REQUIRE(0 == std::strncmp("", string.get_cstring(), 1u));
+    }
+
+    SECTION("assignment of a part of the string itself")
+    {
+        String<char> string("a string too long for the object");
+
+        string = std::string_view { string }.substr(2u, 6u);
+
+        REQUIRE("string" == std::string_view { string });
+    }
+}
+#if defined(__cpp_lib_format)
+TEST_CASE("String<char>: format_to", "[lx][containers][String<char>]")
+{
+    using namespace lx::containers;
+
+    String<char> string("x = ");
+    const int value = 42;
+
+    string.format_to("{}, y = {:.2f}", value, 1.5);
+    REQUIRE("x = 42, y = 1.50" == std::string_view { string });
+
+    string.format_to(" {:>40}", "padded");
+    REQUIRE(57u == string.get_length());
+    REQUIRE(std::string_view { string }.ends_with(" padded"));
 }
+#endif
 TEST_CASE("String<char>: conversion to string_view", "[lx][containers][String<char>]")
 {
     using namespace lx::containers;
@@ -202,6 +321,20 @@ TEST_CASE("String<char, N>: push_back behavior in string", "[lx][containers][Str
         REQUIRE(0 == std::strncmp("XY", string.get_cstring(), string.get_length()));
     }
 }
+TEST_CASE("String<char, N>: reserve", "[lx][containers][String<char, N>]")
+{
+    using namespace lx::containers;
+
+    String<char, 8u> string("ab");
+
+    REQUIRE(true == string.reserve(4u));
+    string.get_buffer()[2] = 'c';
+    string.get_buffer()[3] = 'd';
+
+    REQUIRE("abcd" == std::string_view { string });
+    REQUIRE(false == string.reserve(8u));
+    REQUIRE(4u == string.get_length());
+}
 TEST_CASE("String<char, N>: conversion to string_view", "[lx][containers][String<char, N>]")
 {
     using namespace lx::containers;
@@ -0,0 +1,117 @@
+// external
+#include <catch2/catch_test_macros.hpp>
+
+// lx
+#include <lx/containers/StringId.hpp>
+
+// std
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+TEST_CASE("StringId: hashing", "[lx][containers][StringId]")
+{
+    using namespace lx::containers;
+    using namespace lx::containers::literals;
+
+    SECTION("Compile time and run time ids of a name are equal")
+    {
+        constexpr StringId player = "player"_id;
+        static_assert(StringId { "player" } == player);
+
+        const std::string name = "player";
+
+        REQUIRE(player == StringId { name });
+        REQUIRE(player != StringId { "players" });
+    }
+
+    SECTION("The hash is 64 bit FNV-1a")
+    {
+        static_assert(0xCBF29CE484222325u == StringId::get_hash(""));
+        static_assert(0xAF63DC4C8601EC8Cu == StringId::get_hash("a"));
+        static_assert(0x85944171F73967E8u == StringId::get_hash("foobar"));
+    }
+
+    SECTION("Default id is the id of the empty name")
+    {
+        REQUIRE(true == StringId {}.is_empty());
+        REQUIRE(StringId {} == ""_id);
+        REQUIRE(false == "a"_id.is_empty());
+    }
+
+    SECTION("Ids are hash keys")
+    {
+        std::unordered_map<StringId, int> map;
+
+        map["position"_id] = 1;
+        map["velocity"_id] = 2;
+
+        REQUIRE(1 == map[StringId { std::string { "position" } }]);
+        REQUIRE(2 == map.at("velocity"_id));
+        REQUIRE(0u == map.count("mass"_id));
+    }
+
+    SECTION("Ids made at run time are interned in every build")
+    {
+        const std::size_t collisions_count = StringId::get_collisions_count();
+
+        for (std::size_t i = 0u; i < 1000u; i++)
+        {
+            static_cast<void>(StringId { "asset_" + std::to_string(i) });
+            static_cast<void>(StringId { "asset_" + std::to_string(i) });
+        }
+
+        REQUIRE(collisions_count == StringId::get_collisions_count());
+    }
+}
+#if LX_STRING_ID_NAMES
+TEST_CASE("StringId: names", "[lx][containers][StringId]")
+{
+    using namespace lx::containers;
+    using namespace lx::containers::literals;
+
+    SECTION("Ids made at run time remember their names")
+    {
+        const StringId id { std::string { "shaders/sprite.vert" } };
+
+        REQUIRE("shaders/sprite.vert" == id.get_name());
+        REQUIRE("shaders/sprite.vert" == StringId::from_hash(id.get_hash()).get_name());
+    }
+
+    SECTION("Ids made at compile time are named once the name is hashed at run time")
+    {
+        constexpr StringId id = "compile time only name"_id;
+
+        REQUIRE(true == id.get_name().empty());
+
+        const std::string name = "compile time only name";
+        static_cast<void>(StringId { name });
+
+        REQUIRE(name == id.get_name());
+    }
+
+    SECTION("Interning from many threads")
+    {
+        std::vector<std::thread> threads;
+
+        for (std::size_t i = 0u; i < 4u; i++)
+        {
+            threads.emplace_back([] {
+                for (std::size_t j = 0u; j < 1000u; j++)
+                {
+                    static_cast<void>(StringId { "entity_" + std::to_string(j) });
+                }
+            });
+        }
+
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        REQUIRE("entity_999" == "entity_999"_id.get_name());
+    }
+}
+#endif
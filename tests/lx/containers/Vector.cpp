@@ -4,6 +4,9 @@
 // lx
 #include <lx/containers/Vector.hpp>
 
+// std
+#include <string>
+
 TEST_CASE("Vector<T>: construction", "[lx][containers][Vector<T>]")
 {
     using namespace lx::containers;
@@ -89,4 +92,118 @@ TEST_CASE("Vector<T>: construction", "[lx][containers][Vector<T>]")
 
         REQUIRE(0u == source.get_length());
     }
-}
\ No newline at end of file
+}
+TEST_CASE("Vector<T>: growth", "[lx][containers][Vector<T>]")
+{
+    using namespace lx::containers;
+
+    SECTION("push_back grows capacity geometrically")
+    {
+        Vector<std::uint32_t> vector;
+
+        std::size_t reallocations = 0u;
+        std::size_t last_capacity = vector.get_capacity();
+
+        for (std::uint32_t i = 0u; i < 1000u; i++)
+        {
+            vector.push_back(i);
+
+            if (last_capacity != vector.get_capacity())
+            {
+                last_capacity = vector.get_capacity();
+                reallocations++;
+            }
+        }
+
+        REQUIRE(1000u == vector.get_length());
+        REQUIRE(1000u <= vector.get_capacity());
+        REQUIRE(reallocations <= 11u);
+
+        for (std::uint32_t i = 0u; i < 1000u; i++)
+        {
+            REQUIRE(i == vector[i]);
+        }
+    }
+
+    SECTION("emplace_back keeps non-trivial elements intact across reallocations")
+    {
+        Vector<std::string> vector;
+
+        for (std::uint32_t i = 0u; i < 100u; i++)
+        {
+            vector.emplace_back(std::to_string(i) + " - long enough to live on the heap");
+        }
+
+        REQUIRE(100u == vector.get_length());
+        REQUIRE("0 - long enough to live on the heap" == vector[0]);
+        REQUIRE("99 - long enough to live on the heap" == vector.get_back());
+    }
+
+    SECTION("emplace_back may reference an element of the vector itself")
+    {
+        Vector<std::string> vector { "self referencing element" };
+
+        REQUIRE(1u == vector.get_capacity());
+
+        vector.emplace_back(vector[0]);
+
+        REQUIRE(2u == vector.get_length());
+        REQUIRE("self referencing element" == vector[1]);
+    }
+}
+TEST_CASE("Vector<T>: removal", "[lx][containers][Vector<T>]")
+{
+    using namespace lx::containers;
+
+    SECTION("pop_back on empty vector fails")
+    {
+        Vector<std::uint32_t> vector;
+
+        REQUIRE(false == vector.pop_back());
+    }
+
+    SECTION("pop_back destroys last element")
+    {
+        auto counter = std::make_shared<int>(0);
+        Vector<std::shared_ptr<int>> vector;
+
+        vector.push_back(counter);
+        vector.push_back(counter);
+
+        REQUIRE(3 == counter.use_count());
+        REQUIRE(true == vector.pop_back());
+        REQUIRE(2 == counter.use_count());
+        REQUIRE(1u == vector.get_length());
+    }
+
+    SECTION("clear destroys elements and keeps capacity")
+    {
+        auto counter = std::make_shared<int>(0);
+        Vector<std::shared_ptr<int>> vector;
+
+        vector.push_back(counter);
+        vector.push_back(counter);
+        vector.push_back(counter);
+
+        const std::size_t capacity = vector.get_capacity();
+
+        vector.clear();
+
+        REQUIRE(1 == counter.use_count());
+        REQUIRE(true == vector.is_empty());
+        REQUIRE(capacity == vector.get_capacity());
+    }
+
+    SECTION("shrink_to_fit reduces capacity to length")
+    {
+        Vector<std::uint32_t> vector(16u);
+
+        vector.push_back(1u);
+        vector.push_back(2u);
+        vector.shrink_to_fit();
+
+        REQUIRE(2u == vector.get_capacity());
+        REQUIRE(1u == vector[0]);
+        REQUIRE(2u == vector[1]);
+    }
+}
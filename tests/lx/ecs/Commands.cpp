@@ -0,0 +1,140 @@
+// external
+#include <catch2/catch_test_macros.hpp>
+
+// lx
+#include <lx/ecs/Commands.hpp>
+#include <lx/ecs/World.hpp>
+
+// std
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace {
+struct Position
+{
+    float x = 0.0f;
+    float y = 0.0f;
+};
+struct Name
+{
+    std::string value;
+};
+} // namespace
+
+TEST_CASE("Commands: deferred structural changes", "[lx][ecs][Commands]")
+{
+    using namespace lx::ecs;
+
+    World world;
+    Commands commands;
+
+    SECTION("Commands recorded while iterating apply afterwards")
+    {
+        for (std::uint32_t i = 0u; i < 100u; i++)
+        {
+            world.create(Position { .x = static_cast<float>(i) });
+        }
+
+        world.each<const Position>([&](Entity entity_a, const Position& position_a) {
+            if (position_a.x < 50.0f)
+            {
+                commands.destroy(entity_a);
+            }
+            else
+            {
+                commands.add(entity_a, Name { .value = "kept" });
+            }
+        });
+        commands.create(Position { .x = -1.0f }, Name { .value = "created" });
+
+        REQUIRE(103u == commands.get_length());
+        REQUIRE(100u == world.get_entities_count());
+
+        world.apply(commands);
+
+        REQUIRE(true == commands.is_empty());
+        REQUIRE(51u == world.get_entities_count());
+
+        std::size_t count = 0u;
+        world.each<const Position, const Name>([&](const Position& position_a, const Name& name_a) {
+            REQUIRE((position_a.x >= 50.0f ? "kept" : "created") == name_a.value);
+            count++;
+        });
+        REQUIRE(51u == count);
+    }
+
+    SECTION("Commands on destroyed entities are dropped")
+    {
+        const std::shared_ptr<int> counter = std::make_shared<int>(0);
+        const Entity entity = world.create(Position {});
+
+        commands.destroy(entity);
+        commands.add(entity, counter);
+        commands.remove<Position>(entity);
+        REQUIRE(2 == counter.use_count());
+
+        world.apply(commands);
+
+        REQUIRE(false == world.is_alive(entity));
+        REQUIRE(1 == counter.use_count());
+    }
+
+    SECTION("Created entities are targeted by their placeholders")
+    {
+        const Entity existing = world.create(Position { .x = 1.0f });
+
+        const Entity first = commands.create(Position { .x = 2.0f });
+        const Entity second = commands.create(Position { .x = 3.0f }, Name { .value = "second" });
+
+        REQUIRE(false == world.is_alive(first));
+        REQUIRE(first != second);
+
+        commands.add(first, Name { .value = "first" });
+        commands.remove<Position>(first);
+        commands.destroy(second);
+        commands.add(existing, Name { .value = "existing" });
+        world.apply(commands);
+
+        REQUIRE(2u == world.get_entities_count());
+        REQUIRE("existing" == world.get<Name>(existing)->value);
+
+        std::size_t count = 0u;
+        world.each<const Name>([&](Entity entity_a, const Name& name_a) {
+            if (entity_a != existing)
+            {
+                REQUIRE("first" == name_a.value);
+                REQUIRE(false == world.has<Position>(entity_a));
+            }
+            count++;
+        });
+        REQUIRE(2u == count);
+    }
+
+    SECTION("Remove and replace")
+    {
+        const Entity entity = world.create(Position { .x = 1.0f }, Name { .value = "old" });
+
+        commands.remove<Position>(entity);
+        commands.add(entity, Name { .value = "new" });
+        world.apply(commands);
+
+        REQUIRE(false == world.has<Position>(entity));
+        REQUIRE("new" == world.get<Name>(entity)->value);
+    }
+
+    SECTION("Cleared commands release their components")
+    {
+        const std::shared_ptr<int> counter = std::make_shared<int>(0);
+
+        commands.create(counter);
+        commands.create(counter, Position {});
+        REQUIRE(3 == counter.use_count());
+
+        commands.clear();
+
+        REQUIRE(1 == counter.use_count());
+        REQUIRE(0u == world.get_entities_count());
+    }
+}
@@ -0,0 +1,121 @@
+// external
+#include <catch2/catch_test_macros.hpp>
+
+// lx
+#include <lx/ecs/Schedule.hpp>
+#include <lx/ecs/World.hpp>
+#include <lx/jobs/Scheduler.hpp>
+
+// std
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+
+namespace {
+struct Position
+{
+    float x = 0.0f;
+};
+struct Velocity
+{
+    float x = 0.0f;
+};
+struct Health
+{
+    std::int32_t value = 0;
+};
+struct Dead
+{
+};
+} // namespace
+
+TEST_CASE("Schedule: dependencies", "[lx][ecs][Schedule]")
+{
+    using namespace lx::ecs;
+
+    Schedule schedule;
+
+    const std::size_t move = schedule.add<Position, const Velocity>([](Position&, const Velocity&) {});
+    const std::size_t damp = schedule.add<Velocity>([](Velocity&) {});
+    const std::size_t heal = schedule.add<Health>([](Health&) {});
+    const std::size_t read = schedule.add<const Position, const Health>([](const Position&, const Health&) {});
+    const std::size_t view = schedule.add<const Velocity>([](const View<const Velocity>&) {});
+
+    REQUIRE(5u == schedule.get_systems_count());
+
+    // writers are ordered against everything accessing the same components, readers are not ordered against each other
+    REQUIRE(true == schedule.get_dependencies(move).empty());
+    REQUIRE((1u == schedule.get_dependencies(damp).size() && move == schedule.get_dependencies(damp)[0]));
+    REQUIRE(true == schedule.get_dependencies(heal).empty());
+    REQUIRE((2u == schedule.get_dependencies(read).size() && move == schedule.get_dependencies(read)[0] &&
+             heal == schedule.get_dependencies(read)[1]));
+    REQUIRE((1u == schedule.get_dependencies(view).size() && damp == schedule.get_dependencies(view)[0]));
+}
+
+TEST_CASE("Schedule: run", "[lx][ecs][Schedule]")
+{
+    using namespace lx::ecs;
+
+    constexpr std::uint32_t entities_count = 20000u;
+
+    World world;
+
+    for (std::uint32_t i = 0u; i < entities_count; i++)
+    {
+        const Entity entity = world.create(Position { .x = 0.0f }, Velocity { .x = 1.0f });
+
+        if (0u == i % 4u)
+        {
+            world.add<Health>(entity, Health { .value = static_cast<std::int32_t>(i % 8u) });
+        }
+    }
+
+    std::atomic<std::uint32_t> chunks = 0u;
+    std::atomic<std::uint32_t> wrong_order = 0u;
+
+    Schedule schedule;
+
+    // velocity doubles before it is read by the movement, which has to see every row already doubled
+    schedule.add<Velocity>([](Velocity& velocity_a) { velocity_a.x *= 2.0f; });
+    schedule.add<Position, const Velocity>([&](const View<Position, const Velocity>& view_a) {
+        chunks.fetch_add(1u, std::memory_order_relaxed);
+
+        for (std::size_t i = 0u; i < view_a.get_length(); i++)
+        {
+            wrong_order.fetch_add(view_a.get<const Velocity>()[i].x != 2.0f ? 1u : 0u, std::memory_order_relaxed);
+            view_a.get<Position>()[i].x += view_a.get<const Velocity>()[i].x;
+        }
+    });
+    schedule.add<Health>([](Health& health_a) { health_a.value -= 4; });
+    schedule.add<const Health>([](Commands& commands_a, Entity entity_a, const Health& health_a) {
+        if (health_a.value < 0)
+        {
+            commands_a.add(entity_a, Dead {});
+        }
+    });
+
+    SECTION("On the scheduler")
+    {
+        lx::jobs::Scheduler scheduler(3u);
+
+        schedule.run(world, scheduler);
+
+        REQUIRE(chunks.load() > 1u);
+    }
+
+    SECTION("On the calling thread")
+    {
+        schedule.run(world);
+    }
+
+    std::size_t count = 0u;
+    world.each<const Position>([&](const Position& position_a) { count += 2.0f == position_a.x ? 1u : 0u; });
+
+    std::size_t dead = 0u;
+    world.each<const Dead, const Health>([&](const Dead&, const Health& health_a) { dead += health_a.value < 0 ? 1u : 0u; });
+
+    REQUIRE(0u == wrong_order.load());
+    REQUIRE(entities_count == count);
+    REQUIRE(entities_count / 8u == dead);
+}
@@ -0,0 +1,255 @@
+// external
+#include <catch2/catch_test_macros.hpp>
+
+// lx
+#include <lx/ecs/World.hpp>
+#include <lx/memory/Resource.hpp>
+
+// std
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+struct Position
+{
+    float x = 0.0f;
+    float y = 0.0f;
+};
+struct Velocity
+{
+    float x = 0.0f;
+    float y = 0.0f;
+};
+struct Name
+{
+    std::string value;
+};
+struct Tag
+{
+};
+struct Big
+{
+    std::byte data[1000];
+};
+} // namespace
+
+TEST_CASE("World: entities and components", "[lx][ecs][World]")
+{
+    using namespace lx::ecs;
+
+    SECTION("Entities own their components")
+    {
+        World world;
+
+        const Entity entity = world.create(Position { .x = 1.0f, .y = 2.0f }, Name { .value = "player" });
+
+        REQUIRE(true == world.is_alive(entity));
+        REQUIRE(1u == world.get_entities_count());
+        REQUIRE(true == world.has<Position>(entity));
+        REQUIRE(true == world.has<Name>(entity));
+        REQUIRE(false == world.has<Velocity>(entity));
+        REQUIRE(2.0f == world.get<Position>(entity)->y);
+        REQUIRE("player" == world.get<Name>(entity)->value);
+        REQUIRE(nullptr == world.get<Velocity>(entity));
+
+        REQUIRE(true == world.destroy(entity));
+        REQUIRE(false == world.destroy(entity));
+        REQUIRE(false == world.is_alive(entity));
+        REQUIRE(nullptr == world.get<Position>(entity));
+        REQUIRE(0u == world.get_entities_count());
+    }
+
+    SECTION("Stale entities are not alive")
+    {
+        World world;
+
+        const Entity first = world.create(Tag {});
+        world.destroy(first);
+        const Entity second = world.create(Tag {});
+
+        REQUIRE(first.get_index() == second.get_index());
+        REQUIRE(false == world.is_alive(first));
+        REQUIRE(true == world.is_alive(second));
+        REQUIRE(false == world.is_alive(Entity {}));
+    }
+
+    SECTION("Adding and removing components moves the entity between archetypes")
+    {
+        World world;
+
+        const Entity entity = world.create(Position { .x = 3.0f }, Name { .value = "moved" });
+
+        REQUIRE(nullptr != world.add<Velocity>(entity, Velocity { .x = 5.0f }));
+        REQUIRE(3.0f == world.get<Position>(entity)->x);
+        REQUIRE(5.0f == world.get<Velocity>(entity)->x);
+        REQUIRE("moved" == world.get<Name>(entity)->value);
+
+        REQUIRE(true == world.remove<Position>(entity));
+        REQUIRE(false == world.remove<Position>(entity));
+        REQUIRE(false == world.has<Position>(entity));
+        REQUIRE(5.0f == world.get<Velocity>(entity)->x);
+        REQUIRE("moved" == world.get<Name>(entity)->value);
+
+        // adding a present component replaces it
+        world.add<Name>(entity, "renamed");
+        REQUIRE("renamed" == world.get<Name>(entity)->value);
+
+        // the way back uses the archetypes already created
+        const std::size_t archetypes_count = world.get_archetypes_count();
+        world.add<Position>(entity);
+        world.remove<Velocity>(entity);
+        world.add<Velocity>(entity);
+        REQUIRE(archetypes_count + 1u >= world.get_archetypes_count());
+    }
+
+    SECTION("A component can be added from the components of the entity")
+    {
+        World world;
+
+        const Entity entity = world.create(Name { .value = "a long name, which does not fit the small buffer" });
+
+        // replaced in place from its own current value
+        world.add<Name>(entity, *world.get<Name>(entity));
+        REQUIRE("a long name, which does not fit the small buffer" == world.get<Name>(entity)->value);
+
+        // the entity moves to another archetype, the argument refers to the row left behind
+        world.add<std::string>(entity, world.get<Name>(entity)->value);
+        REQUIRE("a long name, which does not fit the small buffer" == *world.get<std::string>(entity));
+        REQUIRE("a long name, which does not fit the small buffer" == world.get<Name>(entity)->value);
+    }
+
+    SECTION("Removing an entity keeps the others addressable")
+    {
+        World world;
+        std::vector<Entity> entities;
+
+        for (std::uint32_t i = 0u; i < 5000u; i++)
+        {
+            entities.push_back(world.create(Position { .x = static_cast<float>(i) }, Name { .value = std::to_string(i) }));
+        }
+
+        for (std::uint32_t i = 0u; i < 5000u; i += 3u)
+        {
+            world.destroy(entities[i]);
+        }
+
+        for (std::uint32_t i = 0u; i < 5000u; i++)
+        {
+            if (0u == i % 3u)
+            {
+                REQUIRE(false == world.is_alive(entities[i]));
+            }
+            else
+            {
+                REQUIRE(static_cast<float>(i) == world.get<Position>(entities[i])->x);
+                REQUIRE(std::to_string(i) == world.get<Name>(entities[i])->value);
+            }
+        }
+    }
+
+    SECTION("Components are destroyed with the world")
+    {
+        const std::shared_ptr<int> counter = std::make_shared<int>(0);
+
+        {
+            World world;
+
+            world.create(counter);
+            const Entity entity = world.create(counter, Tag {});
+            world.remove<Tag>(entity);
+
+            REQUIRE(3 == counter.use_count());
+        }
+
+        REQUIRE(1 == counter.use_count());
+    }
+
+    SECTION("World allocates through its resource")
+    {
+        lx::memory::Heap heap("ecs");
+
+        {
+            World world(heap);
+            world.create(Position {}, Big {});
+
+            REQUIRE(heap.get_size() >= Archetype::chunk_size);
+        }
+
+        REQUIRE(0u == heap.get_size());
+    }
+}
+
+TEST_CASE("World: queries", "[lx][ecs][World]")
+{
+    using namespace lx::ecs;
+
+    World world;
+
+    for (std::uint32_t i = 0u; i < 3000u; i++)
+    {
+        const Entity entity = world.create(Position { .x = static_cast<float>(i) }, Velocity { .x = 1.0f, .y = 2.0f });
+
+        if (0u == i % 2u)
+        {
+            world.add<Tag>(entity);
+        }
+    }
+    world.create(Position {});
+
+    SECTION("each visits every entity having the components")
+    {
+        world.each<Position, const Velocity>([](Position& position_a, const Velocity& velocity_a) {
+            position_a.x += velocity_a.x;
+            position_a.y += velocity_a.y;
+        });
+
+        std::size_t count = 0u;
+        float sum = 0.0f;
+        world.each<const Position>([&](Entity entity_a, const Position& position_a) {
+            REQUIRE(true == world.is_alive(entity_a));
+
+            count++;
+            sum += position_a.y;
+        });
+
+        REQUIRE(3001u == count);
+        REQUIRE(6000.0f == sum);
+
+        count = 0u;
+        world.each<Tag>([&](Tag&) { count++; });
+        REQUIRE(1500u == count);
+    }
+
+    SECTION("each_chunk gives arrays of up to a chunk of entities")
+    {
+        std::size_t count = 0u;
+
+        world.each_chunk<const Position, Velocity>([&](const View<const Position, Velocity>& view_a) {
+            REQUIRE(view_a.get_length() == view_a.get<const Position>().size());
+            REQUIRE(view_a.get_length() == view_a.get_entities().size());
+
+            for (Velocity& velocity : view_a.get<Velocity>())
+            {
+                velocity.x = 0.0f;
+            }
+
+            count += view_a.get_length();
+        });
+
+        REQUIRE(3000u == count);
+        world.each<const Velocity>([](const Velocity& velocity_a) { REQUIRE(0.0f == velocity_a.x); });
+    }
+
+    SECTION("Queries pick up archetypes created after them")
+    {
+        REQUIRE(2u == world.get_archetypes(Signature::of<Position, Velocity>()).size());
+
+        world.create(Position {}, Velocity {}, Name {});
+
+        REQUIRE(3u == world.get_archetypes(Signature::of<Position, Velocity>()).size());
+        REQUIRE(4u == world.get_archetypes(Signature::of<Position>()).size());
+    }
+}
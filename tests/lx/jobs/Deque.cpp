@@ -0,0 +1,130 @@
+// external
+#include <catch2/catch_test_macros.hpp>
+
+// lx
+#include <lx/jobs/Deque.hpp>
+
+// std
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+TEST_CASE("Deque<T, N>: push/pop/steal", "[lx][jobs][Deque<T, N>]")
+{
+    using namespace lx::jobs;
+
+    std::uint32_t values[4] = { 0u, 1u, 2u, 3u };
+
+    SECTION("Empty deque gives nothing")
+    {
+        Deque<std::uint32_t, 4u> deque;
+
+        REQUIRE(true == deque.is_empty());
+        REQUIRE(4u == deque.get_capacity());
+        REQUIRE(nullptr == deque.pop());
+        REQUIRE(nullptr == deque.steal());
+    }
+
+    SECTION("The owner pops the newest, thieves steal the oldest")
+    {
+        Deque<std::uint32_t, 4u> deque;
+
+        for (std::uint32_t& value : values)
+        {
+            REQUIRE(true == deque.push(&value));
+        }
+
+        REQUIRE(false == deque.push(&values[0]));
+        REQUIRE(4u == deque.get_length());
+
+        REQUIRE(&values[3] == deque.pop());
+        REQUIRE(&values[0] == deque.steal());
+        REQUIRE(&values[1] == deque.steal());
+        REQUIRE(&values[2] == deque.pop());
+        REQUIRE(nullptr == deque.pop());
+        REQUIRE(nullptr == deque.steal());
+
+        // the cells are reused after the wrap
+        REQUIRE(true == deque.push(&values[1]));
+        REQUIRE(&values[1] == deque.pop());
+    }
+}
+
+TEST_CASE("Deque<T, N>: concurrency", "[lx][jobs][Deque<T, N>]")
+{
+    using namespace lx::jobs;
+
+    SECTION("Every element is taken exactly once by the owner or one of the thieves")
+    {
+        constexpr std::uint32_t thieves_count = 3u;
+        constexpr std::uint32_t values_count = 50000u;
+
+        Deque<std::uint32_t, 64u> deque;
+        std::vector<std::uint32_t> values(values_count, 0u);
+        std::vector<std::atomic<std::uint32_t>> taken(values_count);
+        std::atomic<bool> done = false;
+        std::vector<std::thread> thieves;
+
+        for (std::uint32_t thief = 0u; thief < thieves_count; thief++)
+        {
+            thieves.emplace_back([&]() {
+                while (false == done.load(std::memory_order_acquire) || false == deque.is_empty())
+                {
+                    std::uint32_t* value = deque.steal();
+
+                    if (nullptr != value)
+                    {
+                        taken[*value].fetch_add(1u, std::memory_order_relaxed);
+                    }
+                    else
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+
+        for (std::uint32_t i = 0u; i < values_count; i++)
+        {
+            values[i] = i;
+
+            while (false == deque.push(&values[i]))
+            {
+                std::this_thread::yield();
+            }
+
+            // the owner takes some of its elements back, racing the thieves for the last one
+            if (0u == i % 5u)
+            {
+                std::uint32_t* value = deque.pop();
+
+                if (nullptr != value)
+                {
+                    taken[*value].fetch_add(1u, std::memory_order_relaxed);
+                }
+            }
+        }
+
+        done.store(true, std::memory_order_release);
+
+        for (std::thread& thief : thieves)
+        {
+            thief.join();
+        }
+
+        while (std::uint32_t* value = deque.pop())
+        {
+            taken[*value].fetch_add(1u, std::memory_order_relaxed);
+        }
+
+        bool once = true;
+
+        for (const std::atomic<std::uint32_t>& count : taken)
+        {
+            once = once && 1u == count.load(std::memory_order_relaxed);
+        }
+
+        REQUIRE(true == once);
+    }
+}
@@ -0,0 +1,194 @@
+// external
+#include <catch2/catch_test_macros.hpp>
+
+// lx
+#include <lx/jobs/Scheduler.hpp>
+
+// std
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+TEST_CASE("Scheduler: submit and wait", "[lx][jobs][Scheduler]")
+{
+    using namespace lx::jobs;
+
+    SECTION("Every job runs once before wait returns")
+    {
+        Scheduler scheduler(3u);
+        Counter counter;
+        std::vector<std::atomic<std::uint32_t>> runs(5000u);
+
+        REQUIRE(4u == scheduler.get_workers_count());
+        REQUIRE(true == counter.is_done());
+
+        // more jobs than the ring holds, the overflow runs on the submitting thread
+        for (std::size_t i = 0u; i < runs.size(); i++)
+        {
+            scheduler.submit(counter, [&runs, i]() { runs[i].fetch_add(1u, std::memory_order_relaxed); });
+        }
+
+        scheduler.wait(counter);
+
+        bool once = true;
+
+        for (const std::atomic<std::uint32_t>& count : runs)
+        {
+            once = once && 1u == count.load(std::memory_order_relaxed);
+        }
+
+        REQUIRE(true == once);
+        REQUIRE(true == counter.is_done());
+    }
+
+    SECTION("A counter can go away as soon as it is done")
+    {
+        Scheduler scheduler(3u);
+        std::atomic<std::uint32_t> runs = 0u;
+
+        // the last job must not touch the counter after it reads as done, sanitizers catch it otherwise
+        for (std::uint32_t i = 0u; i < 2000u; i++)
+        {
+            Counter counter;
+
+            scheduler.submit(counter, [&runs]() { runs.fetch_add(1u, std::memory_order_relaxed); });
+            scheduler.wait(counter);
+        }
+
+        REQUIRE(2000u == runs.load(std::memory_order_relaxed));
+    }
+
+    SECTION("Jobs queued when the scheduler goes away run on the destroying thread")
+    {
+        const std::shared_ptr<int> captured = std::make_shared<int>(0);
+        std::atomic<std::uint32_t> runs = 0u;
+        Counter counter;
+
+        {
+            // without workers nothing runs the jobs until the scheduler is destroyed
+            Scheduler scheduler(0u);
+
+            for (std::uint32_t i = 0u; i < 100u; i++)
+            {
+                scheduler.submit(counter, [captured, &runs]() { runs.fetch_add(1u, std::memory_order_relaxed); });
+            }
+
+            REQUIRE(101 == captured.use_count());
+        }
+
+        REQUIRE(1 == captured.use_count());
+        REQUIRE(100u == runs.load(std::memory_order_relaxed));
+        REQUIRE(true == counter.is_done());
+    }
+
+    SECTION("Without workers the waiting thread runs everything")
+    {
+        Scheduler scheduler(0u);
+        Counter counter;
+        std::uint32_t sum = 0u;
+
+        for (std::uint32_t i = 1u; i <= 100u; i++)
+        {
+            scheduler.submit(counter, [&sum, i]() { sum += i; });
+        }
+
+        scheduler.wait(counter);
+        REQUIRE(5050u == sum);
+    }
+
+    SECTION("Jobs fork, join and wait on the counters of other jobs")
+    {
+        Scheduler scheduler(3u);
+        Counter produced;
+        Counter consumed;
+        std::vector<std::uint32_t> values(64u, 0u);
+        std::atomic<std::uint32_t> sum = 0u;
+
+        for (std::uint32_t i = 0u; i < values.size(); i++)
+        {
+            scheduler.submit(produced, [&values, i]() { values[i] = i; });
+        }
+
+        // the consumer depends on the producers: it helps running them until they are done
+        scheduler.submit(consumed, [&scheduler, &produced, &values, &sum]() {
+            scheduler.wait(produced);
+
+            Counter children;
+
+            for (std::uint32_t i = 0u; i < values.size(); i++)
+            {
+                scheduler.submit(children, [&values, &sum, i]() { sum.fetch_add(values[i], std::memory_order_relaxed); });
+            }
+
+            scheduler.wait(children);
+        });
+
+        scheduler.wait(consumed);
+        REQUIRE(2016u == sum.load(std::memory_order_relaxed));
+    }
+}
+
+TEST_CASE("Scheduler: parallel_for", "[lx][jobs][Scheduler]")
+{
+    using namespace lx::jobs;
+
+    Scheduler scheduler(3u);
+
+    SECTION("Every index is visited once in ranges no longer than the grain")
+    {
+        std::vector<std::atomic<std::uint32_t>> visits(100003u);
+        std::atomic<bool> grain_kept = true;
+
+        scheduler.parallel_for(0u, visits.size(), 100u, [&](std::size_t begin_a, std::size_t end_a) {
+            grain_kept = grain_kept && end_a - begin_a <= 100u;
+
+            for (std::size_t i = begin_a; i < end_a; i++)
+            {
+                visits[i].fetch_add(1u, std::memory_order_relaxed);
+            }
+        });
+
+        bool once = true;
+
+        for (const std::atomic<std::uint32_t>& count : visits)
+        {
+            once = once && 1u == count.load(std::memory_order_relaxed);
+        }
+
+        REQUIRE(true == once);
+        REQUIRE(true == grain_kept);
+    }
+
+    SECTION("Empty and single ranges")
+    {
+        std::uint32_t calls = 0u;
+
+        scheduler.parallel_for(5u, 5u, 1u, [&calls](std::size_t, std::size_t) { calls++; });
+        REQUIRE(0u == calls);
+
+        scheduler.parallel_for(5u, 6u, 0u, [&calls](std::size_t begin_a, std::size_t end_a) { calls += 5u == begin_a && 6u == end_a; });
+        REQUIRE(1u == calls);
+    }
+
+    SECTION("Nested parallel_for")
+    {
+        std::atomic<std::uint64_t> sum = 0u;
+
+        scheduler.parallel_for(0u, 16u, 1u, [&](std::size_t begin_a, std::size_t end_a) {
+            for (std::size_t row = begin_a; row < end_a; row++)
+            {
+                scheduler.parallel_for(0u, 1000u, 10u, [&](std::size_t column_begin_a, std::size_t column_end_a) {
+                    for (std::size_t column = column_begin_a; column < column_end_a; column++)
+                    {
+                        sum.fetch_add(row * 1000u + column, std::memory_order_relaxed);
+                    }
+                });
+            }
+        });
+
+        REQUIRE(16000u * 15999u / 2u == sum.load(std::memory_order_relaxed));
+    }
+}
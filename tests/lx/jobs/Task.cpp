@@ -0,0 +1,160 @@
+// external
+#include <catch2/catch_test_macros.hpp>
+
+// lx
+#include <lx/jobs/Scheduler.hpp>
+#include <lx/jobs/Task.hpp>
+
+// std
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+using namespace lx::jobs;
+
+Task<std::uint32_t> get_fibonacci(std::uint32_t n_a)
+{
+    if (n_a < 2u)
+    {
+        co_return n_a;
+    }
+
+    const std::uint32_t a = co_await get_fibonacci(n_a - 1u);
+    const std::uint32_t b = co_await get_fibonacci(n_a - 2u);
+
+    co_return a + b;
+}
+
+Task<std::string> get_greeting(std::string name_a)
+{
+    co_return "hello " + name_a;
+}
+
+// forks jobs and suspends until they are done, the worker runs other jobs meanwhile
+Task<std::uint64_t> sum_in_jobs(Scheduler& scheduler_a, std::uint32_t count_a)
+{
+    std::vector<std::uint64_t> values(count_a, 0u);
+    Counter counter;
+
+    for (std::uint32_t i = 0u; i < count_a; i++)
+    {
+        scheduler_a.submit(counter, [&values, i]() { values[i] = i; });
+    }
+
+    co_await counter;
+
+    std::uint64_t sum = 0u;
+
+    for (const std::uint64_t value : values)
+    {
+        sum += value;
+    }
+
+    co_return sum;
+}
+
+Task<std::uint32_t> wait_for(Event& event_a, std::uint32_t value_a)
+{
+    co_await event_a;
+    co_return value_a;
+}
+} // namespace
+
+TEST_CASE("Task<T>: awaiting tasks", "[lx][jobs][Task<T>]")
+{
+    Scheduler scheduler(3u);
+
+    SECTION("run returns the result")
+    {
+        REQUIRE("hello lx" == scheduler.run(get_greeting("lx")));
+        REQUIRE(144u == scheduler.run(get_fibonacci(12u)));
+    }
+
+    SECTION("A task not awaited never starts")
+    {
+        bool started = false;
+
+        {
+            auto task = [](bool& started_a) -> Task<void> {
+                started_a = true;
+                co_return;
+            }(started);
+
+            REQUIRE(false == task.is_done());
+        }
+
+        REQUIRE(false == started);
+    }
+
+    SECTION("Tasks await counters of jobs")
+    {
+        REQUIRE(499500u == scheduler.run(sum_in_jobs(scheduler, 1000u)));
+    }
+
+    SECTION("Submitted tasks run in parallel and are joined with a counter")
+    {
+        Counter counter;
+        std::atomic<std::uint32_t> sum = 0u;
+
+        for (std::uint32_t i = 0u; i < 100u; i++)
+        {
+            scheduler.submit(counter, [](Scheduler& scheduler_a, std::atomic<std::uint32_t>& sum_a, std::uint32_t i_a) -> Task<void> {
+                co_await scheduler_a.schedule();
+
+                const std::uint32_t value = co_await get_fibonacci(i_a % 10u);
+                sum_a.fetch_add(value, std::memory_order_relaxed);
+            }(scheduler, sum, i));
+        }
+
+        scheduler.wait(counter);
+
+        // ten times the sum of the first ten fibonacci numbers
+        REQUIRE(880u == sum.load(std::memory_order_relaxed));
+    }
+}
+
+TEST_CASE("Task<T>: events", "[lx][jobs][Task<T>]")
+{
+    SECTION("An event set already does not suspend")
+    {
+        Scheduler scheduler(1u);
+        Event event;
+
+        event.set();
+        REQUIRE(true == event.is_set());
+        REQUIRE(7u == scheduler.run(wait_for(event, 7u)));
+
+        event.reset();
+        REQUIRE(false == event.is_set());
+    }
+
+    SECTION("Tasks are resumed by an event set on a thread outside of the scheduler")
+    {
+        Scheduler scheduler(2u);
+        Event event;
+        Counter counter;
+        std::atomic<std::uint32_t> sum = 0u;
+
+        for (std::uint32_t i = 0u; i < 50u; i++)
+        {
+            scheduler.submit(counter, [](Event& event_a, std::atomic<std::uint32_t>& sum_a, std::uint32_t i_a) -> Task<void> {
+                sum_a.fetch_add(co_await wait_for(event_a, i_a), std::memory_order_relaxed);
+            }(event, sum, i));
+        }
+
+        // stands for an I/O completion
+        std::thread completion([&event]() {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            event.set();
+        });
+
+        scheduler.wait(counter);
+        completion.join();
+
+        REQUIRE(1225u == sum.load(std::memory_order_relaxed));
+    }
+}
@@ -0,0 +1,116 @@
+// external
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+// lx
+#include <lx/math/Affine.hpp>
+#include <lx/math/Matrix.hpp>
+
+// std
+#include <cstddef>
+#include <vector>
+
+namespace {
+bool is_near(lx::math::Vector<float, 2u> left_a, lx::math::Vector<float, 2u> right_a)
+{
+    return Catch::Matchers::WithinAbs(right_a.x, 1e-5).match(left_a.x) && Catch::Matchers::WithinAbs(right_a.y, 1e-5).match(left_a.y);
+}
+bool is_near(const lx::math::Affine<float>& left_a, const lx::math::Affine<float>& right_a)
+{
+    return is_near(left_a.column_0, right_a.column_0) && is_near(left_a.column_1, right_a.column_1) &&
+           is_near(left_a.column_2, right_a.column_2);
+}
+
+// rotation by 90 degrees, scale (2, 3) and translation (5, 6)
+template<typename Type> constexpr lx::math::Affine<Type> transformation = {
+    .column_0 = { .x = 0, .y = 2 },
+    .column_1 = { .x = -3, .y = 0 },
+    .column_2 = { .x = 5, .y = 6 },
+};
+template<typename Type> constexpr lx::math::Affine<Type> general = {
+    .column_0 = { .x = 2, .y = 1 },
+    .column_1 = { .x = -1, .y = 4 },
+    .column_2 = { .x = 3, .y = -2 },
+};
+} // namespace
+
+TEST_CASE("Affine<T>: construction", "[lx][math][Affine<T>]")
+{
+    using namespace lx::math;
+
+    constexpr Vector<float, 2u> point { .x = 2.0f, .y = 1.0f };
+
+    SECTION("Matches the 3x3 constructors")
+    {
+        REQUIRE(Matrix<float, 3u>::translation({ .x = 3.0f, .y = -1.0f }) ==
+                static_cast<Matrix<float, 3u>>(Affine<float>::translation({ .x = 3.0f, .y = -1.0f })));
+        REQUIRE(Matrix<float, 3u>::scaling({ .x = 2.0f, .y = 3.0f }) ==
+                static_cast<Matrix<float, 3u>>(Affine<float>::scaling({ .x = 2.0f, .y = 3.0f })));
+        REQUIRE(Matrix<float, 3u>::rotation(0.5f) == static_cast<Matrix<float, 3u>>(Affine<float>::rotation(0.5f)));
+        REQUIRE(Matrix<float, 3u>::orthographic(0.0f, 800.0f, 600.0f, 0.0f) ==
+                static_cast<Matrix<float, 3u>>(Affine<float>::orthographic(0.0f, 800.0f, 600.0f, 0.0f)));
+    }
+    SECTION("Transforms points like the 3x3 and 4x4 matrices")
+    {
+        constexpr Vector<float, 2u> transformed = transform_point(transformation<float>, point);
+
+        REQUIRE(Vector<float, 2u> { .x = 2.0f, .y = 10.0f } == transformed);
+        REQUIRE(transformed == transform_point(static_cast<Matrix<float, 3u>>(transformation<float>), point));
+        REQUIRE(transformed == transform_point(static_cast<Matrix<float, 4u>>(transformation<float>), point));
+        REQUIRE(Vector<float, 2u> { .x = -3.0f, .y = 4.0f } == transform_vector(transformation<float>, point));
+    }
+}
+TEST_CASE("Affine<T>: algebra", "[lx][math][Affine<T>]")
+{
+    using namespace lx::math;
+
+    SECTION("Identity is neutral")
+    {
+        REQUIRE(general<float> == Affine<float>::identity * general<float>);
+        REQUIRE(general<float> == general<float> * Affine<float>::identity);
+        static_assert(general<float> == Affine<float>::identity * general<float>);
+        static_assert(general<float> != Affine<float>::identity);
+    }
+    SECTION("Composition matches the 3x3 product and the constant evaluated one")
+    {
+        constexpr Affine<float> constant_product = general<float> * transformation<float>;
+        const Affine<float> product = general<float> * transformation<float>;
+
+        const Matrix<float, 3u> matrix_product =
+            static_cast<Matrix<float, 3u>>(general<float>) * static_cast<Matrix<float, 3u>>(transformation<float>);
+
+        REQUIRE(constant_product == product);
+        REQUIRE(matrix_product == static_cast<Matrix<float, 3u>>(product));
+    }
+    SECTION("Determinant and inverse")
+    {
+        constexpr Affine<float> constant_inverse = inverted(general<float>);
+        static_assert(9.0f == determinant(general<float>));
+
+        REQUIRE(true == is_near(Affine<float>::identity, general<float> * constant_inverse));
+        REQUIRE(true == is_near(Affine<float>::identity, inverted(transformation<float>) * transformation<float>));
+        REQUIRE(determinant(static_cast<Matrix<float, 3u>>(general<float>)) == determinant(general<float>));
+    }
+}
+TEST_CASE("Affine<T>: transform_points", "[lx][math][Affine<T>]")
+{
+    using namespace lx::math;
+
+    for (std::size_t length = 0u; length < 11u; length++)
+    {
+        std::vector<Vector<float, 2u>> points;
+
+        for (std::size_t i = 0u; i < length; i++)
+        {
+            points.push_back({ .x = static_cast<float>(i), .y = 1.0f - static_cast<float>(i) * 0.5f });
+        }
+
+        std::vector<Vector<float, 2u>> transformed(length);
+        transform_points(general<float>, points, transformed);
+
+        for (std::size_t i = 0u; i < length; i++)
+        {
+            REQUIRE(transform_point(general<float>, points[i]) == transformed[i]);
+        }
+    }
+}
@@ -0,0 +1,189 @@
+// external
+#include <catch2/catch_test_macros.hpp>
+
+// lx
+#include <lx/math/Fixed.hpp>
+#include <lx/math/Matrix.hpp>
+#include <lx/math/Vector.hpp>
+
+// std
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numbers>
+
+namespace {
+using Q16_16 = lx::math::Fixed<16u, 16u>;
+using Q4_12 = lx::math::Fixed<4u, 12u>;
+using Wrapping = lx::math::Fixed<16u, 16u, lx::math::Overflow::check>;
+
+constexpr double step = 1.0 / 65536.0;
+
+// largest error of function_a against reference_a over the angles -range_a..range_a, in steps of 1 / 1024
+template<typename Function, typename Reference> double get_max_error(double range_a, Function function_a, Reference reference_a)
+{
+    double max_error = 0.0;
+
+    for (double angle = -range_a; angle <= range_a; angle += 1.0 / 1024.0)
+    {
+        const Q16_16 fixed { angle };
+        const double error = std::abs(static_cast<double>(function_a(fixed)) - reference_a(static_cast<double>(fixed)));
+
+        max_error = std::max(max_error, error);
+    }
+
+    return max_error;
+}
+} // namespace
+
+TEST_CASE("Fixed: conversions", "[lx][math][Fixed]")
+{
+    REQUIRE(Q16_16::raw_one == Q16_16 { 1 }.get_raw());
+    REQUIRE(98304 == Q16_16 { 1.5 }.get_raw());
+    REQUIRE(-98304 == Q16_16 { -1.5f }.get_raw());
+
+    // to the nearest step, halves away from zero
+    REQUIRE(1 == Q16_16 { step * 0.5 }.get_raw());
+    REQUIRE(-1 == Q16_16 { -step * 0.5 }.get_raw());
+    REQUIRE(0 == Q16_16 { step * 0.4 }.get_raw());
+
+    // back to integers toward zero, as floats do
+    REQUIRE(2 == static_cast<int>(Q16_16 { 2.75 }));
+    REQUIRE(-2 == static_cast<int>(Q16_16 { -2.75 }));
+    REQUIRE(-2.75 == static_cast<double>(Q16_16 { -2.75 }));
+
+    REQUIRE(Q4_12 { 7.999755859375 } == std::numeric_limits<Q4_12>::max());
+    REQUIRE(Q4_12 { -8 } == std::numeric_limits<Q4_12>::lowest());
+    REQUIRE(Q4_12::from_raw(1) == std::numeric_limits<Q4_12>::epsilon());
+}
+
+TEST_CASE("Fixed: arithmetic", "[lx][math][Fixed]")
+{
+    REQUIRE(Q16_16 { 3.75 } == Q16_16 { 1.5 } + Q16_16 { 2.25 });
+    REQUIRE(Q16_16 { -0.75 } == Q16_16 { 1.5 } - Q16_16 { 2.25 });
+    REQUIRE(Q16_16 { 3.375 } == Q16_16 { 1.5 } * Q16_16 { 2.25 });
+    REQUIRE(Q16_16 { -0.5 } == Q16_16 { 1.125 } / Q16_16 { -2.25 });
+    REQUIRE(Q16_16 { 1.5 } < Q16_16 { 2.25 });
+
+    // step / 2 * step / 2 rounds up to one step, step / 3 truncates to zero
+    REQUIRE(1 == (Q16_16::from_raw(256) * Q16_16::from_raw(128)).get_raw());
+    REQUIRE(0 == (Q16_16::from_raw(1) / Q16_16 { 3 }).get_raw());
+
+    Q16_16 value { 2 };
+    value += Q16_16 { 1 };
+    value *= Q16_16 { 0.5 };
+    value -= Q16_16 { 0.25 };
+    value /= Q16_16 { 0.5 };
+    REQUIRE(Q16_16 { 2.5 } == value);
+}
+
+TEST_CASE("Fixed: overflow", "[lx][math][Fixed]")
+{
+    constexpr Q4_12 max = std::numeric_limits<Q4_12>::max();
+    constexpr Q4_12 lowest = std::numeric_limits<Q4_12>::lowest();
+
+    SECTION("saturate")
+    {
+        REQUIRE(max == max + Q4_12 { 1 });
+        REQUIRE(lowest == lowest - Q4_12 { 1 });
+        REQUIRE(max == Q4_12 { 4 } * Q4_12 { 4 });
+        REQUIRE(lowest == Q4_12 { -4 } * Q4_12 { 4 });
+        REQUIRE(max == -lowest);
+        REQUIRE(max == Q4_12 { 100 });
+        REQUIRE(lowest == Q4_12 { -1e9 });
+    }
+    SECTION("check")
+    {
+        // in range the policy changes nothing
+        REQUIRE(Wrapping { 3.375 } == Wrapping { 1.5 } * Wrapping { 2.25 });
+        REQUIRE(Wrapping { -0.5 } == Wrapping { 1.125 } / Wrapping { -2.25 });
+    }
+}
+
+TEST_CASE("Fixed: sqrt", "[lx][math][Fixed]")
+{
+    REQUIRE(Q16_16 { 0 } == sqrt(Q16_16 { 0 }));
+    REQUIRE(Q16_16 { 3 } == sqrt(Q16_16 { 9 }));
+    REQUIRE(Q16_16 { 0.5 } == sqrt(Q16_16 { 0.25 }));
+    REQUIRE(Q4_12 { 2 } == sqrt(Q4_12 { 4 }));
+
+    double max_error = 0.0;
+
+    for (std::int32_t raw = 1; raw < std::numeric_limits<std::int32_t>::max() - 40009; raw += 40009)
+    {
+        const Q16_16 value = Q16_16::from_raw(raw);
+        max_error = std::max(max_error, std::abs(static_cast<double>(sqrt(value)) - std::sqrt(static_cast<double>(value))));
+    }
+
+    // rounded to the nearest step
+    REQUIRE(max_error <= step * 0.5);
+}
+
+TEST_CASE("Fixed: trigonometry", "[lx][math][Fixed]")
+{
+    const auto sine = [](Q16_16 angle_a) { return sin(angle_a); };
+    const auto cosine = [](Q16_16 angle_a) { return cos(angle_a); };
+
+    REQUIRE(get_max_error(1000.0, sine, [](double angle_a) { return std::sin(angle_a); }) <= step);
+    REQUIRE(get_max_error(1000.0, cosine, [](double angle_a) { return std::cos(angle_a); }) <= step);
+
+    double max_error = 0.0;
+
+    for (double angle = -std::numbers::pi; angle <= std::numbers::pi; angle += 1.0 / 1024.0)
+    {
+        for (const double radius : { 0.01, 1.0, 300.0 })
+        {
+            const Q16_16 y { radius * std::sin(angle) };
+            const Q16_16 x { radius * std::cos(angle) };
+            const double expected = std::atan2(static_cast<double>(y), static_cast<double>(x));
+
+            max_error = std::max(max_error, std::abs(static_cast<double>(atan2(y, x)) - expected));
+        }
+    }
+
+    REQUIRE(max_error <= step);
+    REQUIRE(Q16_16 {} == atan2(Q16_16 {}, Q16_16 {}));
+}
+
+TEST_CASE("Fixed: determinism", "[lx][math][Fixed]")
+{
+    // the compiler evaluates the same integer code, so compile time results equal the run time ones bit for bit
+    constexpr Q16_16 angle { 2.5 };
+    constexpr Q16_16 sine = sin(angle);
+    constexpr Q16_16 cosine = cos(angle);
+    constexpr Q16_16 root = sqrt(angle);
+    constexpr Q16_16 arc = atan2(sine, cosine);
+
+    volatile std::int32_t raw = angle.get_raw();
+    const Q16_16 runtime_angle = Q16_16::from_raw(raw);
+
+    REQUIRE(sine == sin(runtime_angle));
+    REQUIRE(cosine == cos(runtime_angle));
+    REQUIRE(root == sqrt(runtime_angle));
+    REQUIRE(arc == atan2(sin(runtime_angle), cos(runtime_angle)));
+}
+
+TEST_CASE("Fixed: Vector and Matrix elements", "[lx][math][Fixed]")
+{
+    using Vector2 = lx::math::Vector<Q16_16, 2u>;
+    using Matrix3 = lx::math::Matrix<Q16_16, 3u>;
+
+    const Vector2 vector { .x = Q16_16 { 3 }, .y = Q16_16 { 4 } };
+
+    REQUIRE(Q16_16 { 5 } == length(vector));
+    REQUIRE(Q16_16 { 25 } == dot(vector, vector));
+    REQUIRE(true == is_normalized(normalized(vector)));
+
+    const Vector2 rotated = transform_point(Matrix3::rotation(Q16_16 { std::numbers::pi / 2.0 }), Vector2 { .x = Q16_16 { 1 } });
+
+    REQUIRE(Q16_16 {} == rotated.x);
+    REQUIRE(Q16_16 { 1 } == rotated.y);
+
+    const Matrix3 translation = Matrix3::translation({ .x = Q16_16 { 2 }, .y = Q16_16 { -3 } });
+    const Matrix3 matrix = translation * Matrix3::scaling({ .x = Q16_16 { 2 }, .y = Q16_16 { 4 } });
+    const Matrix3 product = matrix * inverted(matrix);
+
+    REQUIRE(Q16_16 { 8 } == determinant(matrix));
+    REQUIRE(Matrix3::identity == product);
+}
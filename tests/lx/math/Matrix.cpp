@@ -6,7 +6,9 @@
 #include <lx/math/Matrix.hpp>
 
 // std
+#include <cstddef>
 #include <cstdint>
+#include <vector>
 
 TEST_CASE("Matrix<T, 2u>: construction", "[lx][math][Matrix<T, 2u>]")
 {
@@ -20,3 +22,294 @@ TEST_CASE("Matrix<T, 2u>: construction", "[lx][math][Matrix<T, 2u>]")
         REQUIRE(true == is_zero(mat.column_1));
     }
 }
+
+namespace {
+template<typename Type, std::size_t dimmensions>
+bool is_near(const lx::math::Matrix<Type, dimmensions>& left_a, const lx::math::Matrix<Type, dimmensions>& right_a)
+{
+    for (std::size_t column = 0u; column < dimmensions; column++)
+    {
+        for (std::size_t row = 0u; row < dimmensions; row++)
+        {
+            if (false == Catch::Matchers::WithinAbs(right_a[column][row], 1e-4).match(left_a[column][row]))
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+// rotation by 90 degrees around z, scale (2, 3, 4) and translation (5, 6, 7)
+template<typename Type> constexpr lx::math::Matrix<Type, 4u> transformation = {
+    .column_0 = { .x = 0, .y = 2, .z = 0, .w = 0 },
+    .column_1 = { .x = -3, .y = 0, .z = 0, .w = 0 },
+    .column_2 = { .x = 0, .y = 0, .z = 4, .w = 0 },
+    .column_3 = { .x = 5, .y = 6, .z = 7, .w = 1 },
+};
+template<typename Type> constexpr lx::math::Matrix<Type, 4u> general = {
+    .column_0 = { .x = 2, .y = 1, .z = 0, .w = 3 },
+    .column_1 = { .x = -1, .y = 4, .z = 2, .w = 0 },
+    .column_2 = { .x = 0, .y = 1, .z = 3, .w = -2 },
+    .column_3 = { .x = 1, .y = 0, .z = -1, .w = 5 },
+};
+template<typename Type> constexpr lx::math::Matrix<Type, 2u> general_2 = {
+    .column_0 = { .x = 2, .y = 1 },
+    .column_1 = { .x = -1, .y = 4 },
+};
+template<typename Type> constexpr lx::math::Matrix<Type, 3u> general_3 = {
+    .column_0 = { .x = 2, .y = 1, .z = 0 },
+    .column_1 = { .x = -1, .y = 4, .z = 2 },
+    .column_2 = { .x = 0, .y = 1, .z = 3 },
+};
+
+bool is_near(lx::math::Vector<float, 2u> left_a, lx::math::Vector<float, 2u> right_a)
+{
+    return Catch::Matchers::WithinAbs(right_a.x, 1e-5).match(left_a.x) && Catch::Matchers::WithinAbs(right_a.y, 1e-5).match(left_a.y);
+}
+} // namespace
+
+TEST_CASE("Matrix<T, 2u>: algebra", "[lx][math][Matrix<T, 2u>]")
+{
+    using namespace lx::math;
+
+    SECTION("Identity is neutral")
+    {
+        REQUIRE(general_2<float> == Matrix<float, 2u>::identity * general_2<float>);
+        REQUIRE(general_2<float> == general_2<float> * Matrix<float, 2u>::identity);
+        static_assert(general_2<float> == Matrix<float, 2u>::identity * general_2<float>);
+        static_assert(general_2<float> != Matrix<float, 2u>::identity);
+    }
+    SECTION("Transpose, determinant and inverse")
+    {
+        constexpr Matrix<float, 2u> constant_inverse = inverted(general_2<float>);
+        static_assert(9.0f == determinant(general_2<float>));
+
+        REQUIRE(Matrix<float, 2u> { .column_0 = { .x = 2.0f, .y = -1.0f }, .column_1 = { .x = 1.0f, .y = 4.0f } } ==
+                transposed(general_2<float>));
+        REQUIRE(true == is_near(Matrix<float, 2u>::identity, general_2<float> * constant_inverse));
+        REQUIRE(true == is_near(Matrix<double, 2u>::identity, inverted(general_2<double>) * general_2<double>));
+    }
+}
+TEST_CASE("Matrix<T, 3u>: algebra", "[lx][math][Matrix<T, 3u>]")
+{
+    using namespace lx::math;
+
+    SECTION("Identity is neutral")
+    {
+        REQUIRE(general_3<float> == Matrix<float, 3u>::identity * general_3<float>);
+        REQUIRE(general_3<float> == general_3<float> * Matrix<float, 3u>::identity);
+        static_assert(general_3<float> == Matrix<float, 3u>::identity * general_3<float>);
+        static_assert(general_3<float> != Matrix<float, 3u>::identity);
+    }
+    SECTION("Product matches the scalar and the constant evaluated one")
+    {
+        constexpr Matrix<float, 3u> constant_product = general_3<float> * transposed(general_3<float>);
+        const Matrix<double, 3u> scalar_product = general_3<double> * transposed(general_3<double>);
+
+        const Matrix<float, 3u> product = general_3<float> * transposed(general_3<float>);
+
+        REQUIRE(true == is_near(constant_product, product));
+
+        for (std::size_t column = 0u; column < 3u; column++)
+        {
+            for (std::size_t row = 0u; row < 3u; row++)
+            {
+                REQUIRE(Catch::Matchers::WithinAbs(scalar_product[column][row], 1e-4).match(product[column][row]));
+            }
+        }
+    }
+    SECTION("Determinant and inverse")
+    {
+        constexpr Matrix<float, 3u> constant_inverse = inverted(general_3<float>);
+        static_assert(23.0f == determinant(general_3<float>));
+
+        REQUIRE(23.0f == determinant(general_3<float>));
+        REQUIRE(true == is_near(Matrix<float, 3u>::identity, general_3<float> * constant_inverse));
+        REQUIRE(true == is_near(Matrix<float, 3u>::identity, inverted(general_3<float>) * general_3<float>));
+        REQUIRE(true == is_near(Matrix<double, 3u>::identity, general_3<double> * inverted(general_3<double>)));
+    }
+}
+TEST_CASE("Matrix<T, 3u>: 2D transforms", "[lx][math][Matrix<T, 3u>]")
+{
+    using namespace lx::math;
+
+    constexpr Vector<float, 2u> point { .x = 2.0f, .y = 1.0f };
+
+    SECTION("Translation, scaling and rotation")
+    {
+        constexpr Matrix<float, 3u> translation = Matrix<float, 3u>::translation({ .x = 3.0f, .y = -1.0f });
+        constexpr Matrix<float, 3u> scaling = Matrix<float, 3u>::scaling({ .x = 2.0f, .y = 3.0f });
+
+        static_assert(5.0f == transform_point(translation, point).x);
+
+        REQUIRE(Vector<float, 2u> { .x = 5.0f, .y = 0.0f } == transform_point(translation, point));
+        REQUIRE(Vector<float, 2u> { .x = 4.0f, .y = 3.0f } == transform_point(scaling, point));
+        REQUIRE(true == is_near(Vector<float, 2u> { .x = -1.0f, .y = 2.0f },
+                                transform_point(Matrix<float, 3u>::rotation(1.5707963f), point)));
+    }
+    SECTION("Products apply the right operand first")
+    {
+        const Matrix<float, 3u> scale_then_translate =
+            Matrix<float, 3u>::translation({ .x = 3.0f, .y = -1.0f }) * Matrix<float, 3u>::scaling({ .x = 2.0f, .y = 3.0f });
+
+        REQUIRE(Vector<float, 2u> { .x = 7.0f, .y = 2.0f } == transform_point(scale_then_translate, point));
+        REQUIRE(true == is_near(point, transform_point(inverted(scale_then_translate), Vector<float, 2u> { .x = 7.0f, .y = 2.0f })));
+    }
+    SECTION("orthographic maps the rectangle onto [-1, 1]")
+    {
+        constexpr Matrix<float, 3u> projection = Matrix<float, 3u>::orthographic(0.0f, 800.0f, 600.0f, 0.0f);
+
+        REQUIRE(Vector<float, 2u> { .x = -1.0f, .y = 1.0f } == transform_point(projection, Vector<float, 2u> { .x = 0.0f, .y = 0.0f }));
+        REQUIRE(Vector<float, 2u> { .x = 1.0f, .y = -1.0f } ==
+                transform_point(projection, Vector<float, 2u> { .x = 800.0f, .y = 600.0f }));
+        REQUIRE(Vector<float, 2u> { .x = 0.0f, .y = 0.0f } ==
+                transform_point(projection, Vector<float, 2u> { .x = 400.0f, .y = 300.0f }));
+    }
+}
+
+TEST_CASE("Matrix<T, 4u>: multiply", "[lx][math][Matrix<T, 4u>]")
+{
+    using namespace lx::math;
+
+    SECTION("Matrix times vector combines the columns")
+    {
+        const Vector<float, 4u> vector = transformation<float> * Vector<float, 4u> { .x = 1.0f, .y = 1.0f, .z = 1.0f, .w = 1.0f };
+
+        REQUIRE(Vector<float, 4u> { .x = 2.0f, .y = 8.0f, .z = 11.0f, .w = 1.0f } == vector);
+    }
+    SECTION("Identity is neutral")
+    {
+        REQUIRE(general<float> == Matrix<float, 4u>::identity * general<float>);
+        REQUIRE(general<float> == general<float> * Matrix<float, 4u>::identity);
+    }
+    SECTION("Product matches the scalar and the constant evaluated one")
+    {
+        constexpr Matrix<float, 4u> constant_product = general<float> * transformation<float>;
+        const Matrix<double, 4u> scalar_product = general<double> * transformation<double>;
+
+        const Matrix<float, 4u> product = general<float> * transformation<float>;
+
+        REQUIRE(true == is_near(constant_product, product));
+
+        for (std::size_t column = 0u; column < 4u; column++)
+        {
+            for (std::size_t row = 0u; row < 4u; row++)
+            {
+                REQUIRE(Catch::Matchers::WithinAbs(scalar_product[column][row], 1e-4).match(product[column][row]));
+            }
+        }
+    }
+    SECTION("(a * b) * v == a * (b * v)")
+    {
+        const Vector<float, 4u> vector { .x = 1.0f, .y = -2.0f, .z = 0.5f, .w = 1.0f };
+
+        REQUIRE((general<float> * transformation<float>) * vector == general<float> * (transformation<float> * vector));
+    }
+}
+TEST_CASE("Matrix<T, 4u>: transpose and inverse", "[lx][math][Matrix<T, 4u>]")
+{
+    using namespace lx::math;
+
+    SECTION("transposed swaps rows with columns")
+    {
+        const Matrix<float, 4u> transposed_matrix = transposed(general<float>);
+
+        for (std::size_t column = 0u; column < 4u; column++)
+        {
+            for (std::size_t row = 0u; row < 4u; row++)
+            {
+                REQUIRE(general<float>[row][column] == transposed_matrix[column][row]);
+            }
+        }
+
+        REQUIRE(general<float> == transposed(transposed_matrix));
+    }
+    SECTION("Matrix times its inverse is identity")
+    {
+        REQUIRE(true == is_near(Matrix<float, 4u>::identity, general<float> * inverted(general<float>)));
+        REQUIRE(true == is_near(Matrix<float, 4u>::identity, inverted(transformation<float>) * transformation<float>));
+        REQUIRE(true == is_near(Matrix<double, 4u>::identity, general<double> * inverted(general<double>)));
+    }
+    SECTION("Determinant matches the scalar and the constant evaluated one")
+    {
+        constexpr float constant_determinant = determinant(general<float>);
+
+        REQUIRE(1.0f == determinant(Matrix<float, 4u>::identity));
+        REQUIRE(24.0f == determinant(transformation<float>));
+        REQUIRE(constant_determinant == determinant(general<float>));
+        REQUIRE(determinant(general<double>) == static_cast<double>(determinant(general<float>)));
+        REQUIRE(Catch::Matchers::WithinAbs(1.0 / determinant(general<double>), 1e-6).match(determinant(inverted(general<float>))));
+    }
+    SECTION("Inverse matches the scalar and the constant evaluated one")
+    {
+        constexpr Matrix<float, 4u> constant_inverse = inverted(general<float>);
+        const Matrix<double, 4u> scalar_inverse = inverted(general<double>);
+
+        const Matrix<float, 4u> inverse = inverted(general<float>);
+
+        REQUIRE(true == is_near(constant_inverse, inverse));
+
+        for (std::size_t column = 0u; column < 4u; column++)
+        {
+            for (std::size_t row = 0u; row < 4u; row++)
+            {
+                REQUIRE(Catch::Matchers::WithinAbs(scalar_inverse[column][row], 1e-5).match(inverse[column][row]));
+            }
+        }
+    }
+}
+TEST_CASE("Matrix<T, 4u>: transform", "[lx][math][Matrix<T, 4u>]")
+{
+    using namespace lx::math;
+
+    SECTION("transform_point applies the translation")
+    {
+        REQUIRE(Vector<float, 3u> { .x = 2.0f, .y = 8.0f, .z = 11.0f } ==
+                transform_point(transformation<float>, Vector<float, 3u> { .x = 1.0f, .y = 1.0f, .z = 1.0f }));
+        REQUIRE(Vector<float, 2u> { .x = -1.0f, .y = 10.0f } ==
+                transform_point(transformation<float>, Vector<float, 2u> { .x = 2.0f, .y = 2.0f }));
+    }
+    SECTION("transform_points gives the same result as transform_point for every batch length")
+    {
+        for (std::size_t length = 0u; length < 11u; length++)
+        {
+            std::vector<Vector<float, 2u>> points;
+
+            for (std::size_t i = 0u; i < length; i++)
+            {
+                points.push_back({ .x = static_cast<float>(i), .y = 1.0f - static_cast<float>(i) * 0.5f });
+            }
+
+            std::vector<Vector<float, 2u>> transformed(length);
+            transform_points(general<float>, points, transformed);
+
+            for (std::size_t i = 0u; i < length; i++)
+            {
+                REQUIRE(transform_point(general<float>, points[i]) == transformed[i]);
+            }
+
+            // in place
+            transform_points(general<float>, points, points);
+            REQUIRE(transformed == points);
+        }
+    }
+    SECTION("transform and transform_points for 3 and 4 dimensional vectors")
+    {
+        const std::vector<Vector<float, 3u>> points = { { .x = 1.0f, .y = 1.0f, .z = 1.0f }, { .x = 0.0f, .y = 0.0f, .z = 0.0f } };
+        std::vector<Vector<float, 3u>> transformed_points(points.size());
+
+        transform_points(transformation<float>, points, transformed_points);
+
+        REQUIRE(Vector<float, 3u> { .x = 2.0f, .y = 8.0f, .z = 11.0f } == transformed_points[0]);
+        REQUIRE(Vector<float, 3u> { .x = 5.0f, .y = 6.0f, .z = 7.0f } == transformed_points[1]);
+
+        const std::vector<Vector<float, 4u>> vectors = { { .x = 1.0f, .y = 1.0f, .z = 1.0f, .w = 0.0f } };
+        std::vector<Vector<float, 4u>> transformed_vectors(vectors.size());
+
+        transform(transformation<float>, vectors, transformed_vectors);
+
+        REQUIRE(Vector<float, 4u> { .x = -3.0f, .y = 2.0f, .z = 4.0f, .w = 0.0f } == transformed_vectors[0]);
+    }
+}
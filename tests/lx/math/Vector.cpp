@@ -166,4 +166,118 @@ TEST_CASE("Vector<T, 2u>: functions", "[lx][common][math][Vector<T, 2u>]")
 
         REQUIRE(Catch::Matchers::WithinRel(length(vec)).match(1.0f));
     }
-}
\ No newline at end of file
+}TEST_CASE("Vector<T, 3u>: operators", "[lx][common][math][Vector<T, 3u>]")
+{
+    using namespace lx::math;
+
+    SECTION("operator- negates vector fields")
+    {
+        constexpr Vector<std::int32_t, 3u> vec { .x = 1, .y = 2, .z = 3 };
+        constexpr Vector<std::int32_t, 3u> vec_2 = -vec;
+
+        REQUIRE(-1 == vec_2.x);
+        REQUIRE(-2 == vec_2.y);
+        REQUIRE(-3 == vec_2.z);
+    }
+    SECTION("operator + and operator - work per field")
+    {
+        constexpr Vector<std::int32_t, 3u> vec_1 { .x = 10, .y = 20, .z = 30 };
+        constexpr Vector<std::int32_t, 3u> vec_2 { .x = 1, .y = 2, .z = 3 };
+
+        constexpr auto sum = vec_1 + vec_2;
+        constexpr auto difference = vec_1 - vec_2;
+
+        REQUIRE((11 == sum.x && 22 == sum.y && 33 == sum.z));
+        REQUIRE((9 == difference.x && 18 == difference.y && 27 == difference.z));
+    }
+}
+TEST_CASE("Vector<T, 3u>: functions", "[lx][common][math][Vector<T, 3u>]")
+{
+    using namespace lx::common;
+    using namespace lx::math;
+
+    SECTION("dot and cross match in constant evaluation and at runtime")
+    {
+        constexpr Vector<float, 3u> vec_1 { .x = 1.0f, .y = 2.0f, .z = 3.0f };
+        constexpr Vector<float, 3u> vec_2 { .x = -4.0f, .y = 5.0f, .z = 0.5f };
+
+        constexpr float constant_dot = dot(vec_1, vec_2);
+        constexpr Vector<float, 3u> constant_cross = cross(vec_1, vec_2);
+
+        REQUIRE(7.5f == constant_dot);
+        REQUIRE(Catch::Matchers::WithinRel(constant_dot).match(dot(vec_1, vec_2)));
+        REQUIRE(Vector<float, 3u> { .x = -14.0f, .y = -12.5f, .z = 13.0f } == constant_cross);
+        REQUIRE(constant_cross == cross(vec_1, vec_2));
+    }
+    SECTION("cross of the x and y axes is the z axis")
+    {
+        REQUIRE(Vector<double, 3u> { .z = 1.0 } == cross(Vector<double, 3u> { .x = 1.0 }, Vector<double, 3u> { .y = 1.0 }));
+    }
+    SECTION("normalize function normalizes vector length")
+    {
+        Vector<float, 3u> vec { .x = 1.0f, .y = 2.0f, .z = -2.0f };
+
+        normalize(out(vec));
+
+        REQUIRE(Catch::Matchers::WithinRel(1.0f).match(length(vec)));
+        REQUIRE(Catch::Matchers::WithinRel(-2.0f / 3.0f).match(vec.z));
+    }
+}
+TEST_CASE("Vector<T, 4u>: operators", "[lx][common][math][Vector<T, 4u>]")
+{
+    using namespace lx::math;
+
+    SECTION("operator- and operator+ keep every field")
+    {
+        constexpr Vector<std::int32_t, 4u> vec { .x = 1, .y = 2, .z = 3, .w = 4 };
+        constexpr Vector<std::int32_t, 4u> negated = -vec;
+        constexpr Vector<std::int32_t, 4u> same = +vec;
+
+        REQUIRE((-1 == negated.x && -2 == negated.y && -3 == negated.z && -4 == negated.w));
+        REQUIRE((1 == same.x && 2 == same.y && 3 == same.z && 4 == same.w));
+    }
+    SECTION("operator * and operator / scale every field")
+    {
+        constexpr Vector<std::int32_t, 4u> vec { .x = 2, .y = 4, .z = 6, .w = 8 };
+
+        constexpr auto scaled = 2 * vec;
+        constexpr auto divided = vec / 2;
+
+        REQUIRE((4 == scaled.x && 8 == scaled.y && 12 == scaled.z && 16 == scaled.w));
+        REQUIRE((1 == divided.x && 2 == divided.y && 3 == divided.z && 4 == divided.w));
+    }
+    SECTION("Vector<float, 4u> is aligned to its size")
+    {
+        REQUIRE(16u == alignof(Vector<float, 4u>));
+    }
+}
+TEST_CASE("Vector<T, 4u>: functions", "[lx][common][math][Vector<T, 4u>]")
+{
+    using namespace lx::math;
+
+    SECTION("dot, length and normalized")
+    {
+        constexpr Vector<float, 4u> vec { .x = 1.0f, .y = 2.0f, .z = 2.0f, .w = 4.0f };
+
+        constexpr float constant_dot = dot(vec, vec);
+
+        REQUIRE(25.0f == constant_dot);
+        REQUIRE(25.0f == dot(vec, vec));
+        REQUIRE(Catch::Matchers::WithinRel(5.0f).match(length(vec)));
+        REQUIRE(Vector<float, 4u> { .x = 0.2f, .y = 0.4f, .z = 0.4f, .w = 0.8f } == normalized(vec));
+        REQUIRE(true == is_normalized(normalized(vec)));
+    }
+    SECTION("lerp goes from start to end")
+    {
+        constexpr Vector<float, 4u> start { .x = 0.0f, .y = 2.0f, .z = 4.0f, .w = 8.0f };
+        constexpr Vector<float, 4u> end { .x = 2.0f, .y = 2.0f, .z = 0.0f, .w = 0.0f };
+
+        REQUIRE(start == lerp(start, end, 0.0f));
+        REQUIRE(end == lerp(start, end, 1.0f));
+        REQUIRE(Vector<float, 4u> { .x = 1.0f, .y = 2.0f, .z = 2.0f, .w = 4.0f } == lerp(start, end, 0.5f));
+
+        // the step converts to the type of the vectors instead of deducing it
+        REQUIRE(Vector<float, 4u> { .x = 1.0f, .y = 2.0f, .z = 2.0f, .w = 4.0f } == lerp(start, end, 0.5));
+        REQUIRE(Vector<float, 2u> { .x = 1.0f, .y = 1.0f } == lerp(Vector<float, 2u> {}, Vector<float, 2u> { .x = 2.0f, .y = 2.0f }, 0.5));
+    }
+}
@@ -0,0 +1,167 @@
+// external
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+// lx
+#include <lx/math/Affine.hpp>
+#include <lx/math/Matrix.hpp>
+#include <lx/math/Vector.hpp>
+#include <lx/math/batch.hpp>
+
+// std
+#include <cstddef>
+#include <vector>
+
+namespace {
+using namespace lx::math;
+
+bool is_near(float left_a, float right_a)
+{
+    return Catch::Matchers::WithinAbs(right_a, 1e-4).match(left_a);
+}
+bool is_near(Vector<float, 2u> left_a, Vector<float, 2u> right_a)
+{
+    return is_near(left_a.x, right_a.x) && is_near(left_a.y, right_a.y);
+}
+
+std::vector<Vector<float, 2u>> make_vectors(std::size_t length_a, float seed_a)
+{
+    std::vector<Vector<float, 2u>> vectors;
+
+    for (std::size_t i = 0u; i < length_a; i++)
+    {
+        const float value = static_cast<float>(i) + seed_a;
+        vectors.push_back({ .x = value * 0.5f - 3.0f, .y = 2.0f - value * 0.25f });
+    }
+
+    return vectors;
+}
+
+// structure of arrays copy of interleaved vectors
+struct Soa
+{
+    explicit Soa(const std::vector<Vector<float, 2u>>& vectors_a)
+    {
+        for (const Vector<float, 2u>& vector : vectors_a)
+        {
+            this->x.push_back(vector.x);
+            this->y.push_back(vector.y);
+        }
+    }
+
+    batch::Streams<float> get_streams()
+    {
+        return { .x = this->x, .y = this->y };
+    }
+
+    std::vector<float> x;
+    std::vector<float> y;
+};
+
+constexpr Matrix<float, 4u> transformation = {
+    .column_0 = { .x = 0.0f, .y = 2.0f, .z = 0.0f, .w = 0.0f },
+    .column_1 = { .x = -3.0f, .y = 0.0f, .z = 0.0f, .w = 0.0f },
+    .column_2 = { .x = 0.0f, .y = 0.0f, .z = 4.0f, .w = 0.0f },
+    .column_3 = { .x = 5.0f, .y = 6.0f, .z = 7.0f, .w = 1.0f },
+};
+
+constexpr Affine<float> affine = {
+    .column_0 = { .x = 2.0f, .y = 1.0f },
+    .column_1 = { .x = -1.0f, .y = 4.0f },
+    .column_2 = { .x = 3.0f, .y = -2.0f },
+};
+
+// every level supported here, lengths cover empty input, only remainders and full AVX-512 iterations with remainders
+constexpr std::size_t max_count = 37u;
+} // namespace
+
+TEST_CASE("batch: kernels match the per vector functions", "[lx][math][batch]")
+{
+    const batch::Level max_level = batch::get_max_level();
+
+    for (batch::Level level = batch::Level::base; level <= max_level; level = static_cast<batch::Level>(static_cast<int>(level) + 1))
+    {
+        batch::set_level(level);
+
+        for (std::size_t count = 0u; count <= max_count; count++)
+        {
+            const std::vector<Vector<float, 2u>> left = make_vectors(count, 1.0f);
+            const std::vector<Vector<float, 2u>> right = make_vectors(count, 7.5f);
+
+            Soa left_streams(left);
+            Soa right_streams(right);
+
+            std::vector<Vector<float, 2u>> result(count);
+            Soa result_streams(result);
+            std::vector<float> scalars(count);
+            std::vector<float> stream_scalars(count);
+
+            const auto check_vectors = [&](auto expected_a) {
+                for (std::size_t i = 0u; i < count; i++)
+                {
+                    const Vector<float, 2u> expected = expected_a(i);
+
+                    REQUIRE(true == is_near(expected, result[i]));
+                    REQUIRE(true == is_near(expected, Vector<float, 2u> { .x = result_streams.x[i], .y = result_streams.y[i] }));
+                }
+            };
+            const auto check_scalars = [&](auto expected_a) {
+                for (std::size_t i = 0u; i < count; i++)
+                {
+                    REQUIRE(true == is_near(expected_a(i), scalars[i]));
+                    REQUIRE(true == is_near(expected_a(i), stream_scalars[i]));
+                }
+            };
+
+            batch::add(left, right, result);
+            batch::add(left_streams.get_streams(), right_streams.get_streams(), result_streams.get_streams());
+            check_vectors([&](std::size_t i_a) { return left[i_a] + right[i_a]; });
+
+            batch::scale(left, 1.5f, result);
+            batch::scale(left_streams.get_streams(), 1.5f, result_streams.get_streams());
+            check_vectors([&](std::size_t i_a) { return left[i_a] * 1.5f; });
+
+            batch::lerp(left, right, 0.25f, result);
+            batch::lerp(left_streams.get_streams(), right_streams.get_streams(), 0.25f, result_streams.get_streams());
+            check_vectors([&](std::size_t i_a) { return lerp(left[i_a], right[i_a], 0.25f); });
+
+            batch::transform(transformation, left, result);
+            batch::transform(transformation, left_streams.get_streams(), result_streams.get_streams());
+            check_vectors([&](std::size_t i_a) { return transform_point(transformation, left[i_a]); });
+
+            batch::transform(affine, left, result);
+            batch::transform(affine, left_streams.get_streams(), result_streams.get_streams());
+            check_vectors([&](std::size_t i_a) { return transform_point(affine, left[i_a]); });
+
+            batch::normalize(right, result);
+            batch::normalize(right_streams.get_streams(), result_streams.get_streams());
+            check_vectors([&](std::size_t i_a) { return normalized(right[i_a]); });
+
+            batch::dot(left, right, scalars);
+            batch::dot(left_streams.get_streams(), right_streams.get_streams(), stream_scalars);
+            check_scalars([&](std::size_t i_a) { return dot(left[i_a], right[i_a]); });
+
+            batch::length(left, scalars);
+            batch::length(left_streams.get_streams(), stream_scalars);
+            check_scalars([&](std::size_t i_a) { return length(left[i_a]); });
+        }
+    }
+
+    batch::set_level(max_level);
+}
+TEST_CASE("batch: results can overwrite the inputs", "[lx][math][batch]")
+{
+    std::vector<Vector<float, 2u>> vectors = make_vectors(21u, 0.0f);
+    const std::vector<Vector<float, 2u>> expected = vectors;
+
+    Soa streams(vectors);
+
+    batch::transform(transformation, vectors, vectors);
+    batch::transform(transformation, streams.get_streams(), streams.get_streams());
+
+    for (std::size_t i = 0u; i < vectors.size(); i++)
+    {
+        REQUIRE(true == is_near(transform_point(transformation, expected[i]), vectors[i]));
+        REQUIRE(true == is_near(vectors[i], Vector<float, 2u> { .x = streams.x[i], .y = streams.y[i] }));
+    }
+}
@@ -0,0 +1,145 @@
+// external
+#include <catch2/catch_test_macros.hpp>
+
+// lx
+#include <lx/common/out.hpp>
+#include <lx/math/fast.hpp>
+#include <lx/math/simd.hpp>
+
+// std
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <numbers>
+
+namespace {
+using lx::math::fast;
+
+// largest error of approximation_a against reference_a over count_a evenly spread samples of [first_a, last_a], relative to
+// the expected value or, when relative_a is false, absolute
+template<typename Approximation, typename Reference>
+double get_max_error(float first_a,
+                     float last_a,
+                     std::size_t count_a,
+                     bool relative_a,
+                     Approximation approximation_a,
+                     Reference reference_a)
+{
+    double max_error = 0.0;
+
+    for (std::size_t i = 0u; i <= count_a; i++)
+    {
+        const float value = first_a + (last_a - first_a) * static_cast<float>(i) / static_cast<float>(count_a);
+        const double expected = reference_a(static_cast<double>(value));
+        const double error = std::abs(static_cast<double>(approximation_a(value)) - expected);
+
+        max_error = std::max(max_error, true == relative_a ? error / std::abs(expected) : error);
+    }
+
+    return max_error;
+}
+} // namespace
+
+TEST_CASE("fast: documented errors", "[lx][math][fast]")
+{
+    constexpr std::size_t samples = 100000u;
+
+    SECTION("rsqrt")
+    {
+        const auto reference = [](double value_a) { return 1.0 / std::sqrt(value_a); };
+        const auto high = [](float value_a) { return fast::rsqrt(value_a); };
+        const auto low = [](float value_a) { return fast::rsqrt<fast::Accuracy::low>(value_a); };
+
+        REQUIRE(get_max_error(1e-3f, 1e4f, samples, true, high, reference) < 5e-6);
+        REQUIRE(get_max_error(1e-3f, 1e4f, samples, true, low, reference) < 2e-3);
+    }
+    SECTION("sin and cos")
+    {
+        const auto sine = [](double value_a) { return std::sin(value_a); };
+        const auto cosine = [](double value_a) { return std::cos(value_a); };
+
+        const auto high_sine = [](float value_a) { return fast::sin(value_a); };
+        const auto high_cosine = [](float value_a) { return fast::cos(value_a); };
+        const auto low_sine = [](float value_a) { return fast::sin<fast::Accuracy::low>(value_a); };
+        const auto low_cosine = [](float value_a) { return fast::cos<fast::Accuracy::low>(value_a); };
+
+        REQUIRE(get_max_error(-8192.0f, 8192.0f, samples, false, high_sine, sine) < 1e-7);
+        REQUIRE(get_max_error(-8192.0f, 8192.0f, samples, false, high_cosine, cosine) < 1e-7);
+        REQUIRE(get_max_error(-8192.0f, 8192.0f, samples, false, low_sine, sine) < 4e-5);
+        REQUIRE(get_max_error(-8192.0f, 8192.0f, samples, false, low_cosine, cosine) < 4e-5);
+    }
+    SECTION("atan2 around the whole circle")
+    {
+        const auto reference = [](double angle_a) { return std::atan2(std::sin(angle_a), std::cos(angle_a)); };
+        const auto high = [](float angle_a) { return fast::atan2(3.0f * std::sin(angle_a), 3.0f * std::cos(angle_a)); };
+        const auto low = [](float angle_a) { return fast::atan2<fast::Accuracy::low>(std::sin(angle_a), std::cos(angle_a)); };
+
+        const float limit = std::numbers::pi_v<float> - 1e-3f;
+
+        REQUIRE(get_max_error(-limit, limit, samples, false, high, reference) < 2e-6);
+        REQUIRE(get_max_error(-limit, limit, samples, false, low, reference) < 4e-3);
+        REQUIRE(0.0f == fast::atan2(0.0f, 0.0f));
+    }
+    SECTION("exp")
+    {
+        const auto reference = [](double value_a) { return std::exp(value_a); };
+        const auto high = [](float value_a) { return fast::exp(value_a); };
+        const auto low = [](float value_a) { return fast::exp<fast::Accuracy::low>(value_a); };
+
+        REQUIRE(get_max_error(-87.0f, 88.0f, samples, true, high, reference) < 1e-7);
+        REQUIRE(get_max_error(-87.0f, 88.0f, samples, true, low, reference) < 6e-5);
+    }
+    SECTION("log")
+    {
+        const auto reference = [](double value_a) { return std::log(value_a); };
+        const auto high = [](float value_a) { return fast::log(value_a); };
+        const auto low = [](float value_a) { return fast::log<fast::Accuracy::low>(value_a); };
+
+        REQUIRE(get_max_error(0.37f, 2.71f, samples, false, high, reference) < 2e-7);
+        REQUIRE(get_max_error(0.37f, 2.71f, samples, false, low, reference) < 7e-5);
+        REQUIRE(get_max_error(3.0f, 1e30f, samples, true, high, reference) < 2e-7);
+        REQUIRE(get_max_error(3.0f, 1e30f, samples, true, low, reference) < 7e-5);
+    }
+}
+TEST_CASE("fast: precise, constant evaluation and vectors", "[lx][math][fast]")
+{
+    using namespace lx::math;
+
+    SECTION("precise calls the standard library")
+    {
+        REQUIRE(std::sin(0.7f) == fast::sin<fast::Accuracy::precise>(0.7f));
+        REQUIRE(std::atan2(0.5f, -2.0f) == fast::atan2<fast::Accuracy::precise>(0.5f, -2.0f));
+        REQUIRE(std::exp(1.5f) == fast::exp<fast::Accuracy::precise>(1.5f));
+    }
+    SECTION("Approximations are constant evaluated")
+    {
+        static_assert(fast::sin(0.0f) == 0.0f);
+        static_assert(fast::cos(0.0f) == 1.0f);
+        static_assert(fast::exp(0.0f) == 1.0f);
+        static_assert(fast::log(1.0f) == 0.0f);
+
+        constexpr float rsqrt = fast::rsqrt(4.0f);
+        REQUIRE(std::abs(rsqrt - 0.5f) < 5e-6f);
+    }
+    SECTION("sincos matches sin and cos")
+    {
+        float sine = 0.0f;
+        float cosine = 0.0f;
+
+        fast::sincos(-2.5f, lx::common::out(sine), lx::common::out(cosine));
+
+        REQUIRE(fast::sin(-2.5f) == sine);
+        REQUIRE(fast::cos(-2.5f) == cosine);
+    }
+    SECTION("rsqrt of four lanes")
+    {
+        float lanes[4] = { 0.25f, 1.0f, 2.0f, 1000.0f };
+
+        simd::store(lanes, fast::rsqrt(simd::load(lanes)));
+
+        REQUIRE(std::abs(lanes[0] - 2.0f) < 2.0f * 5e-6f);
+        REQUIRE(std::abs(lanes[1] - 1.0f) < 5e-6f);
+        REQUIRE(std::abs(lanes[2] - 1.0f / std::sqrt(2.0f)) < 5e-6f);
+        REQUIRE(std::abs(lanes[3] - 1.0f / std::sqrt(1000.0f)) < 5e-6f);
+    }
+}
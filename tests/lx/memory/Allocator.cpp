@@ -0,0 +1,99 @@
+// external
+#include <catch2/catch_test_macros.hpp>
+
+// lx
+#include <lx/containers/SmallVector.hpp>
+#include <lx/containers/String.hpp>
+#include <lx/containers/Vector.hpp>
+#include <lx/memory/Allocator.hpp>
+
+// std
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+TEST_CASE("Allocator<T>: containers", "[lx][memory][Allocator<T>]")
+{
+    using namespace lx::containers;
+    using namespace lx::memory;
+
+    SECTION("Vector allocates from the given resource and releases everything on destruction")
+    {
+        Heap heap("test");
+
+        {
+            Vector<std::uint32_t, 0u, Allocator<std::uint32_t>> vector(heap);
+
+            for (std::uint32_t i = 0u; i < 100u; i++)
+            {
+                vector.push_back(i);
+            }
+
+            REQUIRE(heap.get_size() >= 100u * sizeof(std::uint32_t));
+            REQUIRE(heap.get_allocations_count() > 0u);
+            REQUIRE(&heap == vector.get_allocator().get_resource());
+        }
+
+        REQUIRE(0u == heap.get_size());
+        REQUIRE(heap.get_peak_size() >= 100u * sizeof(std::uint32_t));
+    }
+
+    SECTION("Copied vector keeps drawing from the same resource")
+    {
+        Heap heap("test");
+
+        Vector<std::string, 0u, Allocator<std::string>> vector_1({ "a", "b" }, heap);
+        Vector<std::string, 0u, Allocator<std::string>> vector_2(vector_1);
+
+        REQUIRE(&heap == vector_2.get_allocator().get_resource());
+        REQUIRE("b" == vector_2[1]);
+    }
+
+    SECTION("Move assignment between different resources moves elements")
+    {
+        Heap heap_1("test 1");
+        Heap heap_2("test 2");
+
+        Vector<std::string, 0u, Allocator<std::string>> vector_1({ "a", "b" }, heap_1);
+        Vector<std::string, 0u, Allocator<std::string>> vector_2(heap_2);
+
+        vector_2 = std::move(vector_1);
+
+        REQUIRE(2u == vector_2.get_length());
+        REQUIRE("a" == vector_2[0]);
+        REQUIRE(&heap_2 == vector_2.get_allocator().get_resource());
+        REQUIRE(true == vector_1.is_empty());
+    }
+
+    SECTION("SmallVector draws from the resource only after spilling")
+    {
+        Heap heap("test");
+        SmallVector<std::uint32_t, 4u, Allocator<std::uint32_t>> vector(heap);
+
+        for (std::uint32_t i = 0u; i < 4u; i++)
+        {
+            vector.push_back(i);
+        }
+
+        REQUIRE(0u == heap.get_allocations_count());
+
+        vector.push_back(4u);
+
+        REQUIRE(1u == heap.get_allocations_count());
+    }
+
+    SECTION("String allocates from the given resource")
+    {
+        Heap heap("test");
+
+        {
+            String<char, 0u, Allocator<char>> string("test", heap);
+            string.push_back(" of a string too long for the object");
+
+            REQUIRE(0 == std::strncmp("test of a string too long for the object", string.get_cstring(), string.get_length()));
+            REQUIRE(heap.get_size() > 0u);
+        }
+
+        REQUIRE(0u == heap.get_size());
+    }
+}
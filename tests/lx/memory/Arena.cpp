@@ -0,0 +1,139 @@
+// external
+#include <catch2/catch_test_macros.hpp>
+
+// lx
+#include <lx/containers/String.hpp>
+#include <lx/containers/Vector.hpp>
+#include <lx/memory/Allocator.hpp>
+#include <lx/memory/Arena.hpp>
+
+// std
+#include <cstdint>
+#include <cstring>
+
+TEST_CASE("Arena: allocation", "[lx][memory][Arena]")
+{
+    using namespace lx::memory;
+
+    SECTION("Allocations are bumped from the block with requested alignment")
+    {
+        Arena arena(1024u);
+
+        void* p1 = arena.allocate(3u, 1u);
+        void* p2 = arena.allocate(16u, 16u);
+        void* p3 = arena.allocate(8u, 8u);
+
+        REQUIRE(nullptr != p1);
+        REQUIRE(0u == reinterpret_cast<std::uintptr_t>(p2) % 16u);
+        REQUIRE(0u == reinterpret_cast<std::uintptr_t>(p3) % 8u);
+        REQUIRE(static_cast<std::byte*>(p2) > static_cast<std::byte*>(p1));
+        REQUIRE(static_cast<std::byte*>(p3) >= static_cast<std::byte*>(p2) + 16u);
+        REQUIRE(arena.get_size() <= 48u);
+    }
+
+    SECTION("Deallocating the most recent allocation rewinds the arena")
+    {
+        Arena arena(1024u);
+
+        void* p1 = arena.allocate(32u, 8u);
+        const std::size_t size = arena.get_size();
+        void* p2 = arena.allocate(64u, 8u);
+
+        arena.deallocate(p2, 64u, 8u);
+        REQUIRE(size == arena.get_size());
+
+        arena.deallocate(p1, 32u, 8u);
+        REQUIRE(0u == arena.get_size());
+    }
+
+    SECTION("reset releases everything and keeps peak size")
+    {
+        Arena arena(1024u);
+
+        std::ignore = arena.allocate(100u, 4u);
+        std::ignore = arena.allocate(200u, 4u);
+        arena.reset();
+
+        REQUIRE(0u == arena.get_size());
+        REQUIRE(300u <= arena.get_peak_size());
+    }
+
+    SECTION("Allocations that do not fit are served by the upstream resource until reset")
+    {
+        Heap heap("upstream");
+
+        {
+            Arena arena(64u, heap);
+            const std::size_t block_size = heap.get_size();
+
+            void* p = arena.allocate(256u, 32u);
+            std::memset(p, 0xAB, 256u);
+
+            REQUIRE(0u == reinterpret_cast<std::uintptr_t>(p) % 32u);
+            REQUIRE(1u == arena.get_overflows_count());
+            REQUIRE(heap.get_size() > block_size);
+
+            arena.reset();
+
+            REQUIRE(block_size == heap.get_size());
+        }
+
+        REQUIRE(0u == heap.get_size());
+    }
+}
+TEST_CASE("Arena: containers", "[lx][memory][Arena]")
+{
+    using namespace lx::containers;
+    using namespace lx::memory;
+
+    SECTION("Vector backed by an arena does not touch the heap")
+    {
+        Heap heap("upstream");
+        Arena arena(4096u, heap);
+
+        const std::size_t allocations_count = heap.get_allocations_count();
+
+        Vector<std::uint32_t, 0u, Allocator<std::uint32_t>> vector(arena);
+
+        for (std::uint32_t i = 0u; i < 256u; i++)
+        {
+            vector.push_back(i);
+        }
+
+        REQUIRE(allocations_count == heap.get_allocations_count());
+        REQUIRE(255u == vector.get_back());
+    }
+
+    SECTION("String backed by an arena")
+    {
+        Arena arena(256u);
+        String<char, 0u, Allocator<char>> string("frame", arena);
+
+        string.push_back(" data, too long for the object");
+
+        REQUIRE(0 == std::strncmp("frame data, too long for the object", string.get_cstring(), string.get_length()));
+        REQUIRE(0u < arena.get_size());
+    }
+}
+TEST_CASE("FrameArena<N>", "[lx][memory][FrameArena<N>]")
+{
+    using namespace lx::memory;
+
+    SECTION("Memory survives frames_count - 1 frame switches")
+    {
+        FrameArena<2u> arena(256u);
+
+        auto* value = static_cast<std::uint32_t*>(arena.allocate(sizeof(std::uint32_t), alignof(std::uint32_t)));
+        *value = 0xC0FFEEu;
+
+        arena.next_frame();
+
+        REQUIRE(0u == arena.get_current().get_size());
+        REQUIRE(0xC0FFEEu == *value);
+
+        std::ignore = arena.allocate(16u, 4u);
+        arena.next_frame();
+
+        REQUIRE(0u == arena.get_current().get_size());
+    }
+}
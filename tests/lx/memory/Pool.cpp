@@ -0,0 +1,143 @@
+// external
+#include <catch2/catch_test_macros.hpp>
+
+// lx
+#include <lx/memory/Pool.hpp>
+
+// std
+#include <cstdint>
+#include <memory>
+#include <string>
+
+TEST_CASE("Pool<T>: create/destroy", "[lx][memory][Pool<T>]")
+{
+    using namespace lx::memory;
+
+    SECTION("Default handle is null and never valid")
+    {
+        Pool<std::string> pool(4u);
+        Pool<std::string>::Handle handle;
+
+        REQUIRE(true == handle.is_null());
+        REQUIRE(false == pool.is_valid(handle));
+        REQUIRE(nullptr == pool.get(handle));
+    }
+
+    SECTION("create constructs object accessible through handle")
+    {
+        Pool<std::string> pool(4u);
+
+        auto handle = pool.create("object");
+
+        REQUIRE(true == pool.is_valid(handle));
+        REQUIRE("object" == *pool.get(handle));
+        REQUIRE(1u == pool.get_length());
+    }
+
+    SECTION("create fails when pool is full")
+    {
+        Pool<std::uint32_t> pool(2u);
+
+        REQUIRE(false == pool.create(1u).is_null());
+        REQUIRE(false == pool.create(2u).is_null());
+        REQUIRE(true == pool.is_full());
+        REQUIRE(true == pool.create(3u).is_null());
+    }
+
+    SECTION("destroy invalidates handle and reused slot gets a new generation")
+    {
+        Pool<std::uint32_t> pool(1u);
+
+        auto handle_1 = pool.create(1u);
+        REQUIRE(true == pool.destroy(handle_1));
+        REQUIRE(false == pool.is_valid(handle_1));
+        REQUIRE(false == pool.destroy(handle_1));
+
+        auto handle_2 = pool.create(2u);
+
+        REQUIRE(handle_1.get_index() == handle_2.get_index());
+        REQUIRE(handle_1 != handle_2);
+        REQUIRE(nullptr == pool.get(handle_1));
+        REQUIRE(2u == *pool.get(handle_2));
+    }
+
+    SECTION("Slots are retired before their generation wraps")
+    {
+        Pool<std::uint32_t> pool(2u);
+
+        const Pool<std::uint32_t>::Handle first = pool.create(0u);
+        Pool<std::uint32_t>::Handle handle = first;
+
+        for (std::uint32_t i = 0u; i < Pool<std::uint32_t>::Handle::generation_mask; i++)
+        {
+            REQUIRE(true == pool.destroy(handle));
+            handle = pool.create(i);
+        }
+
+        REQUIRE(first.get_index() != handle.get_index());
+        REQUIRE(false == pool.is_valid(first));
+        REQUIRE(true == pool.is_full());
+    }
+
+        SECTION("destroy runs object destructor")
+    {
+        auto counter = std::make_shared<int>(0);
+        Pool<std::shared_ptr<int>, std::uint64_t> pool(4u);
+
+        auto handle = pool.create(counter);
+        REQUIRE(2 == counter.use_count());
+
+        pool.destroy(handle);
+        REQUIRE(1 == counter.use_count());
+    }
+
+    SECTION("Objects keep their address when others are destroyed")
+    {
+        Pool<std::uint32_t> pool(4u);
+
+        auto handle_1 = pool.create(1u);
+        auto handle_2 = pool.create(2u);
+        const std::uint32_t* object_2 = pool.get(handle_2);
+
+        pool.destroy(handle_1);
+
+        REQUIRE(object_2 == pool.get(handle_2));
+        REQUIRE(handle_2 == pool.get_handle(object_2));
+    }
+
+    SECTION("get_handle rejects pointers not owned by the pool")
+    {
+        Pool<std::uint32_t> pool(4u);
+        std::uint32_t value = 0u;
+
+        REQUIRE(true == pool.get_handle(&value).is_null());
+    }
+}
+TEST_CASE("Pool<T>: iteration", "[lx][memory][Pool<T>]")
+{
+    using namespace lx::memory;
+
+    Pool<std::uint32_t> pool(8u);
+
+    Pool<std::uint32_t>::Handle handles[8];
+    for (std::uint32_t i = 0u; i < 8u; i++)
+    {
+        handles[i] = pool.create(i);
+    }
+
+    pool.destroy(handles[1]);
+    pool.destroy(handles[4]);
+    pool.destroy(handles[7]);
+
+    std::uint32_t sum = 0u;
+    std::size_t count = 0u;
+
+    for (std::uint32_t value : pool)
+    {
+        sum += value;
+        count++;
+    }
+
+    REQUIRE(5u == count);
+    REQUIRE(0u + 2u + 3u + 5u + 6u == sum);
+}
@@ -0,0 +1,107 @@
+// external
+#include <catch2/catch_test_macros.hpp>
+
+// lx
+#include <lx/physics/DynamicTree.hpp>
+
+// std
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace {
+lx::physics::Aabb make_box(float x_a, float y_a, float size_a)
+{
+    return { .min = { .x = x_a, .y = y_a }, .max = { .x = x_a + size_a, .y = y_a + size_a } };
+}
+} // namespace
+
+TEST_CASE("DynamicTree: queries", "[lx][physics][DynamicTree]")
+{
+    using namespace lx::physics;
+
+    SECTION("Fat boxes contain the bodies")
+    {
+        DynamicTree tree(0.5f);
+
+        const std::uint32_t proxy = tree.create(make_box(0.0f, 0.0f, 1.0f));
+
+        REQUIRE(1u == tree.get_length());
+        REQUIRE(true == tree.get_fat_aabb(proxy).contains(make_box(-0.5f, -0.5f, 2.0f)));
+
+        // small moves stay inside the fat box, a move out of it stretches the new one along the displacement
+        REQUIRE(false == tree.move(proxy, make_box(0.2f, 0.2f, 1.0f)));
+        REQUIRE(true == tree.move(proxy, make_box(5.0f, 0.0f, 1.0f), { .x = 1.0f, .y = 0.0f }));
+        REQUIRE(true == tree.get_fat_aabb(proxy).contains(make_box(5.0f, 0.0f, 1.0f).get_swept({ .x = 2.0f, .y = 0.0f })));
+
+        tree.destroy(proxy);
+        REQUIRE(0u == tree.get_length());
+        REQUIRE(0u == tree.get_height());
+    }
+
+    SECTION("Queries match brute force while the proxies move")
+    {
+        DynamicTree tree(0.1f);
+        std::mt19937 random(7u);
+        std::uniform_real_distribution<float> position(0.0f, 100.0f);
+        std::uniform_real_distribution<float> step(-1.0f, 1.0f);
+
+        std::vector<std::uint32_t> proxies;
+        std::vector<Aabb> boxes;
+
+        for (std::size_t i = 0u; i < 2000u; i++)
+        {
+            boxes.push_back(make_box(position(random), position(random), 1.0f));
+            proxies.push_back(tree.create(boxes.back()));
+        }
+
+        // the rotations keep the tree shallow
+        REQUIRE(tree.get_height() < 3u * static_cast<std::size_t>(std::log2(2000.0f)));
+
+        for (std::size_t frame = 0u; frame < 10u; frame++)
+        {
+            for (std::size_t i = 0u; i < boxes.size(); i++)
+            {
+                const lx::math::Vector<float, 2u> displacement = { .x = step(random), .y = step(random) };
+
+                boxes[i] = make_box(boxes[i].min.x + displacement.x, boxes[i].min.y + displacement.y, 1.0f);
+                tree.move(proxies[i], boxes[i], displacement);
+            }
+
+            // destroying and creating again reuses the nodes
+            for (std::size_t i = frame; i < boxes.size(); i += 50u)
+            {
+                tree.destroy(proxies[i]);
+                proxies[i] = tree.create(boxes[i]);
+            }
+
+            bool matches = true;
+
+            for (std::size_t query = 0u; query < 100u; query++)
+            {
+                const Aabb area = make_box(position(random), position(random), 5.0f);
+
+                std::vector<std::uint32_t> found;
+                tree.query(area, [&](std::uint32_t proxy_a) { found.push_back(proxy_a); });
+
+                // every body overlapping the area is found, everything found has a fat box overlapping it
+                for (std::size_t i = 0u; i < boxes.size(); i++)
+                {
+                    const bool is_found = found.end() != std::find(found.begin(), found.end(), proxies[i]);
+
+                    matches = matches && true == tree.get_fat_aabb(proxies[i]).contains(boxes[i]);
+                    matches = matches && (false == boxes[i].overlaps(area) || true == is_found);
+                    matches = matches && (false == is_found || true == tree.get_fat_aabb(proxies[i]).overlaps(area));
+                }
+            }
+
+            REQUIRE(true == matches);
+        }
+
+        REQUIRE(2000u == tree.get_length());
+        REQUIRE(tree.get_height() < 3u * static_cast<std::size_t>(std::log2(2000.0f)));
+    }
+}
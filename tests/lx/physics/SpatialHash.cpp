@@ -0,0 +1,107 @@
+// external
+#include <catch2/catch_test_macros.hpp>
+
+// lx
+#include <lx/physics/SpatialHash.hpp>
+
+// std
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace {
+lx::physics::Aabb make_box(float x_a, float y_a, float size_a)
+{
+    return { .min = { .x = x_a, .y = y_a }, .max = { .x = x_a + size_a, .y = y_a + size_a } };
+}
+} // namespace
+
+TEST_CASE("SpatialHash: queries", "[lx][physics][SpatialHash]")
+{
+    using namespace lx::physics;
+
+    SECTION("A proxy in several cells is reported once")
+    {
+        SpatialHash grid(1.0f, 0.1f);
+
+        const std::uint32_t proxy = grid.create(make_box(-0.5f, -0.5f, 1.0f));
+        REQUIRE(4u == grid.get_cells_count());
+
+        std::size_t count = 0u;
+        grid.query(make_box(-2.0f, -2.0f, 4.0f), [&](std::uint32_t proxy_a) { count += proxy == proxy_a ? 1u : 0u; });
+        REQUIRE(1u == count);
+
+        REQUIRE(false == grid.move(proxy, make_box(-0.45f, -0.45f, 1.0f)));
+        REQUIRE(true == grid.move(proxy, make_box(10.0f, 10.0f, 1.0f)));
+
+        count = 0u;
+        grid.query(make_box(-2.0f, -2.0f, 4.0f), [&](std::uint32_t) { count++; });
+        REQUIRE(0u == count);
+
+        grid.query(make_box(9.0f, 9.0f, 4.0f), [&](std::uint32_t) { count++; });
+        REQUIRE(1u == count);
+
+        grid.destroy(proxy);
+        REQUIRE(0u == grid.get_length());
+    }
+
+    SECTION("Queries match brute force while the proxies move")
+    {
+        SpatialHash grid(2.0f, 0.1f);
+        std::mt19937 random(11u);
+        std::uniform_real_distribution<float> position(-50.0f, 50.0f);
+        std::uniform_real_distribution<float> step(-1.0f, 1.0f);
+
+        std::vector<std::uint32_t> proxies;
+        std::vector<Aabb> boxes;
+
+        for (std::size_t i = 0u; i < 2000u; i++)
+        {
+            boxes.push_back(make_box(position(random), position(random), 1.0f));
+            proxies.push_back(grid.create(boxes.back()));
+        }
+
+        for (std::size_t frame = 0u; frame < 10u; frame++)
+        {
+            for (std::size_t i = 0u; i < boxes.size(); i++)
+            {
+                const lx::math::Vector<float, 2u> displacement = { .x = step(random), .y = step(random) };
+
+                boxes[i] = make_box(boxes[i].min.x + displacement.x, boxes[i].min.y + displacement.y, 1.0f);
+                grid.move(proxies[i], boxes[i], displacement);
+            }
+
+            for (std::size_t i = frame; i < boxes.size(); i += 50u)
+            {
+                grid.destroy(proxies[i]);
+                proxies[i] = grid.create(boxes[i]);
+            }
+
+            bool matches = true;
+
+            for (std::size_t query = 0u; query < 100u; query++)
+            {
+                const Aabb area = make_box(position(random), position(random), 5.0f);
+
+                std::vector<std::uint32_t> found;
+                grid.query(area, [&](std::uint32_t proxy_a) { found.push_back(proxy_a); });
+
+                for (std::size_t i = 0u; i < boxes.size(); i++)
+                {
+                    const std::size_t count = static_cast<std::size_t>(std::count(found.begin(), found.end(), proxies[i]));
+
+                    matches = matches && true == grid.get_fat_aabb(proxies[i]).contains(boxes[i]);
+                    matches = matches && count <= 1u;
+                    matches = matches && (false == boxes[i].overlaps(area) || 1u == count);
+                    matches = matches && (0u == count || true == grid.get_fat_aabb(proxies[i]).overlaps(area));
+                }
+            }
+
+            REQUIRE(true == matches);
+        }
+
+        REQUIRE(2000u == grid.get_length());
+    }
+}
@@ -0,0 +1,156 @@
+// external
+#include <catch2/catch_test_macros.hpp>
+
+// lx
+#include <lx/physics/world.hpp>
+
+// std
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
+namespace {
+lx::physics::Aabb make_box(float x_a, float y_a, float size_a)
+{
+    return { .min = { .x = x_a, .y = y_a }, .max = { .x = x_a + size_a, .y = y_a + size_a } };
+}
+
+// every pair of overlapping bodies is reported, every reported pair has overlapping fat boxes
+bool check_pairs(const lx::physics::world& world_a,
+                 const std::vector<lx::physics::world::Id>& ids_a,
+                 const std::vector<lx::physics::Aabb>& boxes_a,
+                 const std::vector<bool>& alive_a)
+{
+    std::set<std::pair<lx::physics::world::Id, lx::physics::world::Id>> reported;
+
+    for (const lx::physics::world::Pair& pair : world_a.get_pairs())
+    {
+        if (pair.first >= pair.second || false == reported.insert({ pair.first, pair.second }).second ||
+            false == world_a.get_fat_bounds(pair.first).overlaps(world_a.get_fat_bounds(pair.second)))
+        {
+            return false;
+        }
+    }
+
+    for (std::size_t i = 0u; i < ids_a.size(); i++)
+    {
+        for (std::size_t j = i + 1u; j < ids_a.size(); j++)
+        {
+            if (true == alive_a[i] && true == alive_a[j] && true == boxes_a[i].overlaps(boxes_a[j]) &&
+                0u == reported.count({ std::min(ids_a[i], ids_a[j]), std::max(ids_a[i], ids_a[j]) }))
+            {
+                return false;
+            }
+        }
+    }
+
+    for (const auto& [first, second] : reported)
+    {
+        bool is_alive = false;
+
+        for (std::size_t i = 0u; i < ids_a.size(); i++)
+        {
+            is_alive = is_alive || (true == alive_a[i] && (first == ids_a[i] || second == ids_a[i]));
+        }
+
+        if (false == is_alive)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+} // namespace
+
+TEST_CASE("world: pairs", "[lx][physics][world]")
+{
+    using namespace lx::physics;
+
+    for (const world::Broadphase broadphase : { world::Broadphase::tree, world::Broadphase::grid })
+    {
+        world world({ .broadphase = broadphase, .margin = 0.1f, .cell_size = 2.0f });
+
+        SECTION("Overlapping bodies make a pair until they part")
+        {
+            const world::Id first = world.create(make_box(0.0f, 0.0f, 1.0f));
+            const world::Id second = world.create(make_box(0.5f, 0.5f, 1.0f));
+            const world::Id third = world.create(make_box(10.0f, 10.0f, 1.0f));
+
+            world.update();
+
+            REQUIRE(broadphase == world.get_broadphase());
+            REQUIRE(3u == world.get_bodies_count());
+            REQUIRE(1u == world.get_pairs().size());
+            REQUIRE((first == world.get_pairs()[0].first && second == world.get_pairs()[0].second));
+
+            world.move(second, make_box(10.5f, 10.5f, 1.0f));
+            world.update();
+
+            REQUIRE(1u == world.get_pairs().size());
+            REQUIRE((second == world.get_pairs()[0].first && third == world.get_pairs()[0].second));
+
+            world.destroy(third);
+            world.update();
+
+            REQUIRE(2u == world.get_bodies_count());
+            REQUIRE(true == world.get_pairs().empty());
+        }
+
+        SECTION("Pairs match brute force while the bodies move")
+        {
+            std::mt19937 random(3u);
+            std::uniform_real_distribution<float> position(0.0f, 40.0f);
+            std::uniform_real_distribution<float> step(-0.5f, 0.5f);
+
+            std::vector<world::Id> ids;
+            std::vector<Aabb> boxes;
+            std::vector<bool> alive;
+
+            for (std::size_t i = 0u; i < 1000u; i++)
+            {
+                boxes.push_back(make_box(position(random), position(random), 1.0f));
+                ids.push_back(world.create(boxes.back()));
+                alive.push_back(true);
+            }
+
+            world.update();
+            REQUIRE(true == check_pairs(world, ids, boxes, alive));
+
+            for (std::size_t frame = 0u; frame < 20u; frame++)
+            {
+                for (std::size_t i = 0u; i < boxes.size(); i++)
+                {
+                    if (true == alive[i] && 0u != i % 3u)
+                    {
+                        const lx::math::Vector<float, 2u> displacement = { .x = step(random), .y = step(random) };
+
+                        boxes[i] = make_box(boxes[i].min.x + displacement.x, boxes[i].min.y + displacement.y, 1.0f);
+                        world.move(ids[i], boxes[i], displacement);
+                    }
+                }
+
+                // some bodies go, some come back and may reuse the ids freed by the previous update
+                for (std::size_t i = frame; i < boxes.size(); i += 40u)
+                {
+                    if (true == alive[i])
+                    {
+                        world.destroy(ids[i]);
+                    }
+                    else
+                    {
+                        ids[i] = world.create(boxes[i]);
+                    }
+
+                    alive[i] = !alive[i];
+                }
+
+                world.update();
+                REQUIRE(true == check_pairs(world, ids, boxes, alive));
+            }
+        }
+    }
+}
@@ -0,0 +1,106 @@
+// external
+#include <catch2/catch_test_macros.hpp>
+
+// lx
+#include <lx/common/out.hpp>
+#include <lx/utils/log_record.hpp>
+
+// std
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <iterator>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+template<typename... Args> std::string encode_and_format(std::string_view format_a, const Args&... args_a)
+{
+    using namespace lx::utils;
+
+    std::vector<std::byte> payload(log_record::get_encoded_size(args_a...));
+    REQUIRE(payload.data() + payload.size() == log_record::encode(payload.data(), args_a...));
+
+    std::string text;
+    auto output = std::back_inserter(text);
+
+    REQUIRE(true == log_record::format_to(lx::common::out(output), format_a, payload));
+
+    return text;
+}
+} // namespace
+
+TEST_CASE("log_record: encode/format", "[lx][utils][log_record]")
+{
+    using namespace lx::utils;
+
+    SECTION("Arguments of every supported kind survive the round trip")
+    {
+        const std::string string = "string";
+
+        REQUIRE("1 -2 3 2.5 true x string cstring view" ==
+                encode_and_format("{} {} {} {} {} {} {} {} {}",
+                                  std::uint8_t { 1u },
+                                  -2,
+                                  3ull,
+                                  2.5f,
+                                  true,
+                                  'x',
+                                  string,
+                                  "cstring",
+                                  std::string_view { "view" }));
+    }
+
+    SECTION("Format specs, manual indexing and escaped braces are honoured")
+    {
+        REQUIRE("  255|ff|1.50|{b}|b" == encode_and_format("{1:>5}|{1:x}|{2:.2f}|{{{0}}}|{0}", std::string_view { "b" }, 255u, 1.5));
+        REQUIRE("[  7]" == encode_and_format("[{:>3}]", 7));
+    }
+
+    SECTION("Floats are formatted as floats, not as their double expansion")
+    {
+        REQUIRE("0.1 0.1 0.30000001192092896" == encode_and_format("{} {} {}", 0.1f, 0.1, static_cast<double>(0.3f)));
+        REQUIRE(std::format("{}", 1.0f / 3.0f) == encode_and_format("{}", 1.0f / 3.0f));
+    }
+
+    SECTION("Strings are copied into the payload")
+    {
+        std::vector<std::byte> payload;
+
+        {
+            std::string temporary = "gone";
+            payload.resize(log_record::get_encoded_size(temporary));
+            log_record::encode(payload.data(), temporary);
+        }
+
+        std::string text;
+        auto output = std::back_inserter(text);
+
+        REQUIRE(true == log_record::format_to(lx::common::out(output), "{}", payload));
+        REQUIRE("gone" == text);
+    }
+
+    SECTION("Missing arguments and truncated payloads are reported")
+    {
+        std::vector<std::byte> payload(log_record::get_encoded_size(7u));
+        log_record::encode(payload.data(), 7u);
+
+        std::string text;
+        auto output = std::back_inserter(text);
+
+        REQUIRE(false == log_record::format_to(lx::common::out(output), "{} {}", payload));
+        REQUIRE(false == log_record::format_to(lx::common::out(output), "{}", std::span { payload }.first(payload.size() - 1u)));
+    }
+
+    SECTION("Call site captures its source location")
+    {
+        constexpr log_record::Site site { 0x4u, "message {}" };
+
+        REQUIRE(0x4u == site.kind);
+        REQUIRE("message {}" == site.format);
+        REQUIRE(0u != site.line);
+        REQUIRE(std::string_view::npos != site.file.find("log_record"));
+    }
+}
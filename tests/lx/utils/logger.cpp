@@ -0,0 +1,103 @@
+// external
+#include <catch2/catch_test_macros.hpp>
+
+// lx
+#include <lx/common/out.hpp>
+#include <lx/utils/log_record.hpp>
+#include <lx/utils/logger.hpp>
+
+// std
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <format>
+#include <iterator>
+#include <span>
+#include <string>
+#include <unordered_map>
+
+TEST_CASE("logger: binary mode", "[lx][utils][logger]")
+{
+    using namespace lx::common;
+    using namespace lx::utils;
+
+    constexpr std::uint32_t lines_count = 3000u;
+
+    FILE* file = std::tmpfile();
+    REQUIRE(nullptr != file);
+
+    const logger::Kind filter = logger::get_filter();
+
+    logger::set_output(file, false);
+    logger::set_filter(logger::inf);
+    logger::set_mode(logger::Mode::binary);
+
+    for (std::uint32_t i = 0u; i < lines_count; i++)
+    {
+        log_inf("line {}", i);
+    }
+
+    // the lines still in the ring are written by the writer thread before the mode changes
+    logger::set_mode(logger::Mode::sync);
+    logger::set_filter(filter);
+
+    std::rewind(file);
+    REQUIRE(true == log_record::read_header(file));
+
+    std::unordered_map<std::uint64_t, std::string> formats;
+    std::string bytes;
+    std::uint32_t records_count = 0u;
+
+    log_record::Entry entry;
+
+    while (true == log_record::read_value(file, out(entry)))
+    {
+        std::uint64_t id = 0u;
+
+        switch (entry)
+        {
+            case log_record::Entry::site:
+            {
+                std::uint64_t kind = 0u;
+                std::uint32_t line = 0u;
+                std::uint32_t column = 0u;
+                std::string file_name;
+
+                REQUIRE(true == log_record::read_value(file, out(id)));
+                REQUIRE(true == log_record::read_value(file, out(kind)));
+                REQUIRE(true == log_record::read_value(file, out(line)));
+                REQUIRE(true == log_record::read_value(file, out(column)));
+                REQUIRE(true == log_record::read_bytes(file, out(file_name)));
+                REQUIRE(true == log_record::read_bytes(file, out(formats[id])));
+            }
+            break;
+
+            case log_record::Entry::record:
+            {
+                std::int64_t time = 0;
+
+                REQUIRE(true == log_record::read_value(file, out(id)));
+                REQUIRE(true == log_record::read_value(file, out(time)));
+                REQUIRE(true == log_record::read_bytes(file, out(bytes)));
+                REQUIRE(formats.end() != formats.find(id));
+
+                std::string text;
+                auto output = std::back_inserter(text);
+
+                REQUIRE(true == log_record::format_to(out(output), formats[id], std::as_bytes(std::span { bytes })));
+                REQUIRE(std::format("line {}", records_count) == text);
+
+                records_count++;
+            }
+            break;
+
+            default:
+                FAIL("unexpected entry " << static_cast<std::uint32_t>(entry));
+        }
+    }
+
+    REQUIRE(0 != std::feof(file));
+    REQUIRE(lines_count == records_count);
+
+    std::fclose(file);
+}
@@ -0,0 +1,196 @@
+/*
+ *   Name: main.cpp
+ *   Copyright (c) Mateusz Semegen and contributors. All rights reserved.
+ */
+
+// lx
+#include <lx/common/out.hpp>
+#include <lx/utils/log_record.hpp>
+#include <lx/utils/logger.hpp>
+
+// std
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <format>
+#include <iterator>
+#include <print>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
+namespace {
+using namespace lx::common;
+using namespace lx::utils;
+
+struct Site
+{
+    std::uint64_t kind;
+    std::uint32_t line;
+    std::uint32_t column;
+    std::string file;
+    std::string format;
+};
+
+std::string_view get_tag(std::uint64_t kind_a)
+{
+    switch (static_cast<logger::Kind>(kind_a))
+    {
+        case logger::Kind::inf:
+            return "[inf]";
+        case logger::Kind::wrn:
+            return "[wrn]";
+        case logger::Kind::err:
+            return "[err]";
+        case logger::Kind::omg:
+            return "[omg]";
+        case logger::Kind::dbg:
+            return "[dbg]";
+    }
+
+    return "[???]";
+}
+
+void write_header(FILE* file_a, std::uint64_t kind_a, std::int64_t nanoseconds_a)
+{
+    const auto seconds = std::chrono::floor<std::chrono::seconds>(log_record::from_nanoseconds(nanoseconds_a));
+    const auto local_time = std::chrono::zoned_time { std::chrono::current_zone(), seconds };
+
+    std::print(file_a, "[{:%H:%M:%S %d.%m.%Y}]{}", local_time, get_tag(kind_a));
+}
+
+bool decode(FILE* input_a, FILE* output_a)
+{
+    if (false == log_record::read_header(input_a))
+    {
+        std::print(stderr, "not an lx binary log\n");
+        return false;
+    }
+
+    std::unordered_map<std::uint64_t, Site> sites;
+    std::string bytes;
+    std::string line;
+
+    log_record::Entry entry;
+
+    while (true == log_record::read_value(input_a, out(entry)))
+    {
+        switch (entry)
+        {
+            case log_record::Entry::site:
+            {
+                std::uint64_t id = 0u;
+                Site site {};
+
+                if (false == log_record::read_value(input_a, out(id)) || false == log_record::read_value(input_a, out(site.kind)) ||
+                    false == log_record::read_value(input_a, out(site.line)) ||
+                    false == log_record::read_value(input_a, out(site.column)) ||
+                    false == log_record::read_bytes(input_a, out(site.file)) ||
+                    false == log_record::read_bytes(input_a, out(site.format)))
+                {
+                    return false;
+                }
+
+                sites[id] = std::move(site);
+            }
+            break;
+
+            case log_record::Entry::record:
+            {
+                std::uint64_t id = 0u;
+                std::int64_t time = 0;
+
+                if (false == log_record::read_value(input_a, out(id)) || false == log_record::read_value(input_a, out(time)) ||
+                    false == log_record::read_bytes(input_a, out(bytes)))
+                {
+                    return false;
+                }
+
+                auto site = sites.find(id);
+
+                if (sites.end() == site)
+                {
+                    std::print(stderr, "record of an unknown site {:#x}\n", id);
+                    continue;
+                }
+
+                line.clear();
+
+                auto output = std::back_inserter(line);
+                std::format_to(output, "[{}][{},{}] ", site->second.file, site->second.line, site->second.column);
+
+                if (false == log_record::format_to(out(output), site->second.format, std::as_bytes(std::span { bytes })))
+                {
+                    std::format_to(output, "<malformed: \"{}\">", site->second.format);
+                }
+
+                write_header(output_a, site->second.kind, time);
+                std::print(output_a, "{}\n", line);
+            }
+            break;
+
+            case log_record::Entry::text:
+            {
+                std::uint64_t kind = 0u;
+                std::int64_t time = 0;
+
+                if (false == log_record::read_value(input_a, out(kind)) || false == log_record::read_value(input_a, out(time)) ||
+                    false == log_record::read_bytes(input_a, out(bytes)))
+                {
+                    return false;
+                }
+
+                write_header(output_a, kind, time);
+                std::print(output_a, "{}\n", bytes);
+            }
+            break;
+
+            default:
+                std::print(stderr, "unknown entry {}\n", static_cast<std::uint32_t>(entry));
+                return false;
+        }
+    }
+
+    return true;
+}
+} // namespace
+
+// usage: log_decoder <binary log> [text output]
+int main(int argc_a, char** argv_a)
+{
+    if (argc_a < 2)
+    {
+        std::print(stderr, "usage: log_decoder <binary log> [text output]\n");
+        return -1;
+    }
+
+    FILE* input = std::fopen(argv_a[1], "rb");
+
+    if (nullptr == input)
+    {
+        std::print(stderr, "cannot open {}\n", argv_a[1]);
+        return -2;
+    }
+
+    FILE* output = argc_a > 2 ? std::fopen(argv_a[2], "w") : stdout;
+
+    if (nullptr == output)
+    {
+        std::print(stderr, "cannot open {}\n", argv_a[2]);
+        std::fclose(input);
+        return -2;
+    }
+
+    const bool decoded = decode(input, output);
+
+    std::fclose(input);
+
+    if (stdout != output)
+    {
+        std::fclose(output);
+    }
+
+    return true == decoded ? 0 : -3;
+}